@@ -0,0 +1,148 @@
+#include "Commands/UnrealMCPBatchTransaction.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "ScopedTransaction.h"
+
+FUnrealMCPBatchTransaction::FScope::FScope(const FText& Description)
+	: bOwner(!FUnrealMCPBatchTransaction::Get().IsActive())
+{
+	if (bOwner)
+	{
+		FUnrealMCPBatchTransaction::Get().Begin(Description);
+	}
+}
+
+FUnrealMCPBatchTransaction::FScope::~FScope()
+{
+	if (bOwner)
+	{
+		FUnrealMCPBatchTransaction::Get().End();
+	}
+}
+
+FUnrealMCPBatchTransaction::FEditScope::FEditScope(const FText& Description)
+{
+	if (!FUnrealMCPBatchTransaction::Get().IsActive())
+	{
+		Transaction = MakeUnique<FScopedTransaction>(Description);
+	}
+}
+
+FUnrealMCPBatchTransaction::FEditScope::~FEditScope() = default;
+
+void FUnrealMCPBatchTransaction::FEditScope::Cancel()
+{
+	if (Transaction.IsValid())
+	{
+		Transaction->Cancel();
+	}
+}
+
+FUnrealMCPBatchTransaction& FUnrealMCPBatchTransaction::Get()
+{
+	static FUnrealMCPBatchTransaction Instance;
+	return Instance;
+}
+
+FUnrealMCPBatchTransaction::~FUnrealMCPBatchTransaction() = default;
+
+void FUnrealMCPBatchTransaction::Begin(const FText& Description)
+{
+	check(IsInGameThread());
+	Modified.Reset();
+	PendingBlueprints.Reset();
+	PendingBlueprintKeys.Reset();
+	NumModifies = 0;
+	NumModifiesSkipped = 0;
+	NumBlueprintMarks = 0;
+	NumBlueprintsNotified = 0;
+
+	Transaction = MakeUnique<FScopedTransaction>(Description);
+}
+
+void FUnrealMCPBatchTransaction::End()
+{
+	check(IsInGameThread());
+	// Notify inside the transaction so anything the notifications touch undoes with the batch
+	FlushModified();
+	Transaction.Reset();
+	Modified.Reset();
+}
+
+void FUnrealMCPBatchTransaction::Modify(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+	if (!IsActive())
+	{
+		Object->Modify();
+		return;
+	}
+
+	bool bAlreadyRecorded = false;
+	Modified.Add(TObjectKey<UObject>(Object), &bAlreadyRecorded);
+	if (bAlreadyRecorded)
+	{
+		++NumModifiesSkipped;
+		return;
+	}
+	++NumModifies;
+	Object->Modify();
+}
+
+void FUnrealMCPBatchTransaction::MarkBlueprintModified(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+	if (!IsActive())
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+		return;
+	}
+
+	++NumBlueprintMarks;
+	bool bAlreadyPending = false;
+	PendingBlueprintKeys.Add(TObjectKey<UBlueprint>(Blueprint), &bAlreadyPending);
+	if (!bAlreadyPending)
+	{
+		// Dirty now so save tracking and later sub-commands see the package as modified
+		Blueprint->MarkPackageDirty();
+		PendingBlueprints.Add(Blueprint);
+	}
+}
+
+void FUnrealMCPBatchTransaction::FlushModified()
+{
+	check(IsInGameThread());
+	if (PendingBlueprints.Num() == 0)
+	{
+		return;
+	}
+
+	// Swap out first: the notifications can call back into MarkBlueprintModified
+	TArray<TWeakObjectPtr<UBlueprint>> ToNotify = MoveTemp(PendingBlueprints);
+	PendingBlueprints.Reset();
+	PendingBlueprintKeys.Reset();
+	for (const TWeakObjectPtr<UBlueprint>& Blueprint : ToNotify)
+	{
+		if (UBlueprint* Resolved = Blueprint.Get())
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(Resolved);
+			++NumBlueprintsNotified;
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBatchTransaction::GetStats() const
+{
+	TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+	Stats->SetNumberField(TEXT("modifies"), NumModifies);
+	Stats->SetNumberField(TEXT("modifies_skipped"), NumModifiesSkipped);
+	Stats->SetNumberField(TEXT("blueprint_marks"), NumBlueprintMarks);
+	Stats->SetNumberField(TEXT("blueprints_notified"), NumBlueprintsNotified);
+	return Stats;
+}
@@ -1,5 +1,11 @@
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPBlueprintFingerprint.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPComponentIndex.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -14,13 +20,14 @@
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Kismet2/CompilerResultsLog.h"
 #include "Logging/TokenizedMessage.h"
-#include "ScopedTransaction.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
+#include "Misc/PackageName.h"
 #include "UObject/Field.h"
 #include "UObject/FieldPath.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/UObjectHash.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 
@@ -34,6 +41,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleCreateBlueprint(Params);
     }
+    else if (CommandType == TEXT("create_blueprints_from_template"))
+    {
+        return HandleCreateBlueprintsFromTemplate(Params);
+    }
     else if (CommandType == TEXT("add_component_to_blueprint"))
     {
         return HandleAddComponentToBlueprint(Params);
@@ -42,6 +53,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleSetComponentProperty(Params);
     }
+    else if (CommandType == TEXT("set_component_properties"))
+    {
+        return HandleSetComponentProperties(Params);
+    }
     else if (CommandType == TEXT("set_physics_properties"))
     {
         return HandleSetPhysicsProperties(Params);
@@ -50,6 +65,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleCompileBlueprint(Params);
     }
+    else if (CommandType == TEXT("compile_blueprints"))
+    {
+        return HandleCompileBlueprints(Params);
+    }
+    else if (CommandType == TEXT("get_compile_blueprints_status"))
+    {
+        return HandleGetCompileBlueprintsStatus(Params);
+    }
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
         return HandleSpawnBlueprintActor(Params);
@@ -149,48 +172,43 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
     // Default to Actor if no parent class specified
     UClass* SelectedParentClass = AActor::StaticClass();
     
-    // Try to find the specified parent class
+    // Native name (with or without its A/U prefix), Blueprint name, or class path; project, plugin and
+    // Blueprint classes resolve the same way as engine ones
+    FString ParentClassWarning;
     if (!ParentClass.IsEmpty())
     {
-        FString ClassName = ParentClass;
-        if (!ClassName.StartsWith(TEXT("A")))
-        {
-            ClassName = TEXT("A") + ClassName;
-        }
-        
-        // First try direct StaticClass lookup for common classes
-        UClass* FoundClass = nullptr;
-        if (ClassName == TEXT("APawn"))
+        TArray<FString> ClassCandidates;
+        UClass* FoundClass = FUnrealMCPClassIndex::Get().FindClass(ParentClass, nullptr, &ClassCandidates);
+        if (!FoundClass && ClassCandidates.Num() > 1)
         {
-            FoundClass = APawn::StaticClass();
-        }
-        else if (ClassName == TEXT("AActor"))
-        {
-            FoundClass = AActor::StaticClass();
-        }
-        else
-        {
-            // Try loading the class using LoadClass which is more reliable than FindObject
-            const FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-            FoundClass = LoadClass<AActor>(nullptr, *ClassPath);
-            
-            if (!FoundClass)
+            FString Details = TEXT("Multiple classes matched by name. Please pass the class path. Candidates:\n");
+            for (const FString& C : ClassCandidates)
             {
-                // Try alternate paths if not found
-                const FString GameClassPath = FString::Printf(TEXT("/Script/Game.%s"), *ClassName);
-                FoundClass = LoadClass<AActor>(nullptr, *GameClassPath);
+                Details += TEXT("- ") + C + TEXT("\n");
             }
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Parent class '%s' is ambiguous"), *ParentClass),
+                TEXT("ERR_BAD_REQUEST"),
+                Details);
+        }
+
+        if (FoundClass && !FKismetEditorUtilities::CanCreateBlueprintOfClass(FoundClass))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Cannot create a Blueprint of class '%s'"), *FoundClass->GetName()),
+                TEXT("ERR_BAD_REQUEST"),
+                FoundClass->GetPathName());
         }
 
         if (FoundClass)
         {
             SelectedParentClass = FoundClass;
-            UE_LOG(LogTemp, Log, TEXT("Successfully set parent class to '%s'"), *ClassName);
+            UE_LOG(LogTemp, Log, TEXT("Successfully set parent class to '%s'"), *FoundClass->GetPathName());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("Could not find specified parent class '%s' at paths: /Script/Engine.%s or /Script/Game.%s, defaulting to AActor"), 
-                *ClassName, *ClassName, *ClassName);
+            ParentClassWarning = FString::Printf(TEXT("Parent class '%s' not found, defaulted to Actor"), *ParentClass);
+            UE_LOG(LogTemp, Warning, TEXT("%s"), *ParentClassWarning);
         }
     }
     
@@ -212,6 +230,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
         ResultObj->SetStringField(TEXT("name"), AssetName);
         ResultObj->SetStringField(TEXT("path"), FullAssetPath); // legacy
         ResultObj->SetStringField(TEXT("object_path"), ObjectPath); // legacy
+        ResultObj->SetStringField(TEXT("parent_class"), SelectedParentClass->GetPathName());
+        if (!ParentClassWarning.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("warning"), ParentClassWarning);
+        }
         FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, FullAssetPath);
         return ResultObj;
     }
@@ -220,6 +243,264 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
 
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprintsFromTemplate(const TSharedPtr<FJsonObject>& Params)
+{
+    FString TemplateName;
+    FString TemplatePath;
+    Params->TryGetStringField(TEXT("template_name"), TemplateName);
+    Params->TryGetStringField(TEXT("template_path"), TemplatePath);
+    if (TemplateName.IsEmpty() && TemplatePath.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'template_name' or 'template_path' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Variants = nullptr;
+    if (!Params->TryGetArrayField(TEXT("blueprints"), Variants) || Variants->Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            TEXT("Missing 'blueprints' parameter"),
+            TEXT("ERR_BAD_REQUEST"),
+            TEXT("blueprints: [{name, folder_path | asset_path, properties: {path: value}, component_properties: {Component: {path: value}}}]"));
+    }
+
+    FString ResolvedTemplatePath;
+    TArray<FString> Candidates;
+    UBlueprint* Template = FUnrealMCPCommonUtils::ResolveBlueprintFromNameOrPath(TemplateName, TemplatePath, ResolvedTemplatePath, Candidates);
+    if (!Template)
+    {
+        FString Details;
+        if (Candidates.Num() > 1)
+        {
+            Details = TEXT("Multiple blueprints matched by name. Please pass template_path. Candidates:\n");
+            for (const FString& C : Candidates)
+            {
+                Details += TEXT("- ") + C + TEXT("\n");
+            }
+        }
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Template blueprint '%s' not found or ambiguous"), TemplatePath.IsEmpty() ? *TemplateName : *TemplatePath),
+            TEXT("ERR_ASSET_NOT_FOUND"),
+            Details);
+    }
+
+    FString DefaultFolder = FUnrealMCPCommonUtils::GetDefaultBlueprintFolder();
+    Params->TryGetStringField(TEXT("folder_path"), DefaultFolder);
+
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+    int32 ChunkSize = 16;
+    Params->TryGetNumberField(TEXT("chunk_size"), ChunkSize);
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<UBlueprint*> Created;
+    TArray<TSharedPtr<FJsonValue>> Items;
+    Items.Reserve(Variants->Num());
+    int32 ErrorCount = 0;
+
+    // A failed variant leaves nothing behind: the duplicate has not been registered yet, so dropping every
+    // object in its package is enough
+    auto DiscardVariant = [](UPackage* Package)
+    {
+        TArray<UObject*> PackageObjects;
+        GetObjectsWithPackage(Package, PackageObjects);
+        for (UObject* Object : PackageObjects)
+        {
+            Object->ClearFlags(RF_Public | RF_Standalone);
+            Object->MarkAsGarbage();
+        }
+        Package->ClearDirtyFlag();
+        Package->MarkAsGarbage();
+    };
+
+    auto ApplyOverrides = [](UObject* Target, const TSharedPtr<FJsonObject>& Overrides, TArray<FString>& OutErrors)
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Overrides->Values)
+        {
+            FString PropErr;
+            if (!FUnrealMCPCommonUtils::SetObjectProperty(Target, Pair.Key, Pair.Value, PropErr))
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Pair.Key, *PropErr));
+            }
+        }
+    };
+
+    for (const TSharedPtr<FJsonValue>& VariantValue : *Variants)
+    {
+        const TSharedPtr<FJsonObject>* VariantPtr = nullptr;
+        TSharedPtr<FJsonObject> ItemObj = MakeShared<FJsonObject>();
+        auto FailItem = [&](const FString& Message)
+        {
+            ItemObj->SetBoolField(TEXT("success"), false);
+            ItemObj->SetStringField(TEXT("error"), Message);
+            Items.Add(MakeShared<FJsonValueObject>(ItemObj));
+            ++ErrorCount;
+        };
+
+        if (!VariantValue->TryGetObject(VariantPtr))
+        {
+            FailItem(TEXT("Entry must be an object"));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& Variant = *VariantPtr;
+
+        FString AssetName;
+        Variant->TryGetStringField(TEXT("name"), AssetName);
+        FString RequestedAssetPath;
+        Variant->TryGetStringField(TEXT("asset_path"), RequestedAssetPath);
+        FString FolderPath = DefaultFolder;
+        Variant->TryGetStringField(TEXT("folder_path"), FolderPath);
+        ItemObj->SetStringField(TEXT("name"), AssetName);
+
+        // Same destination rules as create_blueprint
+        FString FullAssetPath;
+        FString Err;
+        if (!RequestedAssetPath.IsEmpty())
+        {
+            if (!FUnrealMCPCommonUtils::NormalizeLongPackageAssetPath(RequestedAssetPath, FullAssetPath, Err))
+            {
+                FailItem(FString::Printf(TEXT("Invalid asset_path: %s"), *Err));
+                continue;
+            }
+            AssetName = FPackageName::GetLongPackageAssetName(FullAssetPath);
+            ItemObj->SetStringField(TEXT("name"), AssetName);
+        }
+        else if (AssetName.IsEmpty())
+        {
+            FailItem(TEXT("Missing 'name' or 'asset_path'"));
+            continue;
+        }
+        else
+        {
+            if (!FUnrealMCPCommonUtils::NormalizeLongPackageFolder(FolderPath, FolderPath, Err))
+            {
+                FailItem(FString::Printf(TEXT("Invalid folder_path: %s"), *Err));
+                continue;
+            }
+            FullAssetPath = FolderPath + AssetName;
+        }
+
+        FString ObjectPath;
+        if (!FUnrealMCPCommonUtils::IsWritePathAllowed(FullAssetPath, Err) ||
+            !FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(FullAssetPath, ObjectPath, Err))
+        {
+            FailItem(Err);
+            continue;
+        }
+        if (UEditorAssetLibrary::DoesAssetExist(ObjectPath))
+        {
+            FailItem(FString::Printf(TEXT("Blueprint already exists: %s"), *FullAssetPath));
+            continue;
+        }
+
+        // Clone the whole asset (graphs, SCS, defaults) instead of rebuilding it edit by edit. Duplication
+        // normally compiles each copy; with compile on, that is left to the one chunked batch compile below.
+        UPackage* Package = CreatePackage(*FullAssetPath);
+        UBlueprint* NewBlueprint = nullptr;
+        {
+            TOptional<FBlueprintDuplicationScopeFlags> NoCompile;
+            if (bCompile)
+            {
+                NoCompile.Emplace(FBlueprintDuplicationScopeFlags::NoExtraCompilation);
+            }
+            NewBlueprint = DuplicateObject<UBlueprint>(Template, Package, *AssetName);
+        }
+        if (!NewBlueprint)
+        {
+            DiscardVariant(Package);
+            FailItem(TEXT("Failed to duplicate template"));
+            continue;
+        }
+        NewBlueprint->SetFlags(RF_Public | RF_Standalone);
+
+        // Class defaults live on the duplicate's own generated class; if duplication did not give it one,
+        // compile this copy now rather than write overrides into the template's class
+        if (!NewBlueprint->GeneratedClass || NewBlueprint->GeneratedClass->GetOutermost() != Package)
+        {
+            FKismetEditorUtilities::CompileBlueprint(NewBlueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+        }
+
+        TArray<FString> OverrideErrors;
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (Variant->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            UObject* DefaultObject = NewBlueprint->GeneratedClass && NewBlueprint->GeneratedClass->GetOutermost() == Package
+                ? NewBlueprint->GeneratedClass->GetDefaultObject()
+                : nullptr;
+            if (DefaultObject)
+            {
+                DefaultObject->Modify();
+                ApplyOverrides(DefaultObject, *Properties, OverrideErrors);
+            }
+            else
+            {
+                OverrideErrors.Add(TEXT("properties: duplicate has no generated class"));
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* ComponentProperties = nullptr;
+        if (Variant->TryGetObjectField(TEXT("component_properties"), ComponentProperties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& ComponentPair : (*ComponentProperties)->Values)
+            {
+                USCS_Node* ComponentNode = NewBlueprint->SimpleConstructionScript
+                    ? NewBlueprint->SimpleConstructionScript->FindSCSNode(FName(*ComponentPair.Key))
+                    : nullptr;
+                const TSharedPtr<FJsonObject>* ComponentOverrides = nullptr;
+                if (!ComponentNode || !ComponentNode->ComponentTemplate)
+                {
+                    OverrideErrors.Add(FString::Printf(TEXT("Component not found: %s"), *ComponentPair.Key));
+                }
+                else if (!ComponentPair.Value->TryGetObject(ComponentOverrides))
+                {
+                    OverrideErrors.Add(FString::Printf(TEXT("%s: expected an object of property values"), *ComponentPair.Key));
+                }
+                else
+                {
+                    ComponentNode->ComponentTemplate->Modify();
+                    ApplyOverrides(ComponentNode->ComponentTemplate, *ComponentOverrides, OverrideErrors);
+                }
+            }
+        }
+
+        if (OverrideErrors.Num() > 0)
+        {
+            DiscardVariant(Package);
+            TArray<TSharedPtr<FJsonValue>> ErrorValues;
+            for (const FString& OverrideError : OverrideErrors)
+            {
+                ErrorValues.Add(MakeShared<FJsonValueString>(OverrideError));
+            }
+            ItemObj->SetArrayField(TEXT("override_errors"), ErrorValues);
+            FailItem(TEXT("Overrides failed; variant not created"));
+            continue;
+        }
+
+        FAssetRegistryModule::AssetCreated(NewBlueprint);
+        Package->MarkPackageDirty();
+        Created.Add(NewBlueprint);
+
+        ItemObj->SetBoolField(TEXT("success"), true);
+        FUnrealMCPCommonUtils::AddResolvedAssetFields(ItemObj, FullAssetPath);
+        Items.Add(MakeShared<FJsonValueObject>(ItemObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("template"), Template->GetPathName());
+    ResultObj->SetArrayField(TEXT("items"), Items);
+    ResultObj->SetNumberField(TEXT("created"), Created.Num());
+    ResultObj->SetNumberField(TEXT("errors"), ErrorCount);
+
+    // One chunked compile for every duplicate so they share reinstancing; duplication skipped its own compile
+    if (bCompile && Created.Num() > 0)
+    {
+        ResultObj->SetObjectField(TEXT("compile"), FUnrealMCPCompileQueue::Get().RunBatchCompile(Created, ChunkSize));
+    }
+
+    ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    UE_LOG(LogTemp, Log, TEXT("UnrealMCP: created %d blueprints from template %s (%d errors)"), Created.Num(), *Template->GetName(), ErrorCount);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -266,37 +547,31 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
     }
 
 
-    // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentType);
-    
-    // If not found, try with "Component" suffix
-    if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+    // Component class by name ("StaticMesh", "StaticMeshComponent", "UStaticMeshComponent"), Blueprint
+    // component name, or class path
+    FUnrealMCPClassIndex& Classes = FUnrealMCPClassIndex::Get();
+    TArray<FString> ClassCandidates;
+    UClass* ComponentClass = Classes.FindClass(ComponentType, UActorComponent::StaticClass(), &ClassCandidates);
+    if (!ComponentClass && ClassCandidates.Num() == 0 && !ComponentType.EndsWith(TEXT("Component")))
     {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithSuffix);
+        ComponentClass = Classes.FindClass(ComponentType + TEXT("Component"), UActorComponent::StaticClass(), &ClassCandidates);
     }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
+
+    if (!ComponentClass)
     {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+        FString Details;
+        if (ClassCandidates.Num() > 1)
         {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(ANY_PACKAGE, *ComponentTypeWithBoth);
+            Details = TEXT("Multiple component classes matched by name. Please pass the class path. Candidates:\n");
+            for (const FString& C : ClassCandidates)
+            {
+                Details += TEXT("- ") + C + TEXT("\n");
+            }
         }
-    }
-    
-    // Verify that the class is a valid component type
-    if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Unknown component type: %s"), *ComponentType),
+            TEXT("ERR_BAD_REQUEST"),
+            Details);
     }
 
     // Add the component to the blueprint
@@ -324,12 +599,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
         // Add to root if no parent specified
         Blueprint->SimpleConstructionScript->AddNode(NewNode);
 
-        // Compile the blueprint
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        // Compile once at the end of the request/batch instead of per component
+        FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("component_name"), ComponentName);
         ResultObj->SetStringField(TEXT("component_type"), ComponentType);
+        ResultObj->SetStringField(TEXT("compile"), TEXT("deferred"));
         FUnrealMCPCommonUtils::AddResolvedAssetFieldsFromUObject(ResultObj, Blueprint);
         return ResultObj;
     }
@@ -416,32 +692,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
 
 
     // Find the component
-    USCS_Node* ComponentNode = nullptr;
-    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Searching for component %s in blueprint nodes"), *ComponentName);
-    
     if (!Blueprint->SimpleConstructionScript)
     {
         UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - SimpleConstructionScript is NULL for blueprint %s"), *BlueprintName);
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid blueprint construction script"));
     }
-    
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node)
-        {
-            UE_LOG(LogTemp, Verbose, TEXT("SetComponentProperty - Found node: %s"), *Node->GetVariableName().ToString());
-            if (Node->GetVariableName().ToString() == ComponentName)
-            {
-                ComponentNode = Node;
-                break;
-            }
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Found NULL node in blueprint"));
-        }
-    }
 
+    USCS_Node* ComponentNode = FUnrealMCPComponentIndex::Get().FindNode(Blueprint, FName(*ComponentName));
     if (!ComponentNode)
     {
         UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Component not found: %s"), *ComponentName);
@@ -465,16 +722,8 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
     // Check if this is a Spring Arm component and log special debug info
     if (ComponentTemplate->GetClass()->GetName().Contains(TEXT("SpringArm")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm component detected! Class: %s"), 
+        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - SpringArm component detected! Class: %s"), 
             *ComponentTemplate->GetClass()->GetPathName());
-            
-        // Log all properties of the SpringArm component class
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm properties:"));
-        for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
-        {
-            FProperty* Prop = *PropIt;
-            UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
-        }
 
         // Special handling for Spring Arm properties
         if (Params->HasField(TEXT("property_value")))
@@ -582,7 +831,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
             {
                 // Mark the blueprint as modified
                 UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set SpringArm property %s"), *PropertyName);
-                FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+                FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
 
                 TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
                 ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -615,15 +864,16 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
                 *PropertyName, *ComponentName);
             
             // List all available properties for this component
-            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available properties for %s:"), *ComponentName);
-            for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
+            FString Details = TEXT("Available properties:\n");
+            for (const FString& Desc : FUnrealMCPComponentIndex::Get().GetPropertyDescriptions(ComponentTemplate->GetClass()))
             {
-                FProperty* Prop = *PropIt;
-                UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
+                Details += TEXT("- ") + Desc + TEXT("\n");
             }
-            
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property %s not found on component %s"), *PropertyName, *ComponentName));
+
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Property %s not found on component %s"), *PropertyName, *ComponentName),
+                TEXT("ERR_BAD_REQUEST"),
+                Details);
         }
         else
         {
@@ -857,7 +1107,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
             // Mark the blueprint as modified
             UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set property %s on component %s"), 
                 *PropertyName, *ComponentName);
-            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+            FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
 
             TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
             ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -878,6 +1128,137 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
     return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_value' parameter"));
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
+    FString BlueprintPath;
+    Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath);
+    if (BlueprintName.IsEmpty() && BlueprintPath.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TSharedPtr<FJsonObject>* Components = nullptr;
+    if (!Params->TryGetObjectField(TEXT("components"), Components) || (*Components)->Values.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            TEXT("Missing 'components' parameter"),
+            TEXT("ERR_BAD_REQUEST"),
+            TEXT("components: {ComponentName: {property_path: value}}"));
+    }
+
+    FString ResolvedPath;
+    TArray<FString> Candidates;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::ResolveBlueprintFromNameOrPath(BlueprintName, BlueprintPath, ResolvedPath, Candidates);
+    if (!Blueprint)
+    {
+        FString Details;
+        if (Candidates.Num() > 1)
+        {
+            Details = TEXT("Multiple blueprints matched by name. Please pass blueprint_path. Candidates:\n");
+            for (const FString& C : Candidates)
+            {
+                Details += TEXT("- ") + C + TEXT("\n");
+            }
+        }
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Blueprint '%s' not found or ambiguous"), BlueprintPath.IsEmpty() ? *BlueprintName : *BlueprintPath),
+            TEXT("ERR_ASSET_NOT_FOUND"),
+            Details);
+    }
+
+    if (!Blueprint->SimpleConstructionScript)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid blueprint construction script"));
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    FUnrealMCPComponentIndex& ComponentIndex = FUnrealMCPComponentIndex::Get();
+    FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Set Component Properties")));
+
+    TSharedPtr<FJsonObject> ResultsObj = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 SetCount = 0;
+    auto AddError = [&Errors](const FString& Component, const FString& Property, const FString& Message)
+    {
+        TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+        ErrorObj->SetStringField(TEXT("component"), Component);
+        if (!Property.IsEmpty())
+        {
+            ErrorObj->SetStringField(TEXT("property"), Property);
+        }
+        ErrorObj->SetStringField(TEXT("error"), Message);
+        Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+    };
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& ComponentPair : (*Components)->Values)
+    {
+        const FString& ComponentName = ComponentPair.Key;
+        USCS_Node* ComponentNode = ComponentIndex.FindNode(Blueprint, FName(*ComponentName));
+        UObject* Template = ComponentNode ? ComponentNode->ComponentTemplate.Get() : nullptr;
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (!Template)
+        {
+            AddError(ComponentName, FString(), TEXT("Component not found"));
+            continue;
+        }
+        if (!ComponentPair.Value->TryGetObject(Properties))
+        {
+            AddError(ComponentName, FString(), TEXT("Expected an object of property values"));
+            continue;
+        }
+
+        // One Modify/PostEditChange per template, however many properties it gets
+        FUnrealMCPBatchTransaction::Get().Modify(Template);
+        TArray<FString> SetProperties;
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& PropertyPair : (*Properties)->Values)
+        {
+            FString PropErr;
+            if (FUnrealMCPCommonUtils::SetObjectProperty(Template, PropertyPair.Key, PropertyPair.Value, PropErr))
+            {
+                SetProperties.Add(PropertyPair.Key);
+            }
+            else
+            {
+                AddError(ComponentName, PropertyPair.Key, PropErr);
+            }
+        }
+        Template->PostEditChange();
+
+        TArray<TSharedPtr<FJsonValue>> SetValues;
+        for (const FString& Property : SetProperties)
+        {
+            SetValues.Add(MakeShared<FJsonValueString>(Property));
+        }
+        ResultsObj->SetArrayField(ComponentName, SetValues);
+        SetCount += SetProperties.Num();
+    }
+
+    if (SetCount > 0)
+    {
+        FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
+    }
+    else
+    {
+        // Nothing changed; don't leave an empty entry in the undo history (no-op inside a batch)
+        Transaction.Cancel();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetObjectField(TEXT("set"), ResultsObj);
+    ResultObj->SetNumberField(TEXT("set_count"), SetCount);
+    ResultObj->SetNumberField(TEXT("error_count"), Errors.Num());
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    ResultObj->SetBoolField(TEXT("success"), Errors.Num() == 0);
+    ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -919,15 +1300,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(
 
 
     // Find the component
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
+    USCS_Node* ComponentNode = FUnrealMCPComponentIndex::Get().FindNode(Blueprint, FName(*ComponentName));
 
     if (!ComponentNode)
     {
@@ -965,7 +1338,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -1006,6 +1379,28 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
             Details);
     }
 
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    // Skip the compile when nothing structural changed since the last successful one.
+    FUnrealMCPCompileQueue::Get().Remove(Blueprint);
+    const FString Fingerprint = FUnrealMCPBlueprintFingerprint::Compute(Blueprint);
+    if (!bForce && FUnrealMCPBlueprintFingerprint::Get().IsCompileUpToDate(Blueprint, Fingerprint))
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), BlueprintName);
+        ResultObj->SetBoolField(TEXT("compiled"), false);
+        ResultObj->SetBoolField(TEXT("skipped"), true);
+        ResultObj->SetStringField(TEXT("reason"), TEXT("fingerprint_unchanged"));
+        ResultObj->SetBoolField(TEXT("compile_success"), true);
+        ResultObj->SetNumberField(TEXT("num_errors"), 0);
+        ResultObj->SetNumberField(TEXT("num_warnings"), Blueprint->Status == BS_UpToDateWithWarnings ? 1 : 0);
+        ResultObj->SetArrayField(TEXT("diagnostics"), TArray<TSharedPtr<FJsonValue>>());
+        ResultObj->SetStringField(TEXT("fingerprint"), Fingerprint);
+        FUnrealMCPCommonUtils::AddResolvedAssetFieldsFromUObject(ResultObj, Blueprint);
+        return ResultObj;
+    }
+
     // Compile with structured diagnostics.
     FCompilerResultsLog Results;
     Results.bAnnotateMentionedNodes = true;
@@ -1014,6 +1409,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     // Note: This is intentionally not wrapped in a transaction.
     FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &Results);
 
+    // Record the post-compile structure (compiling can reconstruct nodes and pins).
+    const FString CompiledFingerprint = FUnrealMCPBlueprintFingerprint::Compute(Blueprint);
+    FUnrealMCPBlueprintFingerprint::Get().RecordCompile(Blueprint, CompiledFingerprint);
+
     const bool bCompileOk = (Results.NumErrors == 0);
 
     TArray<TSharedPtr<FJsonValue>> Diagnostics;
@@ -1050,6 +1449,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     ResultObj->SetNumberField(TEXT("num_errors"), Results.NumErrors);
     ResultObj->SetNumberField(TEXT("num_warnings"), Results.NumWarnings);
     ResultObj->SetArrayField(TEXT("diagnostics"), Diagnostics);
+    ResultObj->SetStringField(TEXT("fingerprint"), CompiledFingerprint);
 
     // Canonical path outputs
     ResultObj->SetStringField(TEXT("resolved_asset_path"), ResolvedPath);
@@ -1066,6 +1466,123 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> Unresolved;
+
+    // Explicit list: short names or asset paths
+    const TArray<TSharedPtr<FJsonValue>>* BlueprintList = nullptr;
+    if (Params->TryGetArrayField(TEXT("blueprints"), BlueprintList))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *BlueprintList)
+        {
+            const FString Entry = Value->AsString();
+            const bool bIsPath = Entry.StartsWith(TEXT("/"));
+
+            FString ResolvedPath;
+            TArray<FString> Candidates;
+            UBlueprint* Blueprint = FUnrealMCPCommonUtils::ResolveBlueprintFromNameOrPath(
+                bIsPath ? FString() : Entry, bIsPath ? Entry : FString(), ResolvedPath, Candidates);
+            if (Blueprint)
+            {
+                Blueprints.AddUnique(Blueprint);
+            }
+            else
+            {
+                TSharedPtr<FJsonObject> Miss = MakeShared<FJsonObject>();
+                Miss->SetStringField(TEXT("blueprint"), Entry);
+                Miss->SetStringField(TEXT("error"), Candidates.Num() > 1 ? TEXT("Ambiguous name; pass the asset path") : TEXT("Not found"));
+                Unresolved.Add(MakeShared<FJsonValueObject>(Miss));
+            }
+        }
+    }
+
+    // Folder: every Blueprint (including Widget/Anim subclasses) under it
+    FString Folder;
+    if (Params->TryGetStringField(TEXT("folder"), Folder) && !Folder.IsEmpty())
+    {
+        FString NormalizedFolder;
+        FString FolderError;
+        if (!FUnrealMCPCommonUtils::NormalizeLongPackageFolder(Folder, NormalizedFolder, FolderError))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Invalid folder: %s"), *Folder), TEXT("ERR_INVALID_PATH"), FolderError);
+        }
+
+        bool bRecursive = true;
+        Params->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*NormalizedFolder));
+        Filter.bRecursivePaths = bRecursive;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+        for (const FAssetData& Asset : Assets)
+        {
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+            {
+                Blueprints.AddUnique(Blueprint);
+            }
+        }
+    }
+
+    if (Blueprints.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            TEXT("No blueprints to compile"),
+            Unresolved.Num() > 0 ? TEXT("ERR_ASSET_NOT_FOUND") : TEXT("ERR_BAD_REQUEST"),
+            TEXT("Pass 'blueprints' (names or asset paths) and/or 'folder'"));
+    }
+
+    int32 ChunkSize = 16;
+    Params->TryGetNumberField(TEXT("chunk_size"), ChunkSize);
+
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    bool bWait = false;
+    Params->TryGetBoolField(TEXT("wait"), bWait);
+
+    // Note: Like compile_blueprint, this is intentionally not wrapped in a transaction.
+    TSharedPtr<FJsonObject> ResultObj;
+    if (bWait)
+    {
+        ResultObj = FUnrealMCPCompileQueue::Get().RunBatchCompile(Blueprints, ChunkSize, bForce);
+    }
+    else
+    {
+        const FString JobId = FUnrealMCPCompileQueue::Get().StartBatchCompile(Blueprints, ChunkSize, bForce);
+        ResultObj = FUnrealMCPCompileQueue::Get().GetBatchCompileStatus(JobId);
+        ResultObj->SetStringField(TEXT("message"), TEXT("Compiling across editor ticks; poll get_compile_blueprints_status with job_id"));
+    }
+
+    ResultObj->SetArrayField(TEXT("unresolved"), Unresolved);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetCompileBlueprintsStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    FString JobId;
+    if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCompileQueue::Get().GetBatchCompileStatus(JobId);
+    if (!ResultObj.IsValid())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Unknown compile job: %s"), *JobId),
+            TEXT("ERR_BAD_REQUEST"),
+            TEXT("Only the most recent finished jobs are kept"));
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -1201,7 +1718,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
         if (FUnrealMCPCommonUtils::SetObjectProperty(DefaultObject, PropertyName, JsonValue, ErrorMessage))
         {
             // Mark the blueprint as modified
-            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+            FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
 
             TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
             ResultObj->SetStringField(TEXT("property"), PropertyName);
@@ -1259,15 +1776,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperti
 
 
     // Find the component
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
+    USCS_Node* ComponentNode = FUnrealMCPComponentIndex::Get().FindNode(Blueprint, FName(*ComponentName));
 
     if (!ComponentNode)
     {
@@ -1302,7 +1811,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperti
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -1444,7 +1953,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPawnProperties(con
     // Mark the blueprint as modified if any properties were set
     if (bAnyPropertiesSet)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
     }
     else if (ResultsObj->Values.Num() == 0)
     {
@@ -1569,8 +2078,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'component_name' parameter"));
     }
 
+    // property_name may be omitted with non_default_only to get every property that differs from the archetype
     FString PropertyName;
-    if (!Params->TryGetStringField(TEXT("property_name"), PropertyName))
+    bool bNonDefaultOnly = false;
+    Params->TryGetBoolField(TEXT("non_default_only"), bNonDefaultOnly);
+    if (!Params->TryGetStringField(TEXT("property_name"), PropertyName) && !bNonDefaultOnly)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_name' parameter"));
     }
@@ -1604,15 +2116,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid blueprint construction script"));
     }
 
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
+    USCS_Node* ComponentNode = FUnrealMCPComponentIndex::Get().FindNode(Blueprint, FName(*ComponentName));
 
     if (!ComponentNode || !ComponentNode->ComponentTemplate)
     {
@@ -1620,6 +2124,16 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetComponentProperty(
     }
 
     UObject* Template = ComponentNode->ComponentTemplate;
+    if (PropertyName.IsEmpty())
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("component_name"), ComponentName);
+        ResultObj->SetStringField(TEXT("component_class"), Template->GetClass()->GetPathName());
+        FUnrealMCPCommonUtils::AddNonDefaultProperties(Template, Params, ResultObj);
+        FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+        return ResultObj;
+    }
+
     TSharedPtr<FJsonValue> Value;
     FString Err;
     FString CppType;
@@ -1637,6 +2151,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetComponentProperty(
     ResultObj->SetStringField(TEXT("property_cpp_type"), CppType);
     ResultObj->SetStringField(TEXT("property_export_text"), ExportText);
     ResultObj->SetField(TEXT("property_value"), Value);
+    if (bNonDefaultOnly)
+    {
+        ResultObj->SetBoolField(TEXT("property_is_default"), FUnrealMCPPropertyPath::Get().IsIdentical(Template, Template->GetArchetype(), PropertyName));
+    }
 
     ResultObj->SetStringField(TEXT("resolved_asset_path"), ResolvedPath);
     FString ObjectPath;
@@ -1663,7 +2181,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintProperty(
     }
 
     FString PropertyName;
-    if (!Params->TryGetStringField(TEXT("property_name"), PropertyName))
+    bool bNonDefaultOnly = false;
+    Params->TryGetBoolField(TEXT("non_default_only"), bNonDefaultOnly);
+    if (!Params->TryGetStringField(TEXT("property_name"), PropertyName) && !bNonDefaultOnly)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_name' parameter"));
     }
@@ -1703,6 +2223,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get default object"));
     }
 
+    if (PropertyName.IsEmpty())
+    {
+        // Baseline is the parent class defaults, i.e. what this Blueprint overrides
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        FUnrealMCPCommonUtils::AddNonDefaultProperties(DefaultObject, Params, ResultObj);
+        FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+        return ResultObj;
+    }
+
     TSharedPtr<FJsonValue> Value;
     FString Err;
     FString CppType;
@@ -1718,6 +2247,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintProperty(
     ResultObj->SetStringField(TEXT("property_cpp_type"), CppType);
     ResultObj->SetStringField(TEXT("property_export_text"), ExportText);
     ResultObj->SetField(TEXT("property_value"), Value);
+    if (bNonDefaultOnly)
+    {
+        ResultObj->SetBoolField(TEXT("property_is_default"), FUnrealMCPPropertyPath::Get().IsIdentical(DefaultObject, DefaultObject->GetArchetype(), PropertyName));
+    }
 
     ResultObj->SetStringField(TEXT("resolved_asset_path"), ResolvedPath);
     FString ObjectPath;
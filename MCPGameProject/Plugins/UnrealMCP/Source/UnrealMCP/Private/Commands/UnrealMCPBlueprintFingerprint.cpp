@@ -0,0 +1,247 @@
+#include "Commands/UnrealMCPBlueprintFingerprint.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Hash/xxhash.h"
+
+namespace UnrealMcpBlueprintFingerprint
+{
+	/** Feeds length-prefixed strings so "ab"+"c" and "a"+"bc" hash differently. */
+	struct FHasher
+	{
+		FXxHash64Builder Builder;
+
+		void Add(const FString& Value)
+		{
+			const int32 Len = Value.Len();
+			Builder.Update(&Len, sizeof(Len));
+			Builder.Update(*Value, Len * sizeof(TCHAR));
+		}
+
+		void Add(const FName& Value)
+		{
+			Add(Value.ToString());
+		}
+
+		void Add(int64 Value)
+		{
+			Builder.Update(&Value, sizeof(Value));
+		}
+
+		void Add(const UObject* Object)
+		{
+			Add(Object ? Object->GetPathName() : FString());
+		}
+	};
+
+	static void HashPinType(FHasher& Hasher, const FEdGraphPinType& PinType)
+	{
+		Hasher.Add(PinType.PinCategory);
+		Hasher.Add(PinType.PinSubCategory);
+		Hasher.Add(PinType.PinSubCategoryObject.Get());
+		Hasher.Add(static_cast<int64>(PinType.ContainerType));
+		Hasher.Add(static_cast<int64>(PinType.bIsReference));
+		Hasher.Add(static_cast<int64>(PinType.bIsConst));
+	}
+
+	/**
+	 * Nodes, pins, defaults and links of one graph. Compile fingerprints hash node titles (they change with the
+	 * referenced member's signature) and skip layout; export fingerprints skip the slow titles and hash layout,
+	 * since exports carry positions and comments.
+	 */
+	static void HashGraph(FHasher& Hasher, const UEdGraph* Graph, bool bIncludeTitles, bool bIncludeLayout)
+	{
+		Hasher.Add(Graph->GetFName());
+		Hasher.Add(static_cast<int64>(Graph->Nodes.Num()));
+
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+			Hasher.Add(Node->GetClass());
+			Hasher.Add(Node->NodeGuid.ToString());
+			if (bIncludeTitles)
+			{
+				Hasher.Add(Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+			}
+			if (bIncludeLayout)
+			{
+				Hasher.Add(static_cast<int64>(Node->NodePosX));
+				Hasher.Add(static_cast<int64>(Node->NodePosY));
+				Hasher.Add(Node->NodeComment);
+			}
+			Hasher.Add(static_cast<int64>(Node->GetDesiredEnabledState()));
+
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				if (!Pin)
+				{
+					continue;
+				}
+				Hasher.Add(Pin->PinName);
+				Hasher.Add(static_cast<int64>(Pin->Direction));
+				HashPinType(Hasher, Pin->PinType);
+				Hasher.Add(Pin->DefaultValue);
+				Hasher.Add(Pin->DefaultObject.Get());
+				Hasher.Add(Pin->DefaultTextValue.ToString());
+				for (const UEdGraphPin* Linked : Pin->LinkedTo)
+				{
+					if (Linked && Linked->GetOwningNodeUnchecked())
+					{
+						Hasher.Add(Linked->GetOwningNodeUnchecked()->NodeGuid.ToString());
+						Hasher.Add(Linked->PinName);
+					}
+				}
+			}
+		}
+	}
+
+	static void HashObjectDeltas(FHasher& Hasher, const UObject* Object, const UObject* Baseline)
+	{
+		if (!Object)
+		{
+			return;
+		}
+
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+			{
+				continue;
+			}
+
+			const bool bHasBaseline = Baseline && Baseline->GetClass()->IsChildOf(Property->GetOwnerClass());
+			if (bHasBaseline && Property->Identical_InContainer(Object, Baseline))
+			{
+				continue;
+			}
+
+			FString Value;
+			Property->ExportText_InContainer(0, Value, Object, bHasBaseline ? Baseline : nullptr, nullptr, PPF_None);
+			Hasher.Add(Property->GetFName());
+			Hasher.Add(Value);
+		}
+	}
+}
+
+FUnrealMCPBlueprintFingerprint& FUnrealMCPBlueprintFingerprint::Get()
+{
+	static FUnrealMCPBlueprintFingerprint Instance;
+	return Instance;
+}
+
+FString FUnrealMCPBlueprintFingerprint::Compute(const UBlueprint* Blueprint)
+{
+	using namespace UnrealMcpBlueprintFingerprint;
+
+	if (!Blueprint)
+	{
+		return FString();
+	}
+
+	FHasher Hasher;
+	Hasher.Add(Blueprint->ParentClass.Get());
+
+	// Member variables
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		Hasher.Add(Variable.VarName);
+		Hasher.Add(Variable.VarGuid.ToString());
+		HashPinType(Hasher, Variable.VarType);
+		Hasher.Add(Variable.DefaultValue);
+		Hasher.Add(static_cast<int64>(Variable.PropertyFlags));
+	}
+
+	// Components
+	if (Blueprint->SimpleConstructionScript)
+	{
+		for (const USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+		{
+			if (!Node)
+			{
+				continue;
+			}
+			Hasher.Add(Node->GetVariableName());
+			Hasher.Add(Node->ComponentClass.Get());
+			Hasher.Add(Node->ParentComponentOrVariableName);
+			Hasher.Add(Node->AttachToName);
+			for (const USCS_Node* Child : Node->GetChildNodes())
+			{
+				Hasher.Add(Child ? Child->GetVariableName() : NAME_None);
+			}
+			if (Node->ComponentTemplate)
+			{
+				HashObjectDeltas(Hasher, Node->ComponentTemplate, Node->ComponentTemplate->GetClass()->GetDefaultObject());
+			}
+		}
+	}
+
+	// Graphs, nodes, pins and links (positions and comments are cosmetic and skipped)
+	TArray<UEdGraph*> Graphs;
+	Blueprint->GetAllGraphs(Graphs);
+	for (const UEdGraph* Graph : Graphs)
+	{
+		if (Graph)
+		{
+			HashGraph(Hasher, Graph, true, false);
+		}
+	}
+
+	// Class defaults that differ from the parent class
+	if (Blueprint->GeneratedClass && Blueprint->ParentClass)
+	{
+		HashObjectDeltas(Hasher, Blueprint->GeneratedClass->GetDefaultObject(false), Blueprint->ParentClass->GetDefaultObject(false));
+	}
+
+	return FString::Printf(TEXT("%016llx"), Hasher.Builder.Finalize().Hash);
+}
+
+FString FUnrealMCPBlueprintFingerprint::ComputeGraph(const UEdGraph* Graph)
+{
+	using namespace UnrealMcpBlueprintFingerprint;
+
+	if (!Graph)
+	{
+		return FString();
+	}
+
+	FHasher Hasher;
+	HashGraph(Hasher, Graph, false, true);
+	return FString::Printf(TEXT("%016llx"), Hasher.Builder.Finalize().Hash);
+}
+
+bool FUnrealMCPBlueprintFingerprint::IsCompileUpToDate(const UBlueprint* Blueprint, const FString& Fingerprint) const
+{
+	if (!Blueprint || !Blueprint->GeneratedClass || Fingerprint.IsEmpty())
+	{
+		return false;
+	}
+	if (Blueprint->Status != BS_UpToDate && Blueprint->Status != BS_UpToDateWithWarnings)
+	{
+		return false;
+	}
+
+	const FString* Last = LastCompiled.Find(Blueprint->GetPathName());
+	return Last && *Last == Fingerprint;
+}
+
+void FUnrealMCPBlueprintFingerprint::RecordCompile(const UBlueprint* Blueprint, const FString& Fingerprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	if (Blueprint->Status == BS_Error || Fingerprint.IsEmpty())
+	{
+		LastCompiled.Remove(Blueprint->GetPathName());
+		return;
+	}
+	LastCompiled.Add(Blueprint->GetPathName(), Fingerprint);
+}
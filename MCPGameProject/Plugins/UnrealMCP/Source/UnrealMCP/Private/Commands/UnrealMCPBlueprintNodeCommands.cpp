@@ -1,5 +1,12 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPBlueprintFingerprint.h"
+#include "Commands/UnrealMCPBlueprintNodeIndex.h"
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPGraphSearchIndex.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -12,17 +19,131 @@
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
+#include "K2Node_Variable.h"
+#include "K2Node_MacroInstance.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "GameFramework/InputSettings.h"
 #include "Camera/CameraActor.h"
 #include "Kismet/GameplayStatics.h"
 #include "EdGraphSchema_K2.h"
-#include "ScopedTransaction.h"
+#include "Hash/xxhash.h"
 
 // Declare the log category
 DEFINE_LOG_CATEGORY_STATIC(LogUnrealMCP, Log, All);
 
+namespace UnrealMcpFunctionLookup
+{
+    /**
+     * Resolve a callable function for a call node. With a target, the target class (native name, optional
+     * "Component" suffix, or a Blueprint class path) is searched including inherited functions. Without one,
+     * the Blueprint's own class is tried first, then static functions and members of the Blueprint's hierarchy
+     * in every indexed native class; ambiguous matches fail with the candidate list in OutDetails.
+     */
+    static UFunction* ResolveCallableFunction(UBlueprint* Blueprint, const FString& FunctionName, const FString& Target, FString& OutError, FString& OutDetails)
+    {
+        FUnrealMCPFunctionIndex& Index = FUnrealMCPFunctionIndex::Get();
+        FUnrealMCPClassIndex& Classes = FUnrealMCPClassIndex::Get();
+
+        UClass* TargetClass = nullptr;
+        if (!Target.IsEmpty())
+        {
+            // "Mesh" may name a class or be shorthand for UMeshComponent; take the first that declares the function
+            UClass* const ClassGuesses[] = { Classes.FindClass(Target), Classes.FindClass(Target + TEXT("Component")) };
+            for (UClass* Guess : ClassGuesses)
+            {
+                if (Guess && !TargetClass)
+                {
+                    TargetClass = Guess;
+                }
+                if (Guess && Guess->FindFunctionByName(*FunctionName))
+                {
+                    TargetClass = Guess;
+                    break;
+                }
+            }
+            if (!TargetClass)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Target class '%s' not found; searching the Blueprint and all classes"), *Target);
+            }
+        }
+
+        // Functions declared on a Blueprint class are not in the native index
+        UClass* OwnClass = TargetClass ? TargetClass : Blueprint->GeneratedClass.Get();
+        if (OwnClass)
+        {
+            if (UFunction* Function = OwnClass->FindFunctionByName(*FunctionName))
+            {
+                return Function;
+            }
+        }
+
+        TArray<const FUnrealMCPFunctionIndex::FCandidate*> Candidates;
+        Index.FindFunctions(FunctionName, OwnClass, Candidates);
+        if (Candidates.Num() == 0 && !TargetClass)
+        {
+            Index.FindFunctions(FunctionName, nullptr, Candidates);
+
+            // Without a target only static library functions and members of the Blueprint's own hierarchy
+            // have something for the Target pin; anything else would compile to a call on nothing
+            const UClass* SelfClass = Blueprint->GeneratedClass ? Blueprint->GeneratedClass.Get() : Blueprint->ParentClass.Get();
+            TArray<FString> MemberOwners;
+            Candidates.RemoveAll([SelfClass, &MemberOwners](const FUnrealMCPFunctionIndex::FCandidate* Candidate)
+            {
+                const UClass* OwnerClass = Candidate->OwnerClass.Get();
+                if (Candidate->bStatic || (SelfClass && OwnerClass && SelfClass->IsChildOf(OwnerClass)))
+                {
+                    return false;
+                }
+                MemberOwners.AddUnique(OwnerClass ? OwnerClass->GetName() : TEXT("?"));
+                return true;
+            });
+            if (Candidates.Num() == 0 && MemberOwners.Num() > 0)
+            {
+                OutError = FString::Printf(TEXT("Function '%s' is a member of %s, outside this Blueprint's class hierarchy; pass 'target'"),
+                    *FunctionName, *FString::Join(MemberOwners, TEXT(", ")));
+                return nullptr;
+            }
+        }
+
+        if (Candidates.Num() == 1)
+        {
+            return Candidates[0]->Function.Get();
+        }
+
+        if (Candidates.Num() == 0)
+        {
+            OutError = FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
+            return nullptr;
+        }
+
+        // Prefer an exact (case-sensitive) name match over display-name and case-folded hits
+        const FUnrealMCPFunctionIndex::FCandidate* Exact = nullptr;
+        int32 ExactCount = 0;
+        for (const FUnrealMCPFunctionIndex::FCandidate* Candidate : Candidates)
+        {
+            if (Candidate->Name.Equals(FunctionName, ESearchCase::CaseSensitive))
+            {
+                Exact = Candidate;
+                ++ExactCount;
+            }
+        }
+        if (ExactCount == 1)
+        {
+            return Exact->Function.Get();
+        }
+
+        OutError = FString::Printf(TEXT("Function '%s' is ambiguous; pass 'target'"), *FunctionName);
+        OutDetails = TEXT("Candidates:\n");
+        for (const FUnrealMCPFunctionIndex::FCandidate* Candidate : Candidates)
+        {
+            const UClass* OwnerClass = Candidate->OwnerClass.Get();
+            OutDetails += FString::Printf(TEXT("- %s::%s\n"), OwnerClass ? *OwnerClass->GetName() : TEXT("?"), *Candidate->Name);
+        }
+        return nullptr;
+    }
+}
+
 FUnrealMCPBlueprintNodeCommands::FUnrealMCPBlueprintNodeCommands()
 {
 }
@@ -61,6 +182,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FSt
     {
         return HandleFindBlueprintNodes(Params);
     }
+    else if (CommandType == TEXT("apply_blueprint_graph_patch"))
+    {
+        return HandleApplyBlueprintGraphPatch(Params);
+    }
+    else if (CommandType == TEXT("search_blueprint_functions"))
+    {
+        return HandleSearchBlueprintFunctions(Params);
+    }
     // Construction Script graph operations
     else if (CommandType == TEXT("get_construction_script_graph"))
     {
@@ -70,6 +199,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FSt
     {
         return HandleAddConstructionScriptNode(Params);
     }
+    else if (CommandType == TEXT("export_blueprint_graph"))
+    {
+        return HandleExportBlueprintGraph(Params);
+    }
+    else if (CommandType == TEXT("search_blueprint_graphs"))
+    {
+        return HandleSearchBlueprintGraphs(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint node command: %s"), *CommandType));
 }
@@ -138,50 +275,42 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
         FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(ResolvedPath, ObjectPath, PathErr);
     }
 
-    // Get the event graph
-    UEdGraph* EventGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
-    }
+    // Find the nodes in any graph (event, function, macro, construction script) via the cached GUID index
+    UEdGraphNode* SourceNode = FUnrealMCPBlueprintNodeIndex::Get().FindNode(Blueprint, SourceNodeId);
+    UEdGraphNode* TargetNode = FUnrealMCPBlueprintNodeIndex::Get().FindNode(Blueprint, TargetNodeId);
 
-    // Find the nodes
-    UEdGraphNode* SourceNode = nullptr;
-    UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (!SourceNode || !TargetNode)
     {
-        if (Node->NodeGuid.ToString() == SourceNodeId)
-        {
-            SourceNode = Node;
-        }
-        else if (Node->NodeGuid.ToString() == TargetNodeId)
-        {
-            TargetNode = Node;
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Source or target node not found"));
     }
 
-    if (!SourceNode || !TargetNode)
+    UEdGraph* Graph = SourceNode->GetGraph();
+    if (Graph != TargetNode->GetGraph())
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Source or target node not found"));
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            TEXT("Source and target nodes are in different graphs"),
+            TEXT("ERR_BAD_REQUEST"),
+            FString::Printf(TEXT("source graph: %s, target graph: %s"), *Graph->GetName(), *TargetNode->GetGraph()->GetName()));
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Connect Blueprint Nodes")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Connect Blueprint Nodes")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(Graph);
     SourceNode->Modify();
     TargetNode->Modify();
 
     // Connect the nodes
-    if (FUnrealMCPCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName))
+    if (FUnrealMCPCommonUtils::ConnectGraphNodes(Graph, SourceNode, SourcePinName, TargetNode, TargetPinName))
     {
-        // Graph wiring is structural.
-        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        // Graph wiring is structural (skeleton refresh runs once at the end of the request).
+        FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
         Blueprint->MarkPackageDirty();
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("source_node_id"), SourceNodeId);
         ResultObj->SetStringField(TEXT("target_node_id"), TargetNodeId);
+        ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
         ResultObj->SetStringField(TEXT("resolved_asset_path"), ResolvedPath);
         if (!ObjectPath.IsEmpty())
         {
@@ -254,9 +383,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add GetSelf Component Reference")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add GetSelf Component Reference")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(EventGraph);
 
     // We'll skip component verification since the GetAllNodes API may have changed in UE5.5
 
@@ -287,7 +416,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     GetComponentNode->ReconstructNode();
 
     // Graph/node insertion is structural.
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -361,9 +490,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Event Node")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Event Node")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(EventGraph);
 
     // Create the event node
     UK2Node_Event* EventNode = FUnrealMCPCommonUtils::CreateEventNode(EventGraph, EventName, NodePosition);
@@ -375,7 +504,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
     EventNode->Modify();
 
     // Node insertion is structural.
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -453,165 +582,23 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Function Call")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Function Call")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(EventGraph);
 
-    // Find the function
-    UFunction* Function = nullptr;
-    UK2Node_CallFunction* FunctionNode = nullptr;
-    
-    // Add extensive logging for debugging
-    UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in target '%s'"), 
-           *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
-    
-    // Check if we have a target class specified
-    if (!Target.IsEmpty())
-    {
-        // Try to find the target class
-        UClass* TargetClass = nullptr;
-        
-        // First try without a prefix
-        TargetClass = FindObject<UClass>(ANY_PACKAGE, *Target);
-        UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-               *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        
-        // If not found, try with U prefix (common convention for UE classes)
-        if (!TargetClass && !Target.StartsWith(TEXT("U")))
-        {
-            FString TargetWithPrefix = FString(TEXT("U")) + Target;
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, *TargetWithPrefix);
-            UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-                   *TargetWithPrefix, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-        
-        // If still not found, try with common component names
-        if (!TargetClass)
-        {
-            // Try some common component class names
-            TArray<FString> PossibleClassNames;
-            PossibleClassNames.Add(FString(TEXT("U")) + Target + TEXT("Component"));
-            PossibleClassNames.Add(Target + TEXT("Component"));
-            
-            for (const FString& ClassName : PossibleClassNames)
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-                if (TargetClass)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Found class using alternative name '%s'"), *ClassName);
-                    break;
-                }
-            }
-        }
-        
-        // Special case handling for common classes like UGameplayStatics
-        if (!TargetClass && Target == TEXT("UGameplayStatics"))
-        {
-            // For UGameplayStatics, use a direct reference to known class
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, TEXT("UGameplayStatics"));
-            if (!TargetClass)
-            {
-                // Try loading it from its known package
-                TargetClass = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-                UE_LOG(LogTemp, Display, TEXT("Explicitly loading GameplayStatics: %s"), 
-                       TargetClass ? TEXT("Success") : TEXT("Failed"));
-            }
-        }
-        
-        // If we found a target class, look for the function there
-        if (TargetClass)
-        {
-            UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in class '%s'"), 
-                   *FunctionName, *TargetClass->GetName());
-                   
-            // First try exact name
-            Function = TargetClass->FindFunctionByName(*FunctionName);
-            
-            // If not found, try class hierarchy
-            UClass* CurrentClass = TargetClass;
-            while (!Function && CurrentClass)
-            {
-                UE_LOG(LogTemp, Display, TEXT("Searching in class: %s"), *CurrentClass->GetName());
-                
-                // Try exact match
-                Function = CurrentClass->FindFunctionByName(*FunctionName);
-                
-                // Try case-insensitive match
-                if (!Function)
-                {
-                    for (TFieldIterator<UFunction> FuncIt(CurrentClass); FuncIt; ++FuncIt)
-                    {
-                        UFunction* AvailableFunc = *FuncIt;
-                        UE_LOG(LogTemp, Display, TEXT("  - Available function: %s"), *AvailableFunc->GetName());
-                        
-                        if (AvailableFunc->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive match: %s"), *AvailableFunc->GetName());
-                            Function = AvailableFunc;
-                            break;
-                        }
-                    }
-                }
-                
-                // Move to parent class
-                CurrentClass = CurrentClass->GetSuperClass();
-            }
-            
-            // Special handling for known functions
-            if (!Function)
-            {
-                if (TargetClass->GetName() == TEXT("GameplayStatics") && 
-                    (FunctionName == TEXT("GetActorOfClass") || FunctionName.Equals(TEXT("GetActorOfClass"), ESearchCase::IgnoreCase)))
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Using special case handling for GameplayStatics::GetActorOfClass"));
-                    
-                    // Create the function node directly
-                    FunctionNode = NewObject<UK2Node_CallFunction>(EventGraph);
-                    if (FunctionNode)
-                    {
-                        // Direct setup for known function
-                        FunctionNode->FunctionReference.SetExternalMember(
-                            FName(TEXT("GetActorOfClass")), 
-                            TargetClass
-                        );
-                        
-                        FunctionNode->NodePosX = NodePosition.X;
-                        FunctionNode->NodePosY = NodePosition.Y;
-                        EventGraph->AddNode(FunctionNode);
-                        FunctionNode->CreateNewGuid();
-                        FunctionNode->PostPlacedNewNode();
-                        FunctionNode->AllocateDefaultPins();
-                        
-                        UE_LOG(LogTemp, Display, TEXT("Created GetActorOfClass node directly"));
-                        
-                        // List all pins
-                        for (UEdGraphPin* Pin : FunctionNode->Pins)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Pin: %s, Direction: %d, Category: %s"), 
-                                   *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
-                        }
-                    }
-                }
-            }
-        }
-    }
-    
-    // If we still haven't found the function, try in the blueprint's class
-    if (!Function && !FunctionNode)
-    {
-        UE_LOG(LogTemp, Display, TEXT("Trying to find function in blueprint class"));
-        Function = Blueprint->GeneratedClass->FindFunctionByName(*FunctionName);
-    }
-    
-    // Create the function call node if we found the function
-    if (Function && !FunctionNode)
+    // Resolve the function through the callable-function index
+    FString LookupError;
+    FString LookupDetails;
+    UFunction* Function = UnrealMcpFunctionLookup::ResolveCallableFunction(Blueprint, FunctionName, Target, LookupError, LookupDetails);
+    if (!Function)
     {
-        FunctionNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(LookupError, LookupDetails.IsEmpty() ? TEXT("ERR_FUNCTION_NOT_FOUND") : TEXT("ERR_AMBIGUOUS_FUNCTION"), LookupDetails);
     }
-    
+
+    UK2Node_CallFunction* FunctionNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
     if (!FunctionNode)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to create call node for %s"), *FunctionName));
     }
 
     // Set parameters if provided
@@ -649,32 +636,29 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
                         // Handle class reference parameters (e.g., ActorClass in GetActorOfClass)
                         if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Class)
                         {
-                            // For class references, we require the exact class name with proper prefix
-                            // - Actor classes must start with 'A' (e.g., ACameraActor)
-                            // - Non-actor classes must start with 'U' (e.g., UObject)
+                            // Class name with or without its A/U prefix, Blueprint name, or class path;
+                            // only classes the pin accepts (its meta class) are considered
                             const FString& ClassName = StringVal;
-                            
-                            // TODO: This likely won't work in UE5.5+, so don't rely on it.
-                            UClass* Class = FindObject<UClass>(ANY_PACKAGE, *ClassName);
+                            const UClass* MetaClass = Cast<UClass>(ParamPin->PinType.PinSubCategoryObject.Get());
 
+                            TArray<FString> ClassCandidates;
+                            UClass* Class = FUnrealMCPClassIndex::Get().FindClass(ClassName, MetaClass, &ClassCandidates);
                             if (!Class)
                             {
-                                Class = LoadObject<UClass>(nullptr, *ClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("FindObject<UClass> failed. Assuming soft path  path: %s"), *ClassName);
-                            }
-                            
-                            // If not found, try with Engine module path
-                            if (!Class)
-                            {
-                                FString EngineClassName = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-                                Class = LoadObject<UClass>(nullptr, *EngineClassName);
-                                UE_LOG(LogUnrealMCP, Display, TEXT("Trying Engine module path: %s"), *EngineClassName);
-                            }
-                            
-                            if (!Class)
-                            {
-                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s'. Make sure to use the exact class name with proper prefix (A for actors, U for non-actors)"), *ClassName);
-                                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find class '%s'"), *ClassName));
+                                UE_LOG(LogUnrealMCP, Error, TEXT("Failed to find class '%s' (%d candidates)"), *ClassName, ClassCandidates.Num());
+                                FString Details;
+                                if (ClassCandidates.Num() > 1)
+                                {
+                                    Details = TEXT("Multiple classes matched by name. Please pass the class path. Candidates:\n");
+                                    for (const FString& C : ClassCandidates)
+                                    {
+                                        Details += TEXT("- ") + C + TEXT("\n");
+                                    }
+                                }
+                                return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                                    FString::Printf(TEXT("Class '%s' for parameter '%s' not found or ambiguous"), *ClassName, *ParamName),
+                                    TEXT("ERR_BAD_REQUEST"),
+                                    Details);
                             }
 
                             const UEdGraphSchema_K2* K2Schema = Cast<const UEdGraphSchema_K2>(EventGraph->GetSchema());
@@ -821,7 +805,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     }
 
     // Node insertion is structural.
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -894,8 +878,8 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Variable")));
-    Blueprint->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Variable")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
 
     // Create variable based on type
     FEdGraphPinType PinType;
@@ -1026,9 +1010,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Input Action Node")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Input Action Node")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(EventGraph);
 
     // Create the input action node
     UK2Node_InputAction* InputActionNode = FUnrealMCPCommonUtils::CreateInputActionNode(EventGraph, ActionName, NodePosition);
@@ -1040,7 +1024,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
     InputActionNode->Modify();
 
     // Node insertion is structural.
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1108,9 +1092,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Self Reference Node")));
-    Blueprint->Modify();
-    EventGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Blueprint Self Reference Node")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(EventGraph);
 
     // Create the self node
     UK2Node_Self* SelfNode = FUnrealMCPCommonUtils::CreateSelfReferenceNode(EventGraph, NodePosition);
@@ -1122,7 +1106,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     SelfNode->Modify();
 
     // Node insertion is structural.
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1157,18 +1141,25 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
 
-    // Get the event graph
-    UEdGraph* EventGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
-    }
-
     // Create a JSON array for the node GUIDs
     TArray<TSharedPtr<FJsonValue>> NodeGuidArray;
     
     // Filter nodes by the exact requested type
-    if (NodeType == TEXT("Event"))
+    if (NodeType == TEXT("Guid"))
+    {
+        FString NodeId;
+        if (!Params->TryGetStringField(TEXT("node_id"), NodeId))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'node_id' parameter for Guid node search"));
+        }
+
+        // O(1) through the cached index; searches every graph
+        if (UEdGraphNode* Node = FUnrealMCPBlueprintNodeIndex::Get().FindNode(Blueprint, NodeId))
+        {
+            NodeGuidArray.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+        }
+    }
+    else if (NodeType == TEXT("Event"))
     {
         FString EventName;
         if (!Params->TryGetStringField(TEXT("event_name"), EventName))
@@ -1176,14 +1167,22 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
             return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'event_name' parameter for Event node search"));
         }
         
-        // Look for nodes with exact event name (e.g., ReceiveBeginPlay)
-        for (UEdGraphNode* Node : EventGraph->Nodes)
+        // Look for nodes with exact event name (e.g., ReceiveBeginPlay) on every event graph page
+        const FName EventFName(*EventName);
+        for (UEdGraph* Graph : Blueprint->UbergraphPages)
         {
-            UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-            if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+            if (!Graph)
+            {
+                continue;
+            }
+            for (UEdGraphNode* Node : Graph->Nodes)
             {
-                UE_LOG(LogTemp, Display, TEXT("Found event node with name %s: %s"), *EventName, *EventNode->NodeGuid.ToString());
-                NodeGuidArray.Add(MakeShared<FJsonValueString>(EventNode->NodeGuid.ToString()));
+                UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+                if (EventNode && EventNode->EventReference.GetMemberName() == EventFName)
+                {
+                    UE_LOG(LogTemp, Display, TEXT("Found event node with name %s: %s"), *EventName, *EventNode->NodeGuid.ToString());
+                    NodeGuidArray.Add(MakeShared<FJsonValueString>(EventNode->NodeGuid.ToString()));
+                }
             }
         }
     }
@@ -1192,6 +1191,14 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("node_guids"), NodeGuidArray);
 
+    // Opt-in: the structural fingerprint walks every graph, which costs far more than the lookup itself.
+    bool bIncludeFingerprint = false;
+    Params->TryGetBoolField(TEXT("include_fingerprint"), bIncludeFingerprint);
+    if (bIncludeFingerprint)
+    {
+        ResultObj->SetStringField(TEXT("fingerprint"), FUnrealMCPBlueprintFingerprint::Compute(Blueprint));
+    }
+
     FUnrealMCPCommonUtils::AddResolvedAssetFieldsFromUObject(ResultObj, Blueprint);
 
     return ResultObj;
@@ -1384,9 +1391,9 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddConstructionSc
     }
 
     // Transaction + Modify for stable Undo/Redo
-    const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Construction Script Node")));
-    Blueprint->Modify();
-    ConstructionScriptGraph->Modify();
+    const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Construction Script Node")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(ConstructionScriptGraph);
 
     UEdGraphNode* NewNode = nullptr;
 
@@ -1404,18 +1411,10 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddConstructionSc
         if (!Target.IsEmpty())
         {
             // Try to find the target class
-            TargetClass = FindObject<UClass>(ANY_PACKAGE, *Target);
-            if (!TargetClass && !Target.StartsWith(TEXT("U")))
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *(TEXT("U") + Target));
-            }
+            TargetClass = FUnrealMCPClassIndex::Get().FindClass(Target);
             if (!TargetClass)
             {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *(Target + TEXT("Component")));
-            }
-            if (!TargetClass)
-            {
-                TargetClass = FindObject<UClass>(ANY_PACKAGE, *(TEXT("U") + Target + TEXT("Component")));
+                TargetClass = FUnrealMCPClassIndex::Get().FindClass(Target + TEXT("Component"));
             }
 
             if (TargetClass)
@@ -1561,8 +1560,8 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddConstructionSc
     NewNode->SetFlags(RF_Transactional);
     NewNode->Modify();
 
-    // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    // Node insertion is structural.
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
     Blueprint->MarkPackageDirty();
 
     // Build result
@@ -1593,4 +1592,936 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddConstructionSc
     UE_LOG(LogTemp, Log, TEXT("Added %s node to Construction Script of blueprint: %s"), *NodeType, *BlueprintName);
 
     return ResultObj;
-} 
\ No newline at end of file
+} 
+namespace UnrealMcpGraphPatch
+{
+    static bool ApplyPinDefault(UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+    {
+        const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+        const FName Category = Pin->PinType.PinCategory;
+
+        if (Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_Object ||
+            Category == UEdGraphSchema_K2::PC_SoftClass || Category == UEdGraphSchema_K2::PC_SoftObject)
+        {
+            const FString ObjectName = Value->AsString();
+            if (ObjectName.IsEmpty())
+            {
+                K2Schema->TrySetDefaultObject(*Pin, nullptr);
+                return true;
+            }
+
+            // Class pins: the pin's meta class (or object class) limits which classes match
+            const UClass* PinClass = Cast<UClass>(Pin->PinType.PinSubCategoryObject.Get());
+            UObject* Object = nullptr;
+            if (Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_SoftClass)
+            {
+                TArray<FString> Candidates;
+                Object = FUnrealMCPClassIndex::Get().FindClass(ObjectName, PinClass, &Candidates);
+                if (!Object)
+                {
+                    OutError = FString::Printf(TEXT("Class '%s' for pin '%s' not found or ambiguous"), *ObjectName, *Pin->PinName.ToString());
+                    if (Candidates.Num() > 1)
+                    {
+                        OutError += TEXT(". Pass the class path. Candidates: ") + FString::Join(Candidates, TEXT(", "));
+                    }
+                    return false;
+                }
+            }
+            else
+            {
+                Object = FUnrealMCPCommonUtils::LoadAssetByPathSmart(ObjectName);
+                if (!Object)
+                {
+                    OutError = FString::Printf(TEXT("Asset '%s' for pin '%s' not found; pass its content path"), *ObjectName, *Pin->PinName.ToString());
+                    return false;
+                }
+                if (PinClass && !Object->IsA(PinClass))
+                {
+                    OutError = FString::Printf(TEXT("Asset '%s' is a %s; pin '%s' expects %s"),
+                        *ObjectName, *Object->GetClass()->GetName(), *Pin->PinName.ToString(), *PinClass->GetName());
+                    return false;
+                }
+            }
+
+            K2Schema->TrySetDefaultObject(*Pin, Object);
+            return true;
+        }
+
+        if (Category == UEdGraphSchema_K2::PC_Text)
+        {
+            K2Schema->TrySetDefaultText(*Pin, FText::FromString(Value->AsString()));
+            return true;
+        }
+
+        FString DefaultValue;
+        switch (Value->Type)
+        {
+        case EJson::Boolean:
+            DefaultValue = Value->AsBool() ? TEXT("true") : TEXT("false");
+            break;
+        case EJson::Number:
+            DefaultValue = (Category == UEdGraphSchema_K2::PC_Int || Category == UEdGraphSchema_K2::PC_Int64 || Category == UEdGraphSchema_K2::PC_Byte)
+                ? FString::Printf(TEXT("%lld"), static_cast<int64>(FMath::RoundToDouble(Value->AsNumber())))
+                : FString::SanitizeFloat(Value->AsNumber());
+            break;
+        case EJson::Array:
+        {
+            // [X, Y, Z] for vectors, [Pitch, Yaw, Roll] for rotators
+            const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+            if (Array.Num() != 3 || Category != UEdGraphSchema_K2::PC_Struct)
+            {
+                OutError = FString::Printf(TEXT("Array value not supported for pin '%s'"), *Pin->PinName.ToString());
+                return false;
+            }
+            DefaultValue = FString::Printf(TEXT("%f,%f,%f"), Array[0]->AsNumber(), Array[1]->AsNumber(), Array[2]->AsNumber());
+            break;
+        }
+        default:
+            DefaultValue = Value->AsString();
+            break;
+        }
+
+        const FString ValidationError = K2Schema->IsPinDefaultValid(Pin, DefaultValue, nullptr, FText::GetEmpty());
+        if (!ValidationError.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("Invalid default '%s' for pin '%s': %s"), *DefaultValue, *Pin->PinName.ToString(), *ValidationError);
+            return false;
+        }
+        K2Schema->TrySetDefaultValue(*Pin, DefaultValue);
+        return true;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleApplyBlueprintGraphPatch(const TSharedPtr<FJsonObject>& Params)
+{
+    using namespace UnrealMcpGraphPatch;
+
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    FString BlueprintPath;
+    Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath);
+
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+    Params->TryGetArrayField(TEXT("nodes"), NodesArray);
+
+    const TArray<TSharedPtr<FJsonValue>>* LinksArray = nullptr;
+    Params->TryGetArrayField(TEXT("links"), LinksArray);
+
+    if ((!NodesArray || NodesArray->Num() == 0) && (!LinksArray || LinksArray->Num() == 0))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(TEXT("Patch is empty"), TEXT("ERR_BAD_REQUEST"), TEXT("Pass 'nodes' and/or 'links'"));
+    }
+
+    bool bCompile = false;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    FString ResolvedPath;
+    TArray<FString> Candidates;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::ResolveBlueprintFromNameOrPath(BlueprintName, BlueprintPath, ResolvedPath, Candidates);
+    if (!Blueprint)
+    {
+        FString Details;
+        if (Candidates.Num() > 1)
+        {
+            Details = TEXT("Multiple blueprints matched by name. Please pass blueprint_path. Candidates:\n");
+            for (const FString& C : Candidates)
+            {
+                Details += TEXT("- ") + C + TEXT("\n");
+            }
+        }
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Blueprint '%s' not found or ambiguous"), *BlueprintName),
+            TEXT("ERR_ASSET_NOT_FOUND"),
+            Details);
+    }
+
+    // Resolve the target graph: EventGraph by default, ConstructionScript alias, otherwise any graph by name
+    UEdGraph* Graph = nullptr;
+    if (GraphName.IsEmpty() || GraphName == TEXT("EventGraph"))
+    {
+        Graph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+    }
+    else if (GraphName == TEXT("ConstructionScript"))
+    {
+        Graph = FindConstructionScriptGraph(Blueprint);
+    }
+    else
+    {
+        TArray<UEdGraph*> AllGraphs;
+        Blueprint->GetAllGraphs(AllGraphs);
+        for (UEdGraph* Candidate : AllGraphs)
+        {
+            if (Candidate && Candidate->GetName() == GraphName)
+            {
+                Graph = Candidate;
+                break;
+            }
+        }
+    }
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Graph '%s' not found"), *GraphName),
+            TEXT("ERR_BAD_REQUEST"),
+            TEXT(""));
+    }
+
+    FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Apply Blueprint Graph Patch")));
+    FUnrealMCPBatchTransaction::Get().Modify(Blueprint);
+    FUnrealMCPBatchTransaction::Get().Modify(Graph);
+
+    TMap<FString, UEdGraphNode*> TempIdToNode;
+    TArray<UEdGraphNode*> CreatedNodes;
+    // Links are (output pin, input pin). Broken links are ones that existed before the patch.
+    TArray<TPair<UEdGraphPin*, UEdGraphPin*>> CreatedLinks;
+    TArray<TPair<UEdGraphPin*, UEdGraphPin*>> BrokenLinks;
+
+    // Any failure undoes the partial patch so the graph is left exactly as it was.
+    auto Fail = [&](const FString& Message, const FString& Details) -> TSharedPtr<FJsonObject>
+    {
+        for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : CreatedLinks)
+        {
+            Link.Key->BreakLinkTo(Link.Value);
+        }
+        for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : BrokenLinks)
+        {
+            Link.Key->MakeLinkTo(Link.Value);
+        }
+        for (UEdGraphNode* Node : CreatedNodes)
+        {
+            FBlueprintEditorUtils::RemoveNode(Blueprint, Node, true);
+        }
+        // Inside a batch this is a no-op; the manual revert above is the rollback
+        Transaction.Cancel();
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(Message, TEXT("ERR_BAD_REQUEST"), Details);
+    };
+
+    auto ResolveNodeRef = [&](const FString& Ref) -> UEdGraphNode*
+    {
+        if (UEdGraphNode** Found = TempIdToNode.Find(Ref))
+        {
+            return *Found;
+        }
+        UEdGraphNode* Existing = FUnrealMCPBlueprintNodeIndex::Get().FindNode(Blueprint, Ref);
+        return (Existing && Existing->GetGraph() == Graph) ? Existing : nullptr;
+    };
+
+    // Nodes
+    if (NodesArray)
+    {
+        for (int32 Index = 0; Index < NodesArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject> NodeObj = (*NodesArray)[Index].IsValid() ? (*NodesArray)[Index]->AsObject() : nullptr;
+            const FString Where = FString::Printf(TEXT("nodes[%d]"), Index);
+            if (!NodeObj.IsValid())
+            {
+                return Fail(TEXT("Node entry must be an object"), Where);
+            }
+
+            FString TempId;
+            FString NodeType;
+            if (!NodeObj->TryGetStringField(TEXT("id"), TempId) || !NodeObj->TryGetStringField(TEXT("node_type"), NodeType))
+            {
+                return Fail(TEXT("Node entry requires 'id' and 'node_type'"), Where);
+            }
+            if (TempIdToNode.Contains(TempId))
+            {
+                return Fail(FString::Printf(TEXT("Duplicate node id '%s'"), *TempId), Where);
+            }
+
+            const FVector2D Position = FUnrealMCPCommonUtils::GetVector2DFromJson(NodeObj, TEXT("node_position"));
+            UEdGraphNode* NewNode = nullptr;
+            bool bReusedExisting = false;
+
+            if (NodeType == TEXT("Event"))
+            {
+                FString EventName;
+                NodeObj->TryGetStringField(TEXT("event_name"), EventName);
+                UK2Node_Event* Existing = FUnrealMCPCommonUtils::FindExistingEventNode(Graph, EventName);
+                NewNode = Existing ? Existing : FUnrealMCPCommonUtils::CreateEventNode(Graph, EventName, Position);
+                bReusedExisting = Existing != nullptr;
+            }
+            else if (NodeType == TEXT("FunctionCall"))
+            {
+                FString FunctionName;
+                FString Target;
+                NodeObj->TryGetStringField(TEXT("function_name"), FunctionName);
+                NodeObj->TryGetStringField(TEXT("target"), Target);
+                FString LookupError;
+                FString LookupDetails;
+                UFunction* Function = UnrealMcpFunctionLookup::ResolveCallableFunction(Blueprint, FunctionName, Target, LookupError, LookupDetails);
+                if (!Function)
+                {
+                    return Fail(LookupError, LookupDetails.IsEmpty() ? Where : Where + TEXT("\n") + LookupDetails);
+                }
+                NewNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(Graph, Function, Position);
+            }
+            else if (NodeType == TEXT("VariableGet") || NodeType == TEXT("VariableSet") || NodeType == TEXT("GetComponent"))
+            {
+                FString VariableName;
+                if (!NodeObj->TryGetStringField(TEXT("variable_name"), VariableName))
+                {
+                    NodeObj->TryGetStringField(TEXT("component_name"), VariableName);
+                }
+                const FGuid VarGuid = FBlueprintEditorUtils::FindMemberVariableGuidByName(Blueprint, FName(*VariableName));
+
+                // Self-member reference by GUID, so variables added earlier in the same session resolve without a compile
+                UK2Node_Variable* VarNode = (NodeType == TEXT("VariableSet"))
+                    ? static_cast<UK2Node_Variable*>(NewObject<UK2Node_VariableSet>(Graph))
+                    : static_cast<UK2Node_Variable*>(NewObject<UK2Node_VariableGet>(Graph));
+                VarNode->VariableReference.SetSelfMember(FName(*VariableName), VarGuid);
+                VarNode->NodePosX = Position.X;
+                VarNode->NodePosY = Position.Y;
+                Graph->AddNode(VarNode, true);
+                VarNode->CreateNewGuid();
+                VarNode->PostPlacedNewNode();
+                VarNode->AllocateDefaultPins();
+                NewNode = VarNode;
+            }
+            else if (NodeType == TEXT("InputAction"))
+            {
+                FString ActionName;
+                NodeObj->TryGetStringField(TEXT("action_name"), ActionName);
+                NewNode = FUnrealMCPCommonUtils::CreateInputActionNode(Graph, ActionName, Position);
+            }
+            else if (NodeType == TEXT("Self"))
+            {
+                NewNode = FUnrealMCPCommonUtils::CreateSelfReferenceNode(Graph, Position);
+            }
+            else
+            {
+                return Fail(
+                    FString::Printf(TEXT("Unknown node_type '%s'. Supported: Event, FunctionCall, VariableGet, VariableSet, GetComponent, InputAction, Self"), *NodeType),
+                    Where);
+            }
+
+            if (!NewNode)
+            {
+                return Fail(FString::Printf(TEXT("Failed to create %s node '%s'"), *NodeType, *TempId), Where);
+            }
+            if (!bReusedExisting)
+            {
+                NewNode->SetFlags(RF_Transactional);
+                CreatedNodes.Add(NewNode);
+            }
+            TempIdToNode.Add(TempId, NewNode);
+
+            // Pin defaults
+            const TSharedPtr<FJsonObject>* PinsObj = nullptr;
+            if (NodeObj->TryGetObjectField(TEXT("pins"), PinsObj))
+            {
+                NewNode->Modify();
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& PinValue : (*PinsObj)->Values)
+                {
+                    UEdGraphPin* Pin = FUnrealMCPCommonUtils::FindPin(NewNode, PinValue.Key, EGPD_Input);
+                    if (!Pin)
+                    {
+                        return Fail(FString::Printf(TEXT("Input pin '%s' not found on node '%s'"), *PinValue.Key, *TempId), Where);
+                    }
+                    FString PinError;
+                    if (!ApplyPinDefault(Pin, PinValue.Value, PinError))
+                    {
+                        return Fail(PinError, Where);
+                    }
+                }
+            }
+        }
+    }
+
+    // Links (endpoints may be temporary ids from this patch or GUIDs of existing nodes in the same graph)
+    if (LinksArray)
+    {
+        const UEdGraphSchema* Schema = Graph->GetSchema();
+        for (int32 Index = 0; Index < LinksArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject> LinkObj = (*LinksArray)[Index].IsValid() ? (*LinksArray)[Index]->AsObject() : nullptr;
+            const FString Where = FString::Printf(TEXT("links[%d]"), Index);
+            FString FromRef, FromPin, ToRef, ToPin;
+            if (!LinkObj.IsValid() ||
+                !LinkObj->TryGetStringField(TEXT("from_node"), FromRef) || !LinkObj->TryGetStringField(TEXT("from_pin"), FromPin) ||
+                !LinkObj->TryGetStringField(TEXT("to_node"), ToRef) || !LinkObj->TryGetStringField(TEXT("to_pin"), ToPin))
+            {
+                return Fail(TEXT("Link entry requires 'from_node', 'from_pin', 'to_node' and 'to_pin'"), Where);
+            }
+
+            UEdGraphNode* FromNode = ResolveNodeRef(FromRef);
+            UEdGraphNode* ToNode = ResolveNodeRef(ToRef);
+            if (!FromNode || !ToNode)
+            {
+                return Fail(FString::Printf(TEXT("Link endpoint not found in graph '%s'"), *Graph->GetName()),
+                    FString::Printf(TEXT("%s: %s -> %s"), *Where, *FromRef, *ToRef));
+            }
+
+            UEdGraphPin* SourcePin = FUnrealMCPCommonUtils::FindPin(FromNode, FromPin, EGPD_Output);
+            UEdGraphPin* TargetPin = FUnrealMCPCommonUtils::FindPin(ToNode, ToPin, EGPD_Input);
+            if (!SourcePin || !TargetPin)
+            {
+                return Fail(FString::Printf(TEXT("Pin not found for link %s.%s -> %s.%s"), *FromRef, *FromPin, *ToRef, *ToPin), Where);
+            }
+
+            // Conversion and promotion responses would add nodes the patch cannot track or roll back
+            const FPinConnectionResponse Response = Schema->CanCreateConnection(SourcePin, TargetPin);
+            if (Response.Response == CONNECT_RESPONSE_MAKE_WITH_CONVERSION_NODE || Response.Response == CONNECT_RESPONSE_MAKE_WITH_PROMOTION)
+            {
+                return Fail(FString::Printf(TEXT("Cannot link %s.%s -> %s.%s directly: the pin types need a conversion node; add it to the patch"),
+                    *FromRef, *FromPin, *ToRef, *ToPin), Where);
+            }
+            if (Response.Response == CONNECT_RESPONSE_DISALLOW)
+            {
+                return Fail(FString::Printf(TEXT("Cannot link %s.%s -> %s.%s: %s"), *FromRef, *FromPin, *ToRef, *ToPin, *Response.Message.ToString()), Where);
+            }
+
+            // The schema may break existing links (e.g. an exec output already wired); remember them for rollback
+            TArray<TPair<UEdGraphPin*, UEdGraphPin*>> PreviousLinks;
+            for (UEdGraphPin* LinkedTo : SourcePin->LinkedTo)
+            {
+                PreviousLinks.Emplace(SourcePin, LinkedTo);
+            }
+            for (UEdGraphPin* LinkedFrom : TargetPin->LinkedTo)
+            {
+                PreviousLinks.Emplace(LinkedFrom, TargetPin);
+            }
+
+            if (!Schema->TryCreateConnection(SourcePin, TargetPin))
+            {
+                return Fail(FString::Printf(TEXT("Cannot link %s.%s -> %s.%s"), *FromRef, *FromPin, *ToRef, *ToPin), Where);
+            }
+
+            for (const TPair<UEdGraphPin*, UEdGraphPin*>& Previous : PreviousLinks)
+            {
+                if (Previous.Key->LinkedTo.Contains(Previous.Value))
+                {
+                    continue;
+                }
+                // A link this patch made and then replaced needs no restoring
+                if (CreatedLinks.Remove(Previous) == 0)
+                {
+                    BrokenLinks.Add(Previous);
+                }
+            }
+            CreatedLinks.Emplace(SourcePin, TargetPin);
+        }
+    }
+
+    // One structural notification for the whole patch; the compile itself is coalesced by the request flush.
+    FUnrealMCPCompileQueue::Get().MarkDirty(Blueprint, bCompile ? FUnrealMCPCompileQueue::ECompileLevel::Full : FUnrealMCPCompileQueue::ECompileLevel::Skeleton);
+    Blueprint->MarkPackageDirty();
+
+    TSharedPtr<FJsonObject> NodeIds = MakeShared<FJsonObject>();
+    for (const TPair<FString, UEdGraphNode*>& Pair : TempIdToNode)
+    {
+        NodeIds->SetStringField(Pair.Key, Pair.Value->NodeGuid.ToString());
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetObjectField(TEXT("node_ids"), NodeIds);
+    ResultObj->SetNumberField(TEXT("nodes_created"), CreatedNodes.Num());
+    ResultObj->SetNumberField(TEXT("links_created"), CreatedLinks.Num());
+    ResultObj->SetNumberField(TEXT("links_broken"), BrokenLinks.Num());
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetStringField(TEXT("compile"), bCompile ? TEXT("queued") : TEXT("deferred"));
+    FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+
+    UE_LOG(LogTemp, Log, TEXT("Applied graph patch to %s/%s: %d nodes, %d links"),
+        *BlueprintName, *Graph->GetName(), CreatedNodes.Num(), CreatedLinks.Num());
+
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleSearchBlueprintFunctions(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Query;
+    if (!Params->TryGetStringField(TEXT("query"), Query) || Query.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' parameter"));
+    }
+
+    FString Target;
+    Params->TryGetStringField(TEXT("target"), Target);
+
+    FString Match = TEXT("prefix");
+    Params->TryGetStringField(TEXT("match"), Match);
+
+    int32 Limit = 50;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, 500);
+
+    FUnrealMCPFunctionIndex& Index = FUnrealMCPFunctionIndex::Get();
+
+    UClass* TargetClass = nullptr;
+    if (!Target.IsEmpty())
+    {
+        FUnrealMCPClassIndex& Classes = FUnrealMCPClassIndex::Get();
+        TargetClass = Classes.FindClass(Target);
+        if (!TargetClass)
+        {
+            TargetClass = Classes.FindClass(Target + TEXT("Component"));
+        }
+        if (!TargetClass)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Target class '%s' not found"), *Target),
+                TEXT("ERR_BAD_REQUEST"),
+                TEXT(""));
+        }
+    }
+
+    // One extra result tells us whether the list was cut off
+    TArray<const FUnrealMCPFunctionIndex::FCandidate*> Candidates;
+    Index.Search(Query, TargetClass, Match == TEXT("contains"), Limit + 1, Candidates);
+
+    const bool bTruncated = Candidates.Num() > Limit;
+    TArray<TSharedPtr<FJsonValue>> FunctionsArray;
+    for (int32 i = 0; i < FMath::Min(Candidates.Num(), Limit); ++i)
+    {
+        FunctionsArray.Add(MakeShared<FJsonValueObject>(FUnrealMCPFunctionIndex::CandidateToJson(*Candidates[i])));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("functions"), FunctionsArray);
+    ResultObj->SetNumberField(TEXT("count"), FunctionsArray.Num());
+    ResultObj->SetBoolField(TEXT("truncated"), bTruncated);
+    return ResultObj;
+}
+
+namespace UnrealMcpGraphExport
+{
+    /** Response-wide string table; repeated class, pin, type and member names are written once. */
+    struct FStringTable
+    {
+        TMap<FString, int32> Indices;
+        TArray<TSharedPtr<FJsonValue>> Values;
+
+        int32 Add(const FString& Value)
+        {
+            if (const int32* Existing = Indices.Find(Value))
+            {
+                return *Existing;
+            }
+            const int32 Index = Values.Add(MakeShared<FJsonValueString>(Value));
+            Indices.Add(Value, Index);
+            return Index;
+        }
+
+        int32 AddOptional(const FString& Value)
+        {
+            return Value.IsEmpty() ? INDEX_NONE : Add(Value);
+        }
+    };
+
+    /** One column of a table: parallel arrays keep keys out of every row. */
+    struct FColumn
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+
+        void Add(double Value) { Values.Add(MakeShared<FJsonValueNumber>(Value)); }
+        void Add(const FString& Value) { Values.Add(MakeShared<FJsonValueString>(Value)); }
+    };
+
+    static const TCHAR* GetGraphKind(UBlueprint* Blueprint, UEdGraph* Graph)
+    {
+        if (Blueprint->UbergraphPages.Contains(Graph))
+        {
+            return TEXT("event");
+        }
+        if (Blueprint->FunctionGraphs.Contains(Graph))
+        {
+            return Graph->GetFName() == UEdGraphSchema_K2::FN_UserConstructionScript ? TEXT("construction_script") : TEXT("function");
+        }
+        if (Blueprint->MacroGraphs.Contains(Graph))
+        {
+            return TEXT("macro");
+        }
+        if (Blueprint->DelegateSignatureGraphs.Contains(Graph))
+        {
+            return TEXT("delegate");
+        }
+        return TEXT("subgraph");
+    }
+
+    /** Function, variable, event or macro a node refers to; stands in for the title when titles are off. */
+    static FString GetNodeMember(const UEdGraphNode* Node)
+    {
+        if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            return CallNode->FunctionReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+        {
+            return VariableNode->VariableReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            return (EventNode->bOverrideFunction ? EventNode->EventReference.GetMemberName() : EventNode->CustomFunctionName).ToString();
+        }
+        if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+        {
+            const UEdGraph* MacroGraph = MacroNode->GetMacroGraph();
+            return MacroGraph ? MacroGraph->GetName() : FString();
+        }
+        return FString();
+    }
+
+    static FString GetPinDefault(const UEdGraphPin* Pin)
+    {
+        if (Pin->DefaultObject)
+        {
+            return Pin->DefaultObject->GetPathName();
+        }
+        if (!Pin->DefaultTextValue.IsEmpty())
+        {
+            return Pin->DefaultTextValue.ToString();
+        }
+        return Pin->DefaultValue;
+    }
+
+    static TSharedPtr<FJsonObject> ExportGraph(UEdGraph* Graph, FStringTable& Strings, bool bIncludeTitles)
+    {
+        FColumn NodeIds, NodeClasses, NodeMembers, NodeX, NodeY, NodePinCounts, NodeComments, NodeTitles;
+        FColumn PinNodes, PinNames, PinDirections, PinTypes, PinSubTypes, PinContainers, PinDefaults;
+        TArray<TSharedPtr<FJsonValue>> Edges;
+        TMap<const UEdGraphPin*, int32> PinIndices;
+
+        int32 NodeIndex = 0;
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            int32 PinCount = 0;
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                // Hidden pins are noise unless something is wired to them
+                if (!Pin || (Pin->bHidden && Pin->LinkedTo.Num() == 0))
+                {
+                    continue;
+                }
+                PinIndices.Add(Pin, PinIndices.Num());
+                ++PinCount;
+
+                const UObject* SubTypeObject = Pin->PinType.PinSubCategoryObject.Get();
+                PinNodes.Add(NodeIndex);
+                PinNames.Add(Strings.Add(Pin->PinName.ToString()));
+                PinDirections.Add(Pin->Direction == EGPD_Output ? 1 : 0);
+                PinTypes.Add(Strings.Add(Pin->PinType.PinCategory.ToString()));
+                PinSubTypes.Add(SubTypeObject ? Strings.Add(SubTypeObject->GetName()) : Strings.AddOptional(Pin->PinType.PinSubCategory.ToString()));
+                PinContainers.Add(static_cast<int32>(Pin->PinType.ContainerType));
+                PinDefaults.Add(Strings.AddOptional(GetPinDefault(Pin)));
+            }
+
+            NodeIds.Add(Node->NodeGuid.ToString());
+            NodeClasses.Add(Strings.Add(Node->GetClass()->GetName()));
+            NodeMembers.Add(Strings.AddOptional(GetNodeMember(Node)));
+            NodeX.Add(Node->NodePosX);
+            NodeY.Add(Node->NodePosY);
+            NodePinCounts.Add(PinCount);
+            NodeComments.Add(Strings.AddOptional(Node->NodeComment));
+            if (bIncludeTitles)
+            {
+                NodeTitles.Add(Strings.Add(Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString()));
+            }
+            ++NodeIndex;
+        }
+
+        // Each link once, from its output side
+        for (const TPair<const UEdGraphPin*, int32>& Pair : PinIndices)
+        {
+            if (Pair.Key->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (const UEdGraphPin* Linked : Pair.Key->LinkedTo)
+            {
+                if (const int32* LinkedIndex = PinIndices.Find(Linked))
+                {
+                    TArray<TSharedPtr<FJsonValue>> Edge;
+                    Edge.Add(MakeShared<FJsonValueNumber>(Pair.Value));
+                    Edge.Add(MakeShared<FJsonValueNumber>(*LinkedIndex));
+                    Edges.Add(MakeShared<FJsonValueArray>(Edge));
+                }
+            }
+        }
+
+        TSharedPtr<FJsonObject> Nodes = MakeShared<FJsonObject>();
+        Nodes->SetArrayField(TEXT("id"), NodeIds.Values);
+        Nodes->SetArrayField(TEXT("class"), NodeClasses.Values);
+        Nodes->SetArrayField(TEXT("member"), NodeMembers.Values);
+        Nodes->SetArrayField(TEXT("x"), NodeX.Values);
+        Nodes->SetArrayField(TEXT("y"), NodeY.Values);
+        Nodes->SetArrayField(TEXT("pin_count"), NodePinCounts.Values);
+        Nodes->SetArrayField(TEXT("comment"), NodeComments.Values);
+        if (bIncludeTitles)
+        {
+            Nodes->SetArrayField(TEXT("title"), NodeTitles.Values);
+        }
+
+        TSharedPtr<FJsonObject> Pins = MakeShared<FJsonObject>();
+        Pins->SetArrayField(TEXT("node"), PinNodes.Values);
+        Pins->SetArrayField(TEXT("name"), PinNames.Values);
+        Pins->SetArrayField(TEXT("dir"), PinDirections.Values);
+        Pins->SetArrayField(TEXT("type"), PinTypes.Values);
+        Pins->SetArrayField(TEXT("sub_type"), PinSubTypes.Values);
+        Pins->SetArrayField(TEXT("container"), PinContainers.Values);
+        Pins->SetArrayField(TEXT("default"), PinDefaults.Values);
+
+        TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+        GraphObj->SetNumberField(TEXT("node_count"), NodeIndex);
+        GraphObj->SetNumberField(TEXT("pin_count"), PinIndices.Num());
+        GraphObj->SetObjectField(TEXT("nodes"), Nodes);
+        GraphObj->SetObjectField(TEXT("pins"), Pins);
+        GraphObj->SetArrayField(TEXT("edges"), Edges);
+        return GraphObj;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleExportBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    using namespace UnrealMcpGraphExport;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FString BlueprintName;
+    Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
+    FString BlueprintPath;
+    Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath);
+    if (BlueprintName.IsEmpty() && BlueprintPath.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' or 'blueprint_path' parameter"));
+    }
+
+    FString ResolvedPath;
+    TArray<FString> Candidates;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::ResolveBlueprintFromNameOrPath(BlueprintName, BlueprintPath, ResolvedPath, Candidates);
+    if (!Blueprint)
+    {
+        FString Details;
+        if (Candidates.Num() > 1)
+        {
+            Details = TEXT("Multiple blueprints matched by name. Please pass blueprint_path. Candidates:\n");
+            for (const FString& C : Candidates)
+            {
+                Details += TEXT("- ") + C + TEXT("\n");
+            }
+        }
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("Blueprint '%s' not found or ambiguous"), BlueprintName.IsEmpty() ? *BlueprintPath : *BlueprintName),
+            TEXT("ERR_ASSET_NOT_FOUND"),
+            Details);
+    }
+
+    bool bIncludeTitles = false;
+    Params->TryGetBoolField(TEXT("include_titles"), bIncludeTitles);
+    int32 GraphOffset = 0;
+    Params->TryGetNumberField(TEXT("graph_offset"), GraphOffset);
+    int32 GraphLimit = 0;
+    Params->TryGetNumberField(TEXT("graph_limit"), GraphLimit);
+    GraphOffset = FMath::Max(0, GraphOffset);
+
+    TSet<FString> GraphFilter;
+    const TArray<TSharedPtr<FJsonValue>>* GraphNames = nullptr;
+    if (Params->TryGetArrayField(TEXT("graphs"), GraphNames))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *GraphNames)
+        {
+            GraphFilter.Add(Value->AsString());
+        }
+    }
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    TArray<UEdGraph*> Graphs;
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (Graph && (GraphFilter.Num() == 0 || GraphFilter.Contains(Graph->GetName())))
+        {
+            Graphs.Add(Graph);
+        }
+    }
+
+    // Per-graph fingerprints are cheap (no titles); the overall one covers every selected graph, not just this page
+    TArray<FString> Fingerprints;
+    FString Combined;
+    for (UEdGraph* Graph : Graphs)
+    {
+        const FString& Fingerprint = Fingerprints.Add_GetRef(FUnrealMCPBlueprintFingerprint::ComputeGraph(Graph));
+        Combined += Graph->GetPathName() + TEXT("=") + Fingerprint + TEXT(";");
+    }
+    const FString BlueprintFingerprint = FString::Printf(TEXT("%016llx"),
+        FXxHash64::HashBuffer(*Combined, Combined.Len() * sizeof(TCHAR)).Hash);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("fingerprint"), BlueprintFingerprint);
+    FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+
+    FString KnownFingerprint;
+    if (Params->TryGetStringField(TEXT("fingerprint"), KnownFingerprint) && KnownFingerprint == BlueprintFingerprint)
+    {
+        ResultObj->SetBoolField(TEXT("not_modified"), true);
+        return ResultObj;
+    }
+
+    const TSharedPtr<FJsonObject>* KnownGraphs = nullptr;
+    Params->TryGetObjectField(TEXT("known_fingerprints"), KnownGraphs);
+
+    const int32 End = GraphLimit > 0 ? FMath::Min(Graphs.Num(), GraphOffset + GraphLimit) : Graphs.Num();
+    FStringTable Strings;
+    TArray<TSharedPtr<FJsonValue>> GraphItems;
+    int32 NotModified = 0;
+    for (int32 Index = GraphOffset; Index < End; ++Index)
+    {
+        UEdGraph* Graph = Graphs[Index];
+        FString KnownGraphFingerprint;
+        const bool bUnchanged = KnownGraphs && (*KnownGraphs)->TryGetStringField(Graph->GetName(), KnownGraphFingerprint) &&
+            KnownGraphFingerprint == Fingerprints[Index];
+
+        TSharedPtr<FJsonObject> GraphObj = bUnchanged ? MakeShared<FJsonObject>() : ExportGraph(Graph, Strings, bIncludeTitles);
+        GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+        GraphObj->SetStringField(TEXT("kind"), GetGraphKind(Blueprint, Graph));
+        GraphObj->SetStringField(TEXT("fingerprint"), Fingerprints[Index]);
+        if (bUnchanged)
+        {
+            GraphObj->SetBoolField(TEXT("not_modified"), true);
+            ++NotModified;
+        }
+        GraphItems.Add(MakeShared<FJsonValueObject>(GraphObj));
+    }
+
+    ResultObj->SetArrayField(TEXT("strings"), Strings.Values);
+    ResultObj->SetArrayField(TEXT("graphs"), GraphItems);
+    ResultObj->SetNumberField(TEXT("total_graphs"), Graphs.Num());
+    ResultObj->SetNumberField(TEXT("graph_offset"), GraphOffset);
+    ResultObj->SetNumberField(TEXT("graphs_not_modified"), NotModified);
+    if (End < Graphs.Num())
+    {
+        ResultObj->SetNumberField(TEXT("next_graph_offset"), End);
+    }
+    ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleSearchBlueprintGraphs(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    FUnrealMCPGraphSearchIndex& Index = FUnrealMCPGraphSearchIndex::Get();
+
+    FUnrealMCPGraphSearchIndex::FQuery Query;
+    if (!Params->TryGetStringField(TEXT("name"), Query.Name) || Query.Name.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    FString KindName;
+    if (Params->TryGetStringField(TEXT("kind"), KindName) && !KindName.IsEmpty() && !KindName.Equals(TEXT("any"), ESearchCase::IgnoreCase))
+    {
+        FUnrealMCPGraphSearchIndex::EFactKind Kind;
+        if (!FUnrealMCPGraphSearchIndex::ParseKind(KindName, Kind))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+                FString::Printf(TEXT("Unknown kind '%s'"), *KindName),
+                TEXT("ERR_BAD_REQUEST"),
+                TEXT("Use function, variable, event, macro, node_class or any"));
+        }
+        Query.Kind = Kind;
+    }
+
+    FString MatchMode = TEXT("exact");
+    Params->TryGetStringField(TEXT("match"), MatchMode);
+    Query.Match = MatchMode.Equals(TEXT("prefix"), ESearchCase::IgnoreCase) ? FUnrealMCPGraphSearchIndex::EMatch::Prefix
+        : MatchMode.Equals(TEXT("contains"), ESearchCase::IgnoreCase) ? FUnrealMCPGraphSearchIndex::EMatch::Contains
+        : FUnrealMCPGraphSearchIndex::EMatch::Exact;
+
+    Params->TryGetStringField(TEXT("owner"), Query.Owner);
+    Params->TryGetStringField(TEXT("path"), Query.PathPrefix);
+    Params->TryGetNumberField(TEXT("limit"), Query.Limit);
+    Query.Limit = FMath::Clamp(Query.Limit, 1, 1000);
+
+    bool bBlueprintsOnly = false;
+    Params->TryGetBoolField(TEXT("blueprints_only"), bBlueprintsOnly);
+    bool bRebuild = false;
+    Params->TryGetBoolField(TEXT("rebuild"), bRebuild);
+    bool bWait = false;
+    Params->TryGetBoolField(TEXT("wait"), bWait);
+
+    if (bRebuild)
+    {
+        Index.Rebuild();
+    }
+    if (bWait)
+    {
+        Index.FinishCrawl();
+    }
+
+    // Blueprint-level answers need every match, not just the first page of nodes
+    const int32 Limit = Query.Limit;
+    if (bBlueprintsOnly)
+    {
+        Query.Limit = 0;
+    }
+    TArray<FUnrealMCPGraphSearchIndex::FMatch> Matches;
+    const int32 Total = Index.Search(Query, Matches);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (bBlueprintsOnly)
+    {
+        TArray<TSharedPtr<FJsonValue>> BlueprintValues;
+        FName LastPackage;
+        for (const FUnrealMCPGraphSearchIndex::FMatch& Match : Matches)
+        {
+            // Matches are sorted by package
+            if (Match.Package != LastPackage)
+            {
+                LastPackage = Match.Package;
+                BlueprintValues.Add(MakeShared<FJsonValueString>(Match.Package.ToString()));
+            }
+        }
+        const int32 TotalBlueprints = BlueprintValues.Num();
+        if (TotalBlueprints > Limit)
+        {
+            BlueprintValues.SetNum(Limit);
+        }
+        ResultObj->SetArrayField(TEXT("blueprints"), BlueprintValues);
+        ResultObj->SetNumberField(TEXT("total_blueprints"), TotalBlueprints);
+        ResultObj->SetBoolField(TEXT("truncated"), TotalBlueprints > Limit);
+    }
+    else
+    {
+        TArray<TSharedPtr<FJsonValue>> MatchValues;
+        for (const FUnrealMCPGraphSearchIndex::FMatch& Match : Matches)
+        {
+            const FUnrealMCPGraphSearchIndex::FFact& Fact = *Match.Fact;
+            TSharedPtr<FJsonObject> MatchObj = MakeShared<FJsonObject>();
+            MatchObj->SetStringField(TEXT("blueprint"), Match.Package.ToString());
+            MatchObj->SetStringField(TEXT("graph"), Fact.Graph.ToString());
+            MatchObj->SetStringField(TEXT("node_id"), Fact.NodeGuid.ToString());
+            MatchObj->SetStringField(TEXT("node_class"), Fact.NodeClass.ToString());
+            MatchObj->SetStringField(TEXT("kind"), FUnrealMCPGraphSearchIndex::GetKindName(Fact.Kind));
+            if (!Fact.Member.IsNone())
+            {
+                MatchObj->SetStringField(TEXT("name"), Fact.Member.ToString());
+            }
+            if (!Fact.Owner.IsNone())
+            {
+                MatchObj->SetStringField(TEXT("owner"), Fact.Owner.ToString());
+            }
+            MatchValues.Add(MakeShared<FJsonValueObject>(MatchObj));
+        }
+        ResultObj->SetArrayField(TEXT("matches"), MatchValues);
+        ResultObj->SetBoolField(TEXT("truncated"), Matches.Num() < Total);
+    }
+
+    ResultObj->SetNumberField(TEXT("total_matches"), Total);
+    ResultObj->SetNumberField(TEXT("blueprints_indexed"), Index.NumIndexed());
+    ResultObj->SetNumberField(TEXT("pending"), Index.NumPending());
+    ResultObj->SetBoolField(TEXT("index_complete"), Index.NumPending() == 0);
+    ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
@@ -0,0 +1,166 @@
+#include "Commands/UnrealMCPBlueprintNodeIndex.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+FUnrealMCPBlueprintNodeIndex& FUnrealMCPBlueprintNodeIndex::Get()
+{
+	static FUnrealMCPBlueprintNodeIndex Instance;
+	return Instance;
+}
+
+FUnrealMCPBlueprintNodeIndex::FEntry& FUnrealMCPBlueprintNodeIndex::FindOrAddEntry(UBlueprint* Blueprint)
+{
+	FEntry& Entry = Entries.FindOrAdd(TObjectKey<UBlueprint>(Blueprint));
+	if (!Entry.Blueprint.IsValid())
+	{
+		Entry.Blueprint = Blueprint;
+		Entry.bDirty = true;
+		Entry.BlueprintChangedHandle = Blueprint->OnChanged().AddRaw(this, &FUnrealMCPBlueprintNodeIndex::OnBlueprintChanged);
+	}
+	return Entry;
+}
+
+void FUnrealMCPBlueprintNodeIndex::Unbind(FEntry& Entry)
+{
+	for (const FGraphBinding& Binding : Entry.Graphs)
+	{
+		if (UEdGraph* Graph = Binding.Graph.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(Binding.Handle);
+		}
+	}
+	Entry.Graphs.Reset();
+}
+
+void FUnrealMCPBlueprintNodeIndex::Rebuild(FEntry& Entry)
+{
+	Unbind(Entry);
+	Entry.Nodes.Reset();
+	Entry.bDirty = false;
+
+	UBlueprint* Blueprint = Entry.Blueprint.Get();
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	TArray<UEdGraph*> Graphs;
+	Blueprint->GetAllGraphs(Graphs);
+
+	const TObjectKey<UBlueprint> BlueprintKey(Blueprint);
+	for (UEdGraph* Graph : Graphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node)
+			{
+				Entry.Nodes.Add(Node->NodeGuid, Node);
+			}
+		}
+
+		FGraphBinding& Binding = Entry.Graphs.AddDefaulted_GetRef();
+		Binding.Graph = Graph;
+		Binding.Handle = Graph->AddOnGraphChangedHandler(
+			FOnGraphChanged::FDelegate::CreateRaw(this, &FUnrealMCPBlueprintNodeIndex::OnGraphChanged, BlueprintKey));
+	}
+}
+
+void FUnrealMCPBlueprintNodeIndex::OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UBlueprint> BlueprintKey)
+{
+	FEntry* Entry = Entries.Find(BlueprintKey);
+	if (!Entry || Entry->bDirty)
+	{
+		return;
+	}
+
+	// Adds and removes are applied in place; anything else (graph reloads, bulk edits) rebuilds lazily.
+	if (Action.Action & GRAPHACTION_AddNode)
+	{
+		for (const UEdGraphNode* Node : Action.Nodes)
+		{
+			if (Node)
+			{
+				Entry->Nodes.Add(Node->NodeGuid, const_cast<UEdGraphNode*>(Node));
+			}
+		}
+	}
+	else if (Action.Action & GRAPHACTION_RemoveNode)
+	{
+		for (const UEdGraphNode* Node : Action.Nodes)
+		{
+			if (Node)
+			{
+				Entry->Nodes.Remove(Node->NodeGuid);
+			}
+		}
+	}
+	else
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FUnrealMCPBlueprintNodeIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	// Graphs may have been added or removed; the per-graph bindings no longer cover everything.
+	if (FEntry* Entry = Entries.Find(TObjectKey<UBlueprint>(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FUnrealMCPBlueprintNodeIndex::Invalidate(UBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Entries.Find(TObjectKey<UBlueprint>(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+UEdGraphNode* FUnrealMCPBlueprintNodeIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+	check(IsInGameThread());
+	if (!Blueprint || !NodeGuid.IsValid())
+	{
+		return nullptr;
+	}
+
+	FEntry& Entry = FindOrAddEntry(Blueprint);
+	if (Entry.bDirty)
+	{
+		Rebuild(Entry);
+	}
+
+	auto Lookup = [&Entry, &NodeGuid]() -> UEdGraphNode*
+	{
+		const TWeakObjectPtr<UEdGraphNode>* Found = Entry.Nodes.Find(NodeGuid);
+		UEdGraphNode* Node = Found ? Found->Get() : nullptr;
+		// Guard against destroyed nodes and nodes whose GUID was regenerated since indexing.
+		return (IsValid(Node) && Node->NodeGuid == NodeGuid && Node->GetGraph()) ? Node : nullptr;
+	};
+
+	if (UEdGraphNode* Node = Lookup())
+	{
+		return Node;
+	}
+
+	// Miss or stale hit: the index may predate a graph we were not bound to. Rebuild once and retry.
+	Rebuild(Entry);
+	return Lookup();
+}
+
+UEdGraphNode* FUnrealMCPBlueprintNodeIndex::FindNode(UBlueprint* Blueprint, const FString& NodeId)
+{
+	FGuid NodeGuid;
+	if (!FGuid::Parse(NodeId, NodeGuid))
+	{
+		return nullptr;
+	}
+	return FindNode(Blueprint, NodeGuid);
+}
@@ -0,0 +1,331 @@
+#include "Commands/UnrealMCPClassIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectIterator.h"
+
+namespace UnrealMcpClassIndex
+{
+	static bool IsIndexableClass(const UClass* Class)
+	{
+		if (!Class || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			return false;
+		}
+		// Blueprint classes are indexed from the asset registry, loaded or not
+		if (Class->IsA<UBlueprintGeneratedClass>())
+		{
+			return false;
+		}
+		const FString Name = Class->GetName();
+		return !Name.StartsWith(TEXT("SKEL_")) && !Name.StartsWith(TEXT("REINST_")) && !Name.StartsWith(TEXT("TRASH_"));
+	}
+
+	static IAssetRegistry& GetAssetRegistry()
+	{
+		return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	}
+}
+
+FUnrealMCPClassIndex& FUnrealMCPClassIndex::Get()
+{
+	static FUnrealMCPClassIndex Instance;
+	return Instance;
+}
+
+void FUnrealMCPClassIndex::Invalidate()
+{
+	Entries.Reset();
+	ByKey.Reset();
+	IndexedClasses.Reset();
+	BlueprintsByPackage.Reset();
+	Misses.Reset();
+	bBuilt = false;
+	bNeedsScan = false;
+}
+
+void FUnrealMCPClassIndex::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		bNeedsScan = true;
+	}
+	else if (Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		Invalidate();
+	}
+}
+
+void FUnrealMCPClassIndex::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+}
+
+void FUnrealMCPClassIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	// Before the first build the full scan picks these up anyway
+	if (bBuilt)
+	{
+		IndexBlueprintAsset(AssetData);
+	}
+}
+
+void FUnrealMCPClassIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bBuilt)
+	{
+		RemoveBlueprintPackage(AssetData.PackageName);
+	}
+}
+
+void FUnrealMCPClassIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bBuilt)
+	{
+		RemoveBlueprintPackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+		IndexBlueprintAsset(AssetData);
+	}
+}
+
+void FUnrealMCPClassIndex::EnsureBuilt()
+{
+	check(IsInGameThread());
+
+	if (!bDelegatesBound)
+	{
+		FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealMCPClassIndex::OnModulesChanged);
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUnrealMCPClassIndex::OnReloadComplete);
+		IAssetRegistry& AssetRegistry = UnrealMcpClassIndex::GetAssetRegistry();
+		AssetRegistry.OnAssetAdded().AddRaw(this, &FUnrealMCPClassIndex::OnAssetAdded);
+		AssetRegistry.OnAssetRemoved().AddRaw(this, &FUnrealMCPClassIndex::OnAssetRemoved);
+		AssetRegistry.OnAssetRenamed().AddRaw(this, &FUnrealMCPClassIndex::OnAssetRenamed);
+		bDelegatesBound = true;
+	}
+
+	if (!bBuilt)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		IndexNewClasses();
+
+		TArray<FAssetData> Blueprints;
+		UnrealMcpClassIndex::GetAssetRegistry().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Blueprints, true);
+		for (const FAssetData& AssetData : Blueprints)
+		{
+			IndexBlueprintAsset(AssetData);
+		}
+
+		bBuilt = true;
+		bNeedsScan = false;
+		UE_LOG(LogTemp, Log, TEXT("UnrealMCP: class index built (%d native classes, %d Blueprint classes) in %.1f ms"),
+			IndexedClasses.Num(), BlueprintsByPackage.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	else if (bNeedsScan)
+	{
+		IndexNewClasses();
+		bNeedsScan = false;
+	}
+}
+
+void FUnrealMCPClassIndex::IndexNewClasses()
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!IndexedClasses.Contains(Class) && UnrealMcpClassIndex::IsIndexableClass(Class))
+		{
+			IndexClass(Class);
+		}
+	}
+}
+
+void FUnrealMCPClassIndex::IndexClass(UClass* Class)
+{
+	IndexedClasses.Add(Class);
+
+	FEntry Entry;
+	Entry.Class = Class;
+	Entry.Path = FSoftClassPath(Class);
+
+	const FString Name = Class->GetName().ToLower();
+	const FString Prefixed = FString(Class->GetPrefixCPP()).ToLower() + Name;
+	Entry.Keys.Add(Name);
+	if (Prefixed != Name)
+	{
+		Entry.Keys.Add(Prefixed);
+	}
+	Entry.Keys.Add(Class->GetPathName().ToLower());
+	AddEntry(MoveTemp(Entry));
+}
+
+void FUnrealMCPClassIndex::IndexBlueprintAsset(const FAssetData& AssetData)
+{
+	// Only Blueprint-like assets carry a generated class tag
+	FString GeneratedClassTag;
+	if (!AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassTag))
+	{
+		return;
+	}
+	const FSoftClassPath ClassPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassTag));
+	if (!ClassPath.IsValid())
+	{
+		return;
+	}
+
+	// Re-saves and re-registrations replace the previous entry
+	RemoveBlueprintPackage(AssetData.PackageName);
+
+	FEntry Entry;
+	Entry.bBlueprint = true;
+	Entry.Path = ClassPath;
+	Entry.Class = ClassPath.ResolveClass();
+	Entry.PackageName = AssetData.PackageName;
+
+	FString NativeParentTag;
+	if (AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentTag))
+	{
+		Entry.NativeParent.TrySetPath(FPackageName::ExportTextPathToObjectPath(NativeParentTag));
+	}
+
+	Entry.Keys.Add(AssetData.AssetName.ToString().ToLower());
+	Entry.Keys.Add(ClassPath.GetAssetName().ToLower());
+	Entry.Keys.Add(AssetData.PackageName.ToString().ToLower());
+	Entry.Keys.Add(AssetData.GetObjectPathString().ToLower());
+	Entry.Keys.Add(ClassPath.ToString().ToLower());
+
+	const FName PackageName = AssetData.PackageName;
+	BlueprintsByPackage.Add(PackageName, AddEntry(MoveTemp(Entry)));
+}
+
+void FUnrealMCPClassIndex::RemoveBlueprintPackage(FName PackageName)
+{
+	int32 Index = INDEX_NONE;
+	if (!BlueprintsByPackage.RemoveAndCopyValue(PackageName, Index))
+	{
+		return;
+	}
+
+	// The slot stays in Entries so other indices remain valid; it just has no keys any more
+	FEntry& Entry = Entries[Index];
+	for (const FString& Key : Entry.Keys)
+	{
+		ByKey.Remove(Key, Index);
+	}
+	Entry.Keys.Reset();
+	Entry.Class.Reset();
+	Entry.Path.Reset();
+}
+
+int32 FUnrealMCPClassIndex::AddEntry(FEntry&& Entry)
+{
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	for (const FString& Key : Entries[Index].Keys)
+	{
+		ByKey.Add(Key, Index);
+	}
+	// Something new may answer a name that missed before
+	Misses.Reset();
+	return Index;
+}
+
+UClass* FUnrealMCPClassIndex::LoadEntry(FEntry& Entry)
+{
+	if (UClass* Class = Entry.Class.Get())
+	{
+		return Class;
+	}
+	UClass* Class = Entry.Path.TryLoadClass<UObject>();
+	Entry.Class = Class;
+	return Class;
+}
+
+bool FUnrealMCPClassIndex::MatchesBase(FEntry& Entry, const UClass* BaseClass)
+{
+	if (!BaseClass)
+	{
+		return true;
+	}
+	if (const UClass* Class = Entry.Class.Get())
+	{
+		return Class->IsChildOf(BaseClass);
+	}
+	// An unloaded Blueprint: its native ancestor answers for native bases without loading it
+	if (Entry.NativeParent.IsValid() && BaseClass->HasAnyClassFlags(CLASS_Native))
+	{
+		if (const UClass* NativeParent = FindObject<UClass>(Entry.NativeParent))
+		{
+			return NativeParent->IsChildOf(BaseClass);
+		}
+	}
+	const UClass* Class = LoadEntry(Entry);
+	return Class && Class->IsChildOf(BaseClass);
+}
+
+UClass* FUnrealMCPClassIndex::FindClass(const FString& Name, const UClass* BaseClass, TArray<FString>* OutCandidates)
+{
+	EnsureBuilt();
+
+	FString Path = Name.TrimStartAndEnd();
+	if (Path.EndsWith(TEXT("'")))
+	{
+		// Export text form, e.g. /Script/CoreUObject.Class'/Script/Engine.Actor'
+		Path = FPackageName::ExportTextPathToObjectPath(Path);
+	}
+	const FString Key = Path.ToLower();
+	if (Key.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	TArray<int32, TInlineAllocator<4>> Indices;
+	ByKey.MultiFind(Key, Indices);
+
+	if (Indices.Num() == 0)
+	{
+		if (!Key.StartsWith(TEXT("/")) || Misses.Contains(Key))
+		{
+			return nullptr;
+		}
+
+		// A path the registry has not reported yet (still scanning, or content outside the scanned roots)
+		UClass* Loaded = LoadObject<UClass>(nullptr, *Path, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		if (!Loaded && !Path.Contains(TEXT(".")))
+		{
+			const FString ClassPath = FString::Printf(TEXT("%s.%s_C"), *Path, *FPackageName::GetShortName(Path));
+			Loaded = LoadObject<UClass>(nullptr, *ClassPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		}
+		if (!Loaded)
+		{
+			Misses.Add(Key);
+			return nullptr;
+		}
+		if (BaseClass && !Loaded->IsChildOf(BaseClass))
+		{
+			return nullptr;
+		}
+		if (OutCandidates)
+		{
+			OutCandidates->Add(Loaded->GetPathName());
+		}
+		return Loaded;
+	}
+
+	TArray<int32, TInlineAllocator<4>> Matching;
+	for (int32 Index : Indices)
+	{
+		if (!Matching.Contains(Index) && MatchesBase(Entries[Index], BaseClass))
+		{
+			Matching.Add(Index);
+		}
+	}
+
+	if (OutCandidates)
+	{
+		for (int32 Index : Matching)
+		{
+			OutCandidates->Add(Entries[Index].Path.ToString());
+		}
+	}
+	return Matching.Num() == 1 ? LoadEntry(Entries[Matching[0]]) : nullptr;
+}
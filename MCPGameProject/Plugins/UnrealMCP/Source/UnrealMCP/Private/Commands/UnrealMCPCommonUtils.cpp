@@ -1,4 +1,5 @@
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPPropertyPath.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -17,6 +18,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
 #include "UObject/UObjectIterator.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/SoftObjectPath.h"
 #include "UObject/UnrealType.h"
 #include "Engine/Selection.h"
@@ -810,44 +812,175 @@ bool FUnrealMCPCommonUtils::ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode* Sou
     return false;
 }
 
-UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+namespace UnrealMcpPinLookup
 {
-    if (!Node)
+    /** Pin indices by key. Every hit is checked against the live Node->Pins slot, so a reconstructed node never yields a stale pin. */
+    struct FPinTable
+    {
+        int32 NumPins = 0;
+        TMultiMap<FName, int32> ByName;
+        TMap<FGuid, int32> ByGuid;
+        TMultiMap<FString, int32> ByDisplayName;
+        bool bHasDisplayNames = false;
+    };
+
+    static int32 ScopeDepth = 0;
+    static TMap<TObjectKey<UEdGraphNode>, FPinTable> Tables;
+
+    static void BuildTable(const UEdGraphNode* Node, FPinTable& Table)
     {
-        return nullptr;
+        Table = FPinTable();
+        Table.NumPins = Node->Pins.Num();
+        for (int32 Index = 0; Index < Node->Pins.Num(); ++Index)
+        {
+            if (const UEdGraphPin* Pin = Node->Pins[Index])
+            {
+                // FName comparison is case-insensitive, so this one map covers exact and case-folded names
+                Table.ByName.Add(Pin->PinName, Index);
+                Table.ByGuid.Add(Pin->PinId, Index);
+            }
+        }
     }
-    
-    // Log all pins for debugging
-    UE_LOG(LogTemp, Display, TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"), 
-           *PinName, (int32)Direction, *Node->GetName());
-    
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    static void BuildDisplayNames(const UEdGraphNode* Node, FPinTable& Table)
+    {
+        for (int32 Index = 0; Index < Node->Pins.Num(); ++Index)
+        {
+            if (const UEdGraphPin* Pin = Node->Pins[Index])
+            {
+                Table.ByDisplayName.Add(Node->GetPinDisplayName(Pin).ToString().ToLower(), Index);
+            }
+        }
+        Table.bHasDisplayNames = true;
+    }
+
+    static bool DirectionMatches(const UEdGraphPin* Pin, EEdGraphPinDirection Direction)
     {
-        UE_LOG(LogTemp, Display, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"), 
-               *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
+        return Direction == EGPD_MAX || Pin->Direction == Direction;
     }
-    
-    // First try exact match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    /** Exact-case name wins over case-folded name, then pin GUID, then display name. Sets bOutStale if a slot no longer holds the indexed pin. */
+    static UEdGraphPin* Resolve(UEdGraphNode* Node, FPinTable& Table, const FString& PinName, EEdGraphPinDirection Direction, bool& bOutStale)
     {
-        if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction))
+        bOutStale = false;
+        const FName Name(*PinName, FNAME_Find);
+        if (!Name.IsNone())
+        {
+            TArray<int32, TInlineAllocator<4>> Indices;
+            Table.ByName.MultiFind(Name, Indices);
+            UEdGraphPin* CaseFolded = nullptr;
+            for (int32 Index : Indices)
+            {
+                UEdGraphPin* Pin = Node->Pins[Index];
+                if (!Pin || Pin->PinName != Name)
+                {
+                    bOutStale = true;
+                    return nullptr;
+                }
+                if (!DirectionMatches(Pin, Direction))
+                {
+                    continue;
+                }
+                if (Pin->PinName.ToString().Equals(PinName, ESearchCase::CaseSensitive))
+                {
+                    return Pin;
+                }
+                CaseFolded = CaseFolded ? CaseFolded : Pin;
+            }
+            if (CaseFolded)
+            {
+                return CaseFolded;
+            }
+        }
+
+        FGuid PinGuid;
+        if (FGuid::Parse(PinName, PinGuid))
+        {
+            if (const int32* Index = Table.ByGuid.Find(PinGuid))
+            {
+                UEdGraphPin* Pin = Node->Pins[*Index];
+                if (!Pin || Pin->PinId != PinGuid)
+                {
+                    bOutStale = true;
+                    return nullptr;
+                }
+                return DirectionMatches(Pin, Direction) ? Pin : nullptr;
+            }
+        }
+
+        if (!Table.bHasDisplayNames)
+        {
+            BuildDisplayNames(Node, Table);
+        }
+        TArray<int32, TInlineAllocator<4>> Indices;
+        Table.ByDisplayName.MultiFind(PinName.ToLower(), Indices);
+        for (int32 Index : Indices)
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
+            UEdGraphPin* Pin = Node->Pins[Index];
+            if (Pin && DirectionMatches(Pin, Direction))
+            {
+                return Pin;
+            }
         }
+        return nullptr;
     }
-    
-    // If no exact match and we're looking for a component reference, try case-insensitive match
-    for (UEdGraphPin* Pin : Node->Pins)
+}
+
+FUnrealMCPCommonUtils::FPinLookupScope::FPinLookupScope()
+{
+    check(IsInGameThread());
+    ++UnrealMcpPinLookup::ScopeDepth;
+}
+
+FUnrealMCPCommonUtils::FPinLookupScope::~FPinLookupScope()
+{
+    if (--UnrealMcpPinLookup::ScopeDepth == 0)
+    {
+        UnrealMcpPinLookup::Tables.Reset();
+    }
+}
+
+UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+{
+    using namespace UnrealMcpPinLookup;
+
+    if (!Node)
+    {
+        return nullptr;
+    }
+
+    UEdGraphPin* Found = nullptr;
+    bool bStale = false;
+    if (ScopeDepth > 0)
     {
-        if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) && 
-            (Direction == EGPD_MAX || Pin->Direction == Direction))
+        FPinTable* Table = Tables.Find(Node);
+        const bool bCached = Table && Table->NumPins == Node->Pins.Num();
+        if (!bCached)
+        {
+            Table = &Tables.FindOrAdd(Node);
+            BuildTable(Node, *Table);
+        }
+        Found = Resolve(Node, *Table, PinName, Direction, bStale);
+
+        // Pins may have been rebuilt in place since the table was cached; a stale slot or a miss gets one fresh try
+        if (bCached && (bStale || !Found))
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
+            BuildTable(Node, *Table);
+            Found = Resolve(Node, *Table, PinName, Direction, bStale);
         }
     }
-    
+    else
+    {
+        FPinTable Table;
+        BuildTable(Node, Table);
+        Found = Resolve(Node, Table, PinName, Direction, bStale);
+    }
+
+    if (Found)
+    {
+        return Found;
+    }
+
     // If we're looking for a component output and didn't find it by name, try to find the first data output pin
     if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
     {
@@ -855,13 +988,23 @@ UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& P
         {
             if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
             {
-                UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
+                UE_LOG(LogTemp, Display, TEXT("FindPin: using fallback data output pin '%s' for '%s'"), *Pin->PinName.ToString(), *PinName);
                 return Pin;
             }
         }
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
+
+    // Diagnostics only on failure
+    FString Available;
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin)
+        {
+            Available += FString::Printf(TEXT(" '%s'(%s)"), *Pin->PinName.ToString(), Pin->Direction == EGPD_Input ? TEXT("in") : TEXT("out"));
+        }
+    }
+    UE_LOG(LogTemp, Warning, TEXT("FindPin: no pin '%s' (Direction: %d) on node '%s'. Available:%s"),
+           *PinName, (int32)Direction, *Node->GetName(), *Available);
     return nullptr;
 }
 
@@ -960,399 +1103,8 @@ UK2Node_Event* FUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, con
 bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                      const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
 {
-    if (!Object)
-    {
-        OutErrorMessage = TEXT("Invalid object");
-        return false;
-    }
-
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
-    {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
-    }
-
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
-    {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
-        return true;
-    }
-    else if (Property->IsA<FIntProperty>())
-    {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
-        {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
-    {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
-        return true;
-    }
-    else if (Property->IsA<FByteProperty>())
-    {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-        else
-        {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FEnumProperty>())
-    {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-    }
-    
-    OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"),
-                                    *Property->GetClass()->GetName(), *PropertyName);
-    return false;
-}
-
-static TSharedPtr<FJsonValue> UnrealMcpPropertyValueToJson(FProperty* Property, void* PropertyAddr, FString& OutErrorMessage, bool& bOutSupported)
-{
-    bOutSupported = true;
-
-    if (!Property)
-    {
-        bOutSupported = false;
-        OutErrorMessage = TEXT("Invalid property");
-        return MakeShared<FJsonValueNull>();
-    }
-
-    if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-    {
-        return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(PropertyAddr));
-    }
-
-    if (FNumericProperty* NumProp = CastField<FNumericProperty>(Property))
-    {
-        if (NumProp->IsInteger())
-        {
-            const int64 V = NumProp->GetSignedIntPropertyValue(PropertyAddr);
-            return MakeShared<FJsonValueNumber>((double)V);
-        }
-        if (NumProp->IsFloatingPoint())
-        {
-            const double V = NumProp->GetFloatingPointPropertyValue(PropertyAddr);
-            return MakeShared<FJsonValueNumber>(V);
-        }
-    }
-
-    if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
-    {
-        return MakeShared<FJsonValueString>(StrProp->GetPropertyValue(PropertyAddr));
-    }
-
-    if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
-    {
-        return MakeShared<FJsonValueString>(NameProp->GetPropertyValue(PropertyAddr).ToString());
-    }
-
-    if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
-    {
-        return MakeShared<FJsonValueString>(TextProp->GetPropertyValue(PropertyAddr).ToString());
-    }
-
-    if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
-    {
-        UEnum* EnumDef = ByteProp->GetIntPropertyEnum();
-        const uint8 V = ByteProp->GetPropertyValue(PropertyAddr);
-
-        if (EnumDef)
-        {
-            const FString Name = EnumDef->GetNameStringByValue((int64)V);
-            TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-            Obj->SetStringField(TEXT("name"), Name);
-            Obj->SetNumberField(TEXT("value"), (double)V);
-            Obj->SetStringField(TEXT("enum"), EnumDef->GetName());
-            return MakeShared<FJsonValueObject>(Obj);
-        }
-
-        return MakeShared<FJsonValueNumber>((double)V);
-    }
-
-    if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-    {
-        UEnum* EnumDef = EnumProp->GetEnum();
-        FNumericProperty* Underlying = EnumProp->GetUnderlyingProperty();
-        if (EnumDef && Underlying)
-        {
-            const int64 V = Underlying->GetSignedIntPropertyValue(PropertyAddr);
-            const FString Name = EnumDef->GetNameStringByValue(V);
-            TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-            Obj->SetStringField(TEXT("name"), Name);
-            Obj->SetNumberField(TEXT("value"), (double)V);
-            Obj->SetStringField(TEXT("enum"), EnumDef->GetName());
-            return MakeShared<FJsonValueObject>(Obj);
-        }
-    }
-
-    if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-    {
-        if (StructProp->Struct == TBaseStructure<FVector>::Get())
-        {
-            const FVector* V = (const FVector*)PropertyAddr;
-            TArray<TSharedPtr<FJsonValue>> Arr;
-            Arr.Add(MakeShared<FJsonValueNumber>(V->X));
-            Arr.Add(MakeShared<FJsonValueNumber>(V->Y));
-            Arr.Add(MakeShared<FJsonValueNumber>(V->Z));
-            return MakeShared<FJsonValueArray>(Arr);
-        }
-        if (StructProp->Struct == TBaseStructure<FRotator>::Get())
-        {
-            const FRotator* R = (const FRotator*)PropertyAddr;
-            TArray<TSharedPtr<FJsonValue>> Arr;
-            Arr.Add(MakeShared<FJsonValueNumber>(R->Pitch));
-            Arr.Add(MakeShared<FJsonValueNumber>(R->Yaw));
-            Arr.Add(MakeShared<FJsonValueNumber>(R->Roll));
-            return MakeShared<FJsonValueArray>(Arr);
-        }
-        if (StructProp->Struct == TBaseStructure<FVector2D>::Get())
-        {
-            const FVector2D* V = (const FVector2D*)PropertyAddr;
-            TArray<TSharedPtr<FJsonValue>> Arr;
-            Arr.Add(MakeShared<FJsonValueNumber>(V->X));
-            Arr.Add(MakeShared<FJsonValueNumber>(V->Y));
-            return MakeShared<FJsonValueArray>(Arr);
-        }
-        if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
-        {
-            const FLinearColor* C = (const FLinearColor*)PropertyAddr;
-            TArray<TSharedPtr<FJsonValue>> Arr;
-            Arr.Add(MakeShared<FJsonValueNumber>(C->R));
-            Arr.Add(MakeShared<FJsonValueNumber>(C->G));
-            Arr.Add(MakeShared<FJsonValueNumber>(C->B));
-            Arr.Add(MakeShared<FJsonValueNumber>(C->A));
-            return MakeShared<FJsonValueArray>(Arr);
-        }
-        if (StructProp->Struct == TBaseStructure<FTransform>::Get())
-        {
-            const FTransform* T = (const FTransform*)PropertyAddr;
-            const FVector L = T->GetLocation();
-            const FRotator Rot = T->GetRotation().Rotator();
-            const FVector S = T->GetScale3D();
-
-            TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-
-            TArray<TSharedPtr<FJsonValue>> Loc;
-            Loc.Add(MakeShared<FJsonValueNumber>(L.X));
-            Loc.Add(MakeShared<FJsonValueNumber>(L.Y));
-            Loc.Add(MakeShared<FJsonValueNumber>(L.Z));
-            Obj->SetArrayField(TEXT("location"), Loc);
-
-            TArray<TSharedPtr<FJsonValue>> RotArr;
-            RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Pitch));
-            RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Yaw));
-            RotArr.Add(MakeShared<FJsonValueNumber>(Rot.Roll));
-            Obj->SetArrayField(TEXT("rotation"), RotArr);
-
-            TArray<TSharedPtr<FJsonValue>> Scale;
-            Scale.Add(MakeShared<FJsonValueNumber>(S.X));
-            Scale.Add(MakeShared<FJsonValueNumber>(S.Y));
-            Scale.Add(MakeShared<FJsonValueNumber>(S.Z));
-            Obj->SetArrayField(TEXT("scale"), Scale);
-
-            return MakeShared<FJsonValueObject>(Obj);
-
-        }
-
-        // Fallback: export as text
-        bOutSupported = false;
-    }
-
-    if (FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Property))
-    {
-        UObject* Obj = ObjProp->GetObjectPropertyValue(PropertyAddr);
-        if (!Obj)
-        {
-            return MakeShared<FJsonValueNull>();
-        }
-        return MakeShared<FJsonValueString>(Obj->GetPathName());
-    }
-
-    if (FSoftObjectProperty* SoftObjProp = CastField<FSoftObjectProperty>(Property))
-    {
-        const FSoftObjectPtr* Ptr = (const FSoftObjectPtr*)PropertyAddr;
-        return MakeShared<FJsonValueString>(Ptr->ToSoftObjectPath().ToString());
-    }
-
-    if (FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(Property))
-    {
-        const FSoftObjectPtr* Ptr = (const FSoftObjectPtr*)PropertyAddr;
-        return MakeShared<FJsonValueString>(Ptr->ToSoftObjectPath().ToString());
-    }
-
-    if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
-    {
-        FScriptArrayHelper Helper(ArrayProp, PropertyAddr);
-        TArray<TSharedPtr<FJsonValue>> Out;
-        Out.Reserve(Helper.Num());
-        for (int32 i = 0; i < Helper.Num(); i++)
-        {
-            void* ElemAddr = Helper.GetRawPtr(i);
-            bool bElemSupported = true;
-            FString ElemErr;
-            Out.Add(UnrealMcpPropertyValueToJson(ArrayProp->Inner, ElemAddr, ElemErr, bElemSupported));
-            if (!bElemSupported)
-            {
-                // keep going; we'll provide export_text at the top-level
-                bOutSupported = false;
-            }
-        }
-        return MakeShared<FJsonValueArray>(Out);
-    }
-
-    // Last resort: export text (stable for most properties)
-    bOutSupported = false;
-    return MakeShared<FJsonValueNull>();
+    // PropertyName may be a nested path ("Mesh.BodyInstance.MassScale", "Tags[2]"); resolution is cached per class
+    return FUnrealMCPPropertyPath::Get().SetValue(Object, PropertyName, Value, OutErrorMessage);
 }
 
 bool FUnrealMCPCommonUtils::GetObjectProperty(UObject* Object, const FString& PropertyName,
@@ -1364,34 +1116,27 @@ bool FUnrealMCPCommonUtils::GetObjectProperty(UObject* Object, const FString& Pr
     OutValue = MakeShared<FJsonValueNull>();
     OutErrorMessage.Empty();
 
-    if (!Object)
-    {
-        OutErrorMessage = TEXT("Invalid object");
-        return false;
-    }
-
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
+    FUnrealMCPPropertyPath::FResolved Resolved;
+    if (!FUnrealMCPPropertyPath::Get().Resolve(Object, PropertyName, false, Resolved, OutErrorMessage))
     {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
         return false;
     }
 
     if (OutCppType)
-        *OutCppType = Property->GetCPPType();
+        *OutCppType = Resolved.Property->GetCPPType();
 
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
+    bool bSupported = true;
+    TSharedPtr<FJsonValue> Value = FUnrealMCPPropertyPath::Read(Resolved, bSupported);
 
+    // Export text is only built when asked for or needed as the fallback
     FString ExportText;
-    Property->ExportTextItem_Direct(ExportText, PropertyAddr, nullptr, Object, PPF_None);
-
+    if (OutExportText || !bSupported)
+    {
+        Resolved.Property->ExportTextItem_Direct(ExportText, Resolved.ValuePtr, nullptr, Resolved.Owner, PPF_None);
+    }
     if (OutExportText)
         *OutExportText = ExportText;
 
-    bool bSupported = true;
-    FString ConvErr;
-    TSharedPtr<FJsonValue> Value = UnrealMcpPropertyValueToJson(Property, PropertyAddr, ConvErr, bSupported);
-
     if (bSupported)
     {
         OutValue = Value;
@@ -1402,7 +1147,7 @@ bool FUnrealMCPCommonUtils::GetObjectProperty(UObject* Object, const FString& Pr
     TSharedPtr<FJsonObject> Fallback = MakeShared<FJsonObject>();
     Fallback->SetStringField(TEXT("format"), TEXT("export_text"));
     Fallback->SetStringField(TEXT("export_text"), ExportText);
-    Fallback->SetStringField(TEXT("cpp_type"), Property->GetCPPType());
+    Fallback->SetStringField(TEXT("cpp_type"), Resolved.Property->GetCPPType());
     OutValue = MakeShared<FJsonValueObject>(Fallback);
     return true;
 }
@@ -1411,7 +1156,8 @@ bool FUnrealMCPCommonUtils::ExportObjectProperties(UObject* Object,
     const TArray<FString>& PropertyNames,
     TSharedPtr<FJsonObject>& OutProps,
     FString& OutErrorMessage,
-    bool bOnlyEditable)
+    bool bOnlyEditable,
+    UObject* Baseline)
 {
     OutProps = MakeShared<FJsonObject>();
     OutErrorMessage.Empty();
@@ -1457,6 +1203,9 @@ bool FUnrealMCPCommonUtils::ExportObjectProperties(UObject* Object,
             if (!ShouldExport(Prop))
                 continue;
 
+            if (Baseline && FUnrealMCPPropertyPath::Get().IsIdentical(Object, Baseline, Name))
+                continue;
+
             TSharedPtr<FJsonValue> V;
             FString Err;
             FString CppType;
@@ -1476,22 +1225,48 @@ bool FUnrealMCPCommonUtils::ExportObjectProperties(UObject* Object,
         return true;
     }
 
-    // Export all
-    for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+    // Export all: the filtered property list is cached per class
+    FUnrealMCPPropertyPath::Get().ExportAll(Object, bOnlyEditable, OutProps, Baseline);
+    return true;
+}
+
+bool FUnrealMCPCommonUtils::AddNonDefaultProperties(UObject* Object, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonObject>& ResultObj)
+{
+    bool bNonDefaultOnly = false;
+    bool bIncludeHash = false;
+    bool bOnlyEditable = true;
+    if (Params.IsValid())
     {
-        FProperty* Prop = *It;
-        if (!ShouldExport(Prop))
-            continue;
+        Params->TryGetBoolField(TEXT("non_default_only"), bNonDefaultOnly);
+        Params->TryGetBoolField(TEXT("include_hash"), bIncludeHash);
+        Params->TryGetBoolField(TEXT("only_editable"), bOnlyEditable);
+    }
 
-        const FString Name = Prop->GetName();
-        TSharedPtr<FJsonValue> V;
+    if (!Object || !ResultObj.IsValid())
+    {
+        return false;
+    }
+
+    if (bNonDefaultOnly)
+    {
+        UObject* Baseline = Object->GetArchetype();
+        TSharedPtr<FJsonObject> Props;
         FString Err;
-        if (GetObjectProperty(Object, Name, V, Err, nullptr, nullptr))
+        ExportObjectProperties(Object, TArray<FString>(), Props, Err, bOnlyEditable, Baseline);
+        ResultObj->SetObjectField(TEXT("properties"), Props);
+        ResultObj->SetNumberField(TEXT("non_default_count"), Props->Values.Num());
+        if (Baseline)
         {
-            OutProps->SetField(Name, V);
+            ResultObj->SetStringField(TEXT("baseline"), Baseline->GetPathName());
         }
     }
 
-    return true;
+    if (bIncludeHash)
+    {
+        // Hash of the full state, not just the delta, so two objects can be compared without exporting either
+        ResultObj->SetStringField(TEXT("state_hash"), FString::Printf(TEXT("%08x"), FUnrealMCPPropertyPath::Get().HashState(Object, bOnlyEditable)));
+    }
+
+    return bNonDefaultOnly;
 }
 
@@ -0,0 +1,458 @@
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPBlueprintFingerprint.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Logging/TokenizedMessage.h"
+
+namespace UnrealMcpCompileQueue
+{
+	/** Seconds without new edits before deferred compiles run on their own. */
+	static constexpr double IdleFlushSeconds = 2.0;
+
+	/** Finished batch compile jobs kept around for status queries. */
+	static constexpr int32 MaxFinishedBatchJobs = 8;
+
+	/** Idle-flush results kept until the next response picks them up. */
+	static constexpr int32 MaxIdleFlushResults = 64;
+}
+
+FUnrealMCPCompileQueue& FUnrealMCPCompileQueue::Get()
+{
+	static FUnrealMCPCompileQueue Instance;
+	return Instance;
+}
+
+bool FUnrealMCPCompileQueue::IsDeferrableCommand(const FString& CommandType)
+{
+	static const TSet<FString> Deferrable = {
+		TEXT("add_component_to_blueprint"),
+		TEXT("add_blueprint_variable"),
+		TEXT("set_component_property"),
+		TEXT("set_component_properties"),
+		TEXT("set_physics_properties"),
+		TEXT("set_static_mesh_properties"),
+		TEXT("connect_blueprint_nodes"),
+		TEXT("add_blueprint_get_self_component_reference"),
+		TEXT("add_blueprint_self_reference"),
+		TEXT("add_blueprint_event_node"),
+		TEXT("add_blueprint_input_action_node"),
+		TEXT("add_blueprint_function_node"),
+		TEXT("add_blueprint_get_component_node"),
+		TEXT("add_construction_script_node"),
+		TEXT("apply_blueprint_graph_patch"),
+		TEXT("build_widget_tree")
+	};
+	return Deferrable.Contains(CommandType);
+}
+
+void FUnrealMCPCompileQueue::MarkDirty(UBlueprint* Blueprint, ECompileLevel Level)
+{
+	check(IsInGameThread());
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	// Cheap: dirties the package and bumps the status without regenerating anything (once per batch
+	// inside a single-transaction batch).
+	FUnrealMCPBatchTransaction::Get().MarkBlueprintModified(Blueprint);
+
+	FPendingCompile* Existing = Pending.FindByPredicate([Blueprint](const FPendingCompile& Entry)
+	{
+		return Entry.Blueprint.Get() == Blueprint;
+	});
+	if (!Existing)
+	{
+		Existing = &Pending.AddDefaulted_GetRef();
+		Existing->Blueprint = Blueprint;
+		Existing->Level = Level;
+	}
+	else if (Level > Existing->Level)
+	{
+		Existing->Level = Level;
+	}
+	++Existing->EditCount;
+
+	LastMarkTime = FPlatformTime::Seconds();
+	ScheduleIdleFlush();
+}
+
+void FUnrealMCPCompileQueue::Remove(UBlueprint* Blueprint)
+{
+	Pending.RemoveAll([Blueprint](const FPendingCompile& Entry)
+	{
+		return !Entry.Blueprint.IsValid() || Entry.Blueprint.Get() == Blueprint;
+	});
+}
+
+void FUnrealMCPCompileQueue::ScheduleIdleFlush()
+{
+	if (IdleFlushHandle.IsValid())
+	{
+		return;
+	}
+
+	IdleFlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+	{
+		if (Pending.Num() == 0)
+		{
+			IdleFlushHandle.Reset();
+			return false;
+		}
+		if (FPlatformTime::Seconds() - LastMarkTime < UnrealMcpCompileQueue::IdleFlushSeconds)
+		{
+			return true;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>> Results = Flush();
+		int32 NumFailed = 0;
+		for (const TSharedPtr<FJsonValue>& Result : Results)
+		{
+			if (!Result->AsObject()->GetBoolField(TEXT("compile_success")))
+			{
+				++NumFailed;
+			}
+		}
+		if (NumFailed > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealMCP: Idle flush compiled %d deferred Blueprint(s), %d failed"), Results.Num(), NumFailed);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("UnrealMCP: Idle flush compiled %d deferred Blueprint(s)"), Results.Num());
+		}
+
+		// No request is waiting on these; keep them for the next response so clients still see the errors.
+		IdleFlushResults.Append(Results);
+		if (IdleFlushResults.Num() > UnrealMcpCompileQueue::MaxIdleFlushResults)
+		{
+			IdleFlushResults.RemoveAt(0, IdleFlushResults.Num() - UnrealMcpCompileQueue::MaxIdleFlushResults);
+		}
+
+		IdleFlushHandle.Reset();
+		return false;
+	}), 0.5f);
+}
+
+TArray<TSharedPtr<FJsonValue>> FUnrealMCPCompileQueue::TakeIdleFlushResults()
+{
+	return MoveTemp(IdleFlushResults);
+}
+
+TArray<TSharedPtr<FJsonValue>> FUnrealMCPCompileQueue::Flush()
+{
+	check(IsInGameThread());
+
+	TArray<TSharedPtr<FJsonValue>> Results;
+	if (Pending.Num() == 0)
+	{
+		return Results;
+	}
+
+	// Compiling resets the status, so deferred modified notifications must land first.
+	FUnrealMCPBatchTransaction::Get().FlushModified();
+
+	// Swap out first: compiling can trigger editor callbacks that mark other Blueprints.
+	TArray<FPendingCompile> ToCompile = MoveTemp(Pending);
+	Pending.Reset();
+
+	for (const FPendingCompile& Entry : ToCompile)
+	{
+		UBlueprint* Blueprint = Entry.Blueprint.Get();
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+		Item->SetStringField(TEXT("blueprint"), Blueprint->GetPathName());
+		Item->SetNumberField(TEXT("coalesced_edits"), Entry.EditCount);
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (Entry.Level == ECompileLevel::Skeleton)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+			Item->SetStringField(TEXT("level"), TEXT("skeleton"));
+			Item->SetBoolField(TEXT("compile_success"), true);
+		}
+		else
+		{
+			FCompilerResultsLog CompileResults;
+			CompileResults.SetSourcePath(Blueprint->GetPathName());
+			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompileResults);
+			FUnrealMCPBlueprintFingerprint::Get().RecordCompile(Blueprint, FUnrealMCPBlueprintFingerprint::Compute(Blueprint));
+
+			Item->SetStringField(TEXT("level"), TEXT("full"));
+			Item->SetBoolField(TEXT("compile_success"), CompileResults.NumErrors == 0);
+			Item->SetNumberField(TEXT("num_errors"), CompileResults.NumErrors);
+			Item->SetNumberField(TEXT("num_warnings"), CompileResults.NumWarnings);
+
+			TArray<TSharedPtr<FJsonValue>> Diagnostics;
+			for (const TSharedRef<FTokenizedMessage>& Msg : CompileResults.Messages)
+			{
+				const EMessageSeverity::Type Severity = Msg->GetSeverity();
+				if (Severity == EMessageSeverity::Error || Severity == EMessageSeverity::Warning)
+				{
+					TSharedPtr<FJsonObject> D = MakeShared<FJsonObject>();
+					D->SetStringField(TEXT("message"), Msg->ToText().ToString());
+					D->SetStringField(TEXT("severity"), Severity == EMessageSeverity::Error ? TEXT("error") : TEXT("warning"));
+					Diagnostics.Add(MakeShared<FJsonValueObject>(D));
+				}
+			}
+			if (Diagnostics.Num() > 0)
+			{
+				Item->SetArrayField(TEXT("diagnostics"), Diagnostics);
+			}
+		}
+		Item->SetNumberField(TEXT("compile_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		Results.Add(MakeShared<FJsonValueObject>(Item));
+	}
+
+	return Results;
+}
+
+TSharedPtr<FUnrealMCPCompileQueue::FBatchCompileJob> FUnrealMCPCompileQueue::MakeBatchJob(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce)
+{
+	TSharedPtr<FBatchCompileJob> Job = MakeShared<FBatchCompileJob>();
+	Job->Id = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	Job->ChunkSize = FMath::Max(1, ChunkSize);
+	Job->bForce = bForce;
+	Job->StartTime = FPlatformTime::Seconds();
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		if (Blueprint)
+		{
+			// The batch compiles it; a coalesced compile afterwards would be redundant.
+			Remove(Blueprint);
+			Job->Blueprints.Add(Blueprint);
+		}
+	}
+	return Job;
+}
+
+FString FUnrealMCPCompileQueue::StartBatchCompile(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce)
+{
+	check(IsInGameThread());
+
+	TSharedPtr<FBatchCompileJob> Job = MakeBatchJob(Blueprints, ChunkSize, bForce);
+	BatchJobs.Add(Job);
+
+	// Drop the oldest finished jobs so status queries stay bounded.
+	int32 FinishedCount = 0;
+	for (int32 Index = BatchJobs.Num() - 1; Index >= 0; --Index)
+	{
+		if (BatchJobs[Index]->IsDone() && ++FinishedCount > UnrealMcpCompileQueue::MaxFinishedBatchJobs)
+		{
+			BatchJobs.RemoveAt(Index);
+		}
+	}
+
+	if (!BatchTickHandle.IsValid())
+	{
+		BatchTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+		{
+			for (const TSharedPtr<FBatchCompileJob>& Active : BatchJobs)
+			{
+				if (!Active->IsDone())
+				{
+					CompileNextChunk(*Active);
+					return true;
+				}
+			}
+			BatchTickHandle.Reset();
+			return false;
+		}));
+	}
+
+	return Job->Id;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCompileQueue::RunBatchCompile(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce)
+{
+	check(IsInGameThread());
+
+	TSharedPtr<FBatchCompileJob> Job = MakeBatchJob(Blueprints, ChunkSize, bForce);
+	while (!Job->IsDone())
+	{
+		CompileNextChunk(*Job);
+	}
+	return MakeBatchStatus(*Job);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCompileQueue::GetBatchCompileStatus(const FString& JobId) const
+{
+	for (const TSharedPtr<FBatchCompileJob>& Job : BatchJobs)
+	{
+		if (Job->Id == JobId)
+		{
+			return MakeBatchStatus(*Job);
+		}
+	}
+	return nullptr;
+}
+
+void FUnrealMCPCompileQueue::CompileNextChunk(FBatchCompileJob& Job)
+{
+	const int32 First = Job.NextIndex;
+	const int32 Last = FMath::Min(First + Job.ChunkSize, Job.Blueprints.Num());
+	Job.NextIndex = Last;
+
+	TArray<UBlueprint*> ChunkBlueprints;
+	for (int32 Index = First; Index < Last; ++Index)
+	{
+		UBlueprint* Blueprint = Job.Blueprints[Index].Get();
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		const FString Fingerprint = FUnrealMCPBlueprintFingerprint::Compute(Blueprint);
+		if (!Job.bForce && FUnrealMCPBlueprintFingerprint::Get().IsCompileUpToDate(Blueprint, Fingerprint))
+		{
+			TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+			Item->SetStringField(TEXT("name"), Blueprint->GetName());
+			Item->SetStringField(TEXT("resolved_asset_path"), Blueprint->GetPathName());
+			Item->SetBoolField(TEXT("compiled"), false);
+			Item->SetBoolField(TEXT("skipped"), true);
+			Item->SetBoolField(TEXT("compile_success"), true);
+			Item->SetNumberField(TEXT("num_errors"), 0);
+			Item->SetNumberField(TEXT("num_warnings"), 0);
+			Item->SetArrayField(TEXT("diagnostics"), TArray<TSharedPtr<FJsonValue>>());
+			Item->SetStringField(TEXT("fingerprint"), Fingerprint);
+			Job.Items.Add(MakeShared<FJsonValueObject>(Item));
+			continue;
+		}
+
+		FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+		ChunkBlueprints.Add(Blueprint);
+	}
+
+	// One flush per chunk: the manager orders dependencies and reinstances the whole set once.
+	const double ChunkStart = FPlatformTime::Seconds();
+	FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+	const double ChunkMs = (FPlatformTime::Seconds() - ChunkStart) * 1000.0;
+
+	const int32 ChunkIndex = Job.Chunks.Num();
+	TSharedPtr<FJsonObject> ChunkObj = MakeShared<FJsonObject>();
+	ChunkObj->SetNumberField(TEXT("index"), ChunkIndex);
+	ChunkObj->SetNumberField(TEXT("count"), ChunkBlueprints.Num());
+	ChunkObj->SetNumberField(TEXT("compile_ms"), ChunkMs);
+	Job.Chunks.Add(MakeShared<FJsonValueObject>(ChunkObj));
+
+	for (UBlueprint* Blueprint : ChunkBlueprints)
+	{
+		// The queued path has no per-Blueprint results log; node compiler messages carry the same diagnostics.
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+		TArray<TSharedPtr<FJsonValue>> Diagnostics;
+
+		TArray<UEdGraph*> Graphs;
+		Blueprint->GetAllGraphs(Graphs);
+		for (const UEdGraph* Graph : Graphs)
+		{
+			if (!Graph)
+			{
+				continue;
+			}
+			for (const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node || !Node->bHasCompilerMessage)
+				{
+					continue;
+				}
+
+				FString Severity = TEXT("info");
+				if (Node->ErrorType <= EMessageSeverity::Error)
+				{
+					Severity = TEXT("error");
+					++NumErrors;
+				}
+				else if (Node->ErrorType <= EMessageSeverity::Warning)
+				{
+					Severity = TEXT("warning");
+					++NumWarnings;
+				}
+
+				TSharedPtr<FJsonObject> D = MakeShared<FJsonObject>();
+				D->SetStringField(TEXT("message"), Node->ErrorMsg);
+				D->SetStringField(TEXT("severity"), Severity);
+				D->SetStringField(TEXT("node"), Node->GetName());
+				D->SetStringField(TEXT("graph"), Graph->GetName());
+				Diagnostics.Add(MakeShared<FJsonValueObject>(D));
+			}
+		}
+
+		const bool bCompileOk = Blueprint->Status != BS_Error;
+		if (!bCompileOk && NumErrors == 0)
+		{
+			TSharedPtr<FJsonObject> D = MakeShared<FJsonObject>();
+			D->SetStringField(TEXT("message"), TEXT("Blueprint failed to compile; see the Compiler Results log"));
+			D->SetStringField(TEXT("severity"), TEXT("error"));
+			Diagnostics.Add(MakeShared<FJsonValueObject>(D));
+			NumErrors = 1;
+		}
+
+		const FString Fingerprint = FUnrealMCPBlueprintFingerprint::Compute(Blueprint);
+		FUnrealMCPBlueprintFingerprint::Get().RecordCompile(Blueprint, Fingerprint);
+
+		TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+		Item->SetStringField(TEXT("name"), Blueprint->GetName());
+		Item->SetStringField(TEXT("resolved_asset_path"), Blueprint->GetPathName());
+		Item->SetStringField(TEXT("fingerprint"), Fingerprint);
+		Item->SetBoolField(TEXT("compiled"), true);
+		Item->SetBoolField(TEXT("compile_success"), bCompileOk);
+		Item->SetNumberField(TEXT("num_errors"), NumErrors);
+		Item->SetNumberField(TEXT("num_warnings"), NumWarnings);
+		Item->SetArrayField(TEXT("diagnostics"), Diagnostics);
+		Item->SetNumberField(TEXT("chunk"), ChunkIndex);
+		// Exact for chunk_size 1; otherwise the chunk's time split evenly across its Blueprints
+		Item->SetNumberField(TEXT("compile_ms"), ChunkMs / FMath::Max(1, ChunkBlueprints.Num()));
+		Job.Items.Add(MakeShared<FJsonValueObject>(Item));
+	}
+
+	if (Job.IsDone())
+	{
+		Job.EndTime = FPlatformTime::Seconds();
+		UE_LOG(LogTemp, Log, TEXT("UnrealMCP: Batch compile %s finished: %d Blueprint(s) in %.1f ms"),
+			*Job.Id, Job.Items.Num(), (Job.EndTime - Job.StartTime) * 1000.0);
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCompileQueue::MakeBatchStatus(const FBatchCompileJob& Job)
+{
+	int32 Failed = 0;
+	int32 Skipped = 0;
+	for (const TSharedPtr<FJsonValue>& Item : Job.Items)
+	{
+		if (!Item->AsObject()->GetBoolField(TEXT("compile_success")))
+		{
+			++Failed;
+		}
+		if (Item->AsObject()->HasField(TEXT("skipped")))
+		{
+			++Skipped;
+		}
+	}
+
+	const double EndTime = Job.IsDone() ? Job.EndTime : FPlatformTime::Seconds();
+
+	TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+	Status->SetStringField(TEXT("job_id"), Job.Id);
+	Status->SetStringField(TEXT("state"), Job.IsDone() ? TEXT("done") : TEXT("running"));
+	Status->SetNumberField(TEXT("total"), Job.Blueprints.Num());
+	Status->SetNumberField(TEXT("completed"), Job.Items.Num());
+	Status->SetNumberField(TEXT("failed"), Failed);
+	Status->SetNumberField(TEXT("skipped"), Skipped);
+	Status->SetNumberField(TEXT("chunk_size"), Job.ChunkSize);
+	Status->SetNumberField(TEXT("wall_time_ms"), (EndTime - Job.StartTime) * 1000.0);
+	Status->SetArrayField(TEXT("chunks"), Job.Chunks);
+	Status->SetArrayField(TEXT("items"), Job.Items);
+	return Status;
+}
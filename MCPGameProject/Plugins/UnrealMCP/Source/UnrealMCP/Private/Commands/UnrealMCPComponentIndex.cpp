@@ -0,0 +1,156 @@
+#include "Commands/UnrealMCPComponentIndex.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "UObject/UnrealType.h"
+
+namespace UnrealMcpComponentIndex
+{
+	static bool IsLiveNode(const USCS_Node* Node, const USimpleConstructionScript* SCS, FName VariableName)
+	{
+		return IsValid(Node) && Node->GetSCS() == SCS && Node->GetVariableName() == VariableName;
+	}
+}
+
+FUnrealMCPComponentIndex& FUnrealMCPComponentIndex::Get()
+{
+	static FUnrealMCPComponentIndex Instance;
+	return Instance;
+}
+
+FUnrealMCPComponentIndex::FEntry* FUnrealMCPComponentIndex::FindOrBuildEntry(UBlueprint* Blueprint)
+{
+	USimpleConstructionScript* SCS = Blueprint ? Blueprint->SimpleConstructionScript.Get() : nullptr;
+	if (!SCS)
+	{
+		return nullptr;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(TObjectKey<UBlueprint>(Blueprint));
+	if (!Entry.Blueprint.IsValid())
+	{
+		Entry.Blueprint = Blueprint;
+		Entry.bDirty = true;
+		Entry.BlueprintChangedHandle = Blueprint->OnChanged().AddRaw(this, &FUnrealMCPComponentIndex::OnBlueprintChanged);
+	}
+
+	// Nodes added or removed from code don't broadcast OnChanged, but they do change the count
+	if (Entry.bDirty || Entry.SCS.Get() != SCS || Entry.NumNodes != SCS->GetAllNodes().Num())
+	{
+		Rebuild(Entry);
+	}
+	return &Entry;
+}
+
+void FUnrealMCPComponentIndex::Rebuild(FEntry& Entry)
+{
+	Entry.Nodes.Reset();
+	Entry.Order.Reset();
+	Entry.NumNodes = 0;
+	Entry.bDirty = false;
+
+	UBlueprint* Blueprint = Entry.Blueprint.Get();
+	USimpleConstructionScript* SCS = Blueprint ? Blueprint->SimpleConstructionScript.Get() : nullptr;
+	Entry.SCS = SCS;
+	if (!SCS)
+	{
+		return;
+	}
+
+	const TArray<USCS_Node*>& AllNodes = SCS->GetAllNodes();
+	Entry.NumNodes = AllNodes.Num();
+	Entry.Order.Reserve(AllNodes.Num());
+	for (USCS_Node* Node : AllNodes)
+	{
+		if (!Node)
+		{
+			continue;
+		}
+		const FName VariableName = Node->GetVariableName();
+		if (!Entry.Nodes.Contains(VariableName))
+		{
+			Entry.Nodes.Add(VariableName, Node);
+			Entry.Order.Add(VariableName);
+		}
+	}
+}
+
+void FUnrealMCPComponentIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Entries.Find(TObjectKey<UBlueprint>(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FUnrealMCPComponentIndex::Invalidate(UBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Entries.Find(TObjectKey<UBlueprint>(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+USCS_Node* FUnrealMCPComponentIndex::FindNode(UBlueprint* Blueprint, FName VariableName)
+{
+	check(IsInGameThread());
+	if (VariableName.IsNone())
+	{
+		return nullptr;
+	}
+
+	FEntry* Entry = FindOrBuildEntry(Blueprint);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	USimpleConstructionScript* SCS = Entry->SCS.Get();
+	const TWeakObjectPtr<USCS_Node>* Found = Entry->Nodes.Find(VariableName);
+	USCS_Node* Node = Found ? Found->Get() : nullptr;
+	if (UnrealMcpComponentIndex::IsLiveNode(Node, SCS, VariableName))
+	{
+		return Node;
+	}
+
+	// Miss or stale hit: renamed, added or destroyed without a notification. Rebuild once and retry.
+	Rebuild(*Entry);
+	Found = Entry->Nodes.Find(VariableName);
+	Node = Found ? Found->Get() : nullptr;
+	return UnrealMcpComponentIndex::IsLiveNode(Node, Entry->SCS.Get(), VariableName) ? Node : nullptr;
+}
+
+void FUnrealMCPComponentIndex::GetNodeNames(UBlueprint* Blueprint, TArray<FName>& OutNames)
+{
+	check(IsInGameThread());
+	OutNames.Reset();
+	if (FEntry* Entry = FindOrBuildEntry(Blueprint))
+	{
+		OutNames = Entry->Order;
+	}
+}
+
+const TArray<FString>& FUnrealMCPComponentIndex::GetPropertyDescriptions(const UClass* Class)
+{
+	check(IsInGameThread());
+	const bool bCache = Class && Class->HasAnyClassFlags(CLASS_Native);
+	if (bCache)
+	{
+		if (const TArray<FString>* Cached = PropertyDescriptions.Find(TObjectKey<UClass>(Class)))
+		{
+			return *Cached;
+		}
+	}
+
+	TArray<FString>& Out = bCache ? PropertyDescriptions.Add(TObjectKey<UClass>(Class)) : Scratch;
+	Out.Reset();
+	if (Class)
+	{
+		for (TFieldIterator<FProperty> PropIt(Class); PropIt; ++PropIt)
+		{
+			Out.Add(FString::Printf(TEXT("%s (%s)"), *PropIt->GetName(), *PropIt->GetCPPType()));
+		}
+		Out.Sort();
+	}
+	return Out;
+}
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPPropertyPath.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -60,6 +61,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleSetActorProperty(Params);
     }
+    else if (CommandType == TEXT("get_objects_properties"))
+    {
+        return HandleGetObjectsProperties(Params);
+    }
     // Blueprint actor spawning
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
@@ -330,7 +335,9 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const
     }
 
     // Always return detailed properties for this command
-    return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    FUnrealMCPCommonUtils::AddNonDefaultProperties(TargetActor, Params, ResultObj);
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params)
@@ -396,6 +403,117 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     }
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetObjectsProperties(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* ObjectsJson = nullptr;
+    if (!Params->TryGetArrayField(TEXT("objects"), ObjectsJson) || ObjectsJson->Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            TEXT("Missing 'objects' parameter"),
+            TEXT("ERR_BAD_REQUEST"),
+            TEXT("objects: [actor name or label | object path | Blueprint asset path]"));
+    }
+
+    TArray<FString> PropertyNames;
+    const TArray<TSharedPtr<FJsonValue>>* PropertiesJson = nullptr;
+    if (Params->TryGetArrayField(TEXT("properties"), PropertiesJson))
+    {
+        for (const TSharedPtr<FJsonValue>& V : *PropertiesJson)
+        {
+            PropertyNames.Add(V->AsString());
+        }
+    }
+
+    bool bOnlyEditable = true;
+    Params->TryGetBoolField(TEXT("only_editable"), bOnlyEditable);
+
+    bool bNonDefaultOnly = false;
+    bool bIncludeHash = false;
+    Params->TryGetBoolField(TEXT("non_default_only"), bNonDefaultOnly);
+    Params->TryGetBoolField(TEXT("include_hash"), bIncludeHash);
+
+    // Level actors are looked up by name and label; one pass over the level serves the whole request
+    TMap<FString, AActor*> ActorsByName;
+    bool bActorsIndexed = false;
+    auto FindActor = [&](const FString& Name) -> AActor*
+    {
+        if (!bActorsIndexed)
+        {
+            TArray<AActor*> AllActors;
+            UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+            ActorsByName.Reserve(AllActors.Num() * 2);
+            for (AActor* Actor : AllActors)
+            {
+                if (Actor)
+                {
+                    ActorsByName.Add(Actor->GetName(), Actor);
+                    ActorsByName.FindOrAdd(Actor->GetActorLabel(), Actor);
+                }
+            }
+            bActorsIndexed = true;
+        }
+        AActor** Found = ActorsByName.Find(Name);
+        return Found ? *Found : nullptr;
+    };
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    Results.Reserve(ObjectsJson->Num());
+    int32 NotFound = 0;
+
+    for (const TSharedPtr<FJsonValue>& Entry : *ObjectsJson)
+    {
+        const FString Ref = Entry->AsString();
+        TSharedPtr<FJsonObject> ItemObj = MakeShared<FJsonObject>();
+        ItemObj->SetStringField(TEXT("object"), Ref);
+
+        UObject* Target = nullptr;
+        if (Ref.StartsWith(TEXT("/")))
+        {
+            Target = StaticFindObject(UObject::StaticClass(), nullptr, *Ref);
+            if (!Target)
+            {
+                Target = FUnrealMCPCommonUtils::LoadAssetByPathSmart(Ref);
+            }
+            // Blueprint assets report their class defaults
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Target))
+            {
+                Target = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+            }
+        }
+        else if (!Ref.IsEmpty())
+        {
+            Target = FindActor(Ref);
+        }
+
+        if (!Target)
+        {
+            ItemObj->SetStringField(TEXT("error"), TEXT("Object not found"));
+            ++NotFound;
+            Results.Add(MakeShared<FJsonValueObject>(ItemObj));
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> Props;
+        FString Err;
+        FUnrealMCPCommonUtils::ExportObjectProperties(Target, PropertyNames, Props, Err, bOnlyEditable, bNonDefaultOnly ? Target->GetArchetype() : nullptr);
+
+        ItemObj->SetStringField(TEXT("path"), Target->GetPathName());
+        ItemObj->SetStringField(TEXT("class"), Target->GetClass()->GetPathName());
+        ItemObj->SetObjectField(TEXT("properties"), Props);
+        if (bIncludeHash)
+        {
+            ItemObj->SetStringField(TEXT("state_hash"), FString::Printf(TEXT("%08x"), FUnrealMCPPropertyPath::Get().HashState(Target, bOnlyEditable)));
+        }
+        Results.Add(MakeShared<FJsonValueObject>(ItemObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("objects"), Results);
+    ResultObj->SetNumberField(TEXT("count"), Results.Num());
+    ResultObj->SetNumberField(TEXT("not_found"), NotFound);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
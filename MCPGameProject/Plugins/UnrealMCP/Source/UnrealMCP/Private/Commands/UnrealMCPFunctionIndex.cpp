@@ -0,0 +1,230 @@
+#include "Commands/UnrealMCPFunctionIndex.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "UObject/UObjectIterator.h"
+#include "Algo/BinarySearch.h"
+
+namespace UnrealMcpFunctionIndex
+{
+	static bool IsIndexableClass(const UClass* Class)
+	{
+		if (!Class || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			return false;
+		}
+		// Blueprint classes change on every compile and are resolved on the Blueprint itself.
+		if (Class->IsA<UBlueprintGeneratedClass>())
+		{
+			return false;
+		}
+		const FString Name = Class->GetName();
+		return !Name.StartsWith(TEXT("SKEL_")) && !Name.StartsWith(TEXT("REINST_")) && !Name.StartsWith(TEXT("TRASH_"));
+	}
+
+	static bool IsCallable(const UFunction* Function)
+	{
+		return Function->HasAnyFunctionFlags(FUNC_BlueprintCallable | FUNC_BlueprintPure) &&
+			!Function->HasMetaData(TEXT("DeprecatedFunction")) &&
+			!Function->HasMetaData(TEXT("BlueprintInternalUseOnly"));
+	}
+}
+
+FUnrealMCPFunctionIndex& FUnrealMCPFunctionIndex::Get()
+{
+	static FUnrealMCPFunctionIndex Instance;
+	return Instance;
+}
+
+void FUnrealMCPFunctionIndex::Invalidate()
+{
+	Candidates.Reset();
+	ByKey.Reset();
+	IndexedClasses.Reset();
+	SortedKeys.Reset();
+	bSortedKeysDirty = true;
+	bBuilt = false;
+	bNeedsScan = false;
+}
+
+void FUnrealMCPFunctionIndex::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded)
+	{
+		bNeedsScan = true;
+	}
+	else if (Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		// Unloaded classes leave dangling weak pointers behind; start over.
+		Invalidate();
+	}
+}
+
+void FUnrealMCPFunctionIndex::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+}
+
+void FUnrealMCPFunctionIndex::EnsureBuilt()
+{
+	check(IsInGameThread());
+
+	if (!bDelegatesBound)
+	{
+		FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealMCPFunctionIndex::OnModulesChanged);
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUnrealMCPFunctionIndex::OnReloadComplete);
+		bDelegatesBound = true;
+	}
+
+	if (!bBuilt || bNeedsScan)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 ClassesBefore = IndexedClasses.Num();
+		IndexNewClasses();
+		bBuilt = true;
+		bNeedsScan = false;
+		UE_LOG(LogTemp, Log, TEXT("UnrealMCP: function index added %d classes (%d functions total) in %.1f ms"),
+			IndexedClasses.Num() - ClassesBefore, Candidates.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+}
+
+void FUnrealMCPFunctionIndex::IndexNewClasses()
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!IndexedClasses.Contains(Class) && UnrealMcpFunctionIndex::IsIndexableClass(Class))
+		{
+			IndexClass(Class);
+		}
+	}
+}
+
+void FUnrealMCPFunctionIndex::IndexClass(UClass* Class)
+{
+	IndexedClasses.Add(Class);
+
+	// Only functions declared on this class; inherited ones are indexed on their owner.
+	for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		UFunction* Function = *It;
+		if (!UnrealMcpFunctionIndex::IsCallable(Function))
+		{
+			continue;
+		}
+
+		const int32 Index = Candidates.AddDefaulted();
+		FCandidate& Candidate = Candidates[Index];
+		Candidate.Function = Function;
+		Candidate.OwnerClass = Class;
+		Candidate.Name = Function->GetName();
+		Candidate.DisplayName = Function->GetDisplayNameText().ToString();
+		Candidate.Category = Function->GetMetaData(TEXT("Category"));
+		Candidate.bPure = Function->HasAnyFunctionFlags(FUNC_BlueprintPure);
+		Candidate.bStatic = Function->HasAnyFunctionFlags(FUNC_Static);
+
+		const FString NameKey = Candidate.Name.ToLower();
+		const FString DisplayKey = Candidate.DisplayName.ToLower();
+		ByKey.Add(NameKey, Index);
+		SortedKeys.Emplace(NameKey, Index);
+		if (DisplayKey != NameKey)
+		{
+			ByKey.Add(DisplayKey, Index);
+			SortedKeys.Emplace(DisplayKey, Index);
+		}
+	}
+	bSortedKeysDirty = true;
+}
+
+void FUnrealMCPFunctionIndex::FindFunctions(const FString& FunctionName, UClass* TargetClass, TArray<const FCandidate*>& OutCandidates)
+{
+	EnsureBuilt();
+
+	TArray<int32, TInlineAllocator<8>> Indices;
+	ByKey.MultiFind(FunctionName.ToLower(), Indices);
+
+	TSet<const UFunction*> Seen;
+	for (int32 Index : Indices)
+	{
+		const FCandidate& Candidate = Candidates[Index];
+		const UFunction* Function = Candidate.Function.Get();
+		const UClass* OwnerClass = Candidate.OwnerClass.Get();
+		if (!Function || !OwnerClass || Seen.Contains(Function))
+		{
+			continue;
+		}
+		if (TargetClass && !TargetClass->IsChildOf(OwnerClass))
+		{
+			continue;
+		}
+		Seen.Add(Function);
+		OutCandidates.Add(&Candidate);
+	}
+}
+
+void FUnrealMCPFunctionIndex::Search(const FString& Query, UClass* TargetClass, bool bContains, int32 MaxResults, TArray<const FCandidate*>& OutCandidates)
+{
+	EnsureBuilt();
+
+	if (bSortedKeysDirty)
+	{
+		SortedKeys.Sort([](const TPair<FString, int32>& A, const TPair<FString, int32>& B)
+		{
+			return A.Key < B.Key;
+		});
+		bSortedKeysDirty = false;
+	}
+
+	const FString Needle = Query.ToLower();
+	TSet<int32> Seen;
+	auto Accept = [&](int32 Index) -> bool
+	{
+		const FCandidate& Candidate = Candidates[Index];
+		const UClass* OwnerClass = Candidate.OwnerClass.Get();
+		if (!Candidate.Function.IsValid() || !OwnerClass || (TargetClass && !TargetClass->IsChildOf(OwnerClass)))
+		{
+			return true;
+		}
+		if (!Seen.Contains(Index))
+		{
+			Seen.Add(Index);
+			OutCandidates.Add(&Candidate);
+		}
+		return MaxResults <= 0 || OutCandidates.Num() < MaxResults;
+	};
+
+	if (bContains)
+	{
+		for (const TPair<FString, int32>& Key : SortedKeys)
+		{
+			if (Key.Key.Contains(Needle) && !Accept(Key.Value))
+			{
+				break;
+			}
+		}
+		return;
+	}
+
+	int32 Start = Algo::LowerBoundBy(SortedKeys, Needle, [](const TPair<FString, int32>& Key) -> const FString& { return Key.Key; });
+	for (int32 i = Start; i < SortedKeys.Num() && SortedKeys[i].Key.StartsWith(Needle); ++i)
+	{
+		if (!Accept(SortedKeys[i].Value))
+		{
+			break;
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPFunctionIndex::CandidateToJson(const FCandidate& Candidate)
+{
+	TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+	Obj->SetStringField(TEXT("function_name"), Candidate.Name);
+	Obj->SetStringField(TEXT("display_name"), Candidate.DisplayName);
+	if (const UClass* OwnerClass = Candidate.OwnerClass.Get())
+	{
+		Obj->SetStringField(TEXT("target"), OwnerClass->GetName());
+		Obj->SetStringField(TEXT("class_path"), OwnerClass->GetPathName());
+	}
+	Obj->SetStringField(TEXT("category"), Candidate.Category);
+	Obj->SetBoolField(TEXT("pure"), Candidate.bPure);
+	Obj->SetBoolField(TEXT("static"), Candidate.bStatic);
+	return Obj;
+}
@@ -0,0 +1,752 @@
+#include "Commands/UnrealMCPGraphSearchIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Variable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace UnrealMcpGraphSearchIndex
+{
+	/** Game-thread time per tick spent loading queued Blueprints. */
+	static constexpr double CrawlBudgetSeconds = 0.008;
+	/** Quiet period before the index is written after a change. */
+	static constexpr double FlushDelaySeconds = 2.0;
+	static constexpr int32 FileVersion = 1;
+
+	static const TCHAR* KindNames[] = { TEXT("node"), TEXT("function"), TEXT("variable"), TEXT("event"), TEXT("macro") };
+	static constexpr int32 NumKinds = UE_ARRAY_COUNT(KindNames);
+
+	static IAssetRegistry& GetAssetRegistry()
+	{
+		return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	}
+
+	static FName ClassName(const UClass* Class)
+	{
+		return Class ? Class->GetFName() : NAME_None;
+	}
+
+	static bool MatchesName(const FString& Candidate, const FString& Name, FUnrealMCPGraphSearchIndex::EMatch Match)
+	{
+		switch (Match)
+		{
+		case FUnrealMCPGraphSearchIndex::EMatch::Prefix:
+			return Candidate.StartsWith(Name, ESearchCase::IgnoreCase);
+		case FUnrealMCPGraphSearchIndex::EMatch::Contains:
+			return Candidate.Contains(Name, ESearchCase::IgnoreCase);
+		default:
+			return Candidate.Equals(Name, ESearchCase::IgnoreCase);
+		}
+	}
+
+	/** Names in Map that match; exact lookups go through the (case-insensitive) FName hash instead of a scan. */
+	template <typename MapType>
+	static void CollectKeys(const MapType& Map, const FString& Name, FUnrealMCPGraphSearchIndex::EMatch Match, TArray<FName>& OutKeys)
+	{
+		if (Match == FUnrealMCPGraphSearchIndex::EMatch::Exact)
+		{
+			const FName Key(*Name, FNAME_Find);
+			if (!Key.IsNone() && Map.Contains(Key))
+			{
+				OutKeys.Add(Key);
+			}
+			return;
+		}
+		for (const auto& Pair : Map)
+		{
+			if (MatchesName(Pair.Key.ToString(), Name, Match))
+			{
+				OutKeys.Add(Pair.Key);
+			}
+		}
+	}
+}
+
+const TCHAR* FUnrealMCPGraphSearchIndex::GetKindName(EFactKind Kind)
+{
+	const int32 Index = static_cast<int32>(Kind);
+	return Index < UnrealMcpGraphSearchIndex::NumKinds ? UnrealMcpGraphSearchIndex::KindNames[Index] : TEXT("node");
+}
+
+bool FUnrealMCPGraphSearchIndex::ParseKind(const FString& Name, EFactKind& OutKind)
+{
+	for (int32 Index = 0; Index < UnrealMcpGraphSearchIndex::NumKinds; ++Index)
+	{
+		if (Name.Equals(UnrealMcpGraphSearchIndex::KindNames[Index], ESearchCase::IgnoreCase))
+		{
+			OutKind = static_cast<EFactKind>(Index);
+			return true;
+		}
+	}
+	// search_blueprint_graphs documents node-class searches as "node_class"
+	if (Name.Equals(TEXT("node_class"), ESearchCase::IgnoreCase))
+	{
+		OutKind = EFactKind::Node;
+		return true;
+	}
+	return false;
+}
+
+FUnrealMCPGraphSearchIndex& FUnrealMCPGraphSearchIndex::Get()
+{
+	static FUnrealMCPGraphSearchIndex Instance;
+	return Instance;
+}
+
+void FUnrealMCPGraphSearchIndex::Start()
+{
+	if (bStarted)
+	{
+		return;
+	}
+	bStarted = true;
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FUnrealMCPGraphSearchIndex::OnPackageSaved);
+	IAssetRegistry& AssetRegistry = UnrealMcpGraphSearchIndex::GetAssetRegistry();
+	AssetRegistry.OnAssetAdded().AddRaw(this, &FUnrealMCPGraphSearchIndex::OnAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FUnrealMCPGraphSearchIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FUnrealMCPGraphSearchIndex::OnAssetRenamed);
+}
+
+void FUnrealMCPGraphSearchIndex::Shutdown()
+{
+	if (!bStarted)
+	{
+		return;
+	}
+	bStarted = false;
+
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		AssetRegistryModule->Get().OnAssetAdded().RemoveAll(this);
+		AssetRegistryModule->Get().OnAssetRemoved().RemoveAll(this);
+		AssetRegistryModule->Get().OnAssetRenamed().RemoveAll(this);
+	}
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+	Flush();
+}
+
+FString FUnrealMCPGraphSearchIndex::GetIndexFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("GraphSearchIndex.json"));
+}
+
+bool FUnrealMCPGraphSearchIndex::GetPackageFilename(FName PackageName, FString& OutFilename)
+{
+	return FPackageName::TryConvertLongPackageNameToFilename(PackageName.ToString(), OutFilename, FPackageName::GetAssetPackageExtension());
+}
+
+bool FUnrealMCPGraphSearchIndex::IsProjectPackage(FName PackageName)
+{
+	// Project content and project plugins; engine and engine-plugin Blueprints would dwarf the project's own
+	FString Filename;
+	if (!GetPackageFilename(PackageName, Filename))
+	{
+		return false;
+	}
+	static const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+	return FPaths::IsUnderDirectory(FPaths::ConvertRelativePathToFull(Filename), ProjectDir);
+}
+
+void FUnrealMCPGraphSearchIndex::ExtractFacts(const UBlueprint* Blueprint, TArray<FFact>& OutFacts)
+{
+	using namespace UnrealMcpGraphSearchIndex;
+
+	TArray<UEdGraph*> Graphs;
+	Blueprint->GetAllGraphs(Graphs);
+	const FName SelfClass = ClassName(Blueprint->GeneratedClass);
+
+	for (const UEdGraph* Graph : Graphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			FFact& Fact = OutFacts.AddDefaulted_GetRef();
+			Fact.Graph = Graph->GetFName();
+			Fact.NodeClass = Node->GetClass()->GetFName();
+			Fact.NodeGuid = Node->NodeGuid;
+
+			if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				Fact.Kind = EFactKind::Function;
+				Fact.Member = CallNode->FunctionReference.GetMemberName();
+				const UFunction* Function = CallNode->GetTargetFunction();
+				Fact.Owner = Function ? ClassName(Function->GetOwnerClass())
+					: CallNode->FunctionReference.IsSelfContext() ? SelfClass : ClassName(CallNode->FunctionReference.GetMemberParentClass());
+			}
+			else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+			{
+				Fact.Kind = EFactKind::Variable;
+				Fact.Member = VariableNode->VariableReference.GetMemberName();
+				Fact.Owner = VariableNode->VariableReference.IsSelfContext() ? SelfClass : ClassName(VariableNode->VariableReference.GetMemberParentClass());
+			}
+			else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+			{
+				Fact.Kind = EFactKind::Event;
+				if (EventNode->bOverrideFunction)
+				{
+					Fact.Member = EventNode->EventReference.GetMemberName();
+					Fact.Owner = ClassName(EventNode->EventReference.GetMemberParentClass());
+				}
+				else
+				{
+					Fact.Member = EventNode->CustomFunctionName;
+					Fact.Owner = SelfClass;
+				}
+			}
+			else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+			{
+				Fact.Kind = EFactKind::Macro;
+				if (const UEdGraph* MacroGraph = MacroNode->GetMacroGraph())
+				{
+					Fact.Member = MacroGraph->GetFName();
+					const UBlueprint* MacroBlueprint = MacroNode->GetSourceBlueprint();
+					Fact.Owner = MacroBlueprint ? MacroBlueprint->GetFName() : NAME_None;
+				}
+			}
+		}
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::EnsureLoaded()
+{
+	using namespace UnrealMcpGraphSearchIndex;
+
+	if (bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetIndexFilePath()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP GraphSearchIndex: ignoring unreadable index file %s"), *GetIndexFilePath());
+		return;
+	}
+	int32 Version = 0;
+	if (!Root->TryGetNumberField(TEXT("version"), Version) || Version != FileVersion)
+	{
+		return;
+	}
+
+	// Rows reference a shared name table: [graph, node_class, kind, member, owner, node_guid]
+	TArray<FName> Names;
+	const TArray<TSharedPtr<FJsonValue>>* NameValues = nullptr;
+	if (Root->TryGetArrayField(TEXT("names"), NameValues))
+	{
+		Names.Reserve(NameValues->Num());
+		for (const TSharedPtr<FJsonValue>& Value : *NameValues)
+		{
+			Names.Add(FName(*Value->AsString()));
+		}
+	}
+	auto NameAt = [&Names](const TSharedPtr<FJsonValue>& Value)
+	{
+		const int32 Index = static_cast<int32>(Value->AsNumber());
+		return Names.IsValidIndex(Index) ? Names[Index] : NAME_None;
+	};
+
+	const TArray<TSharedPtr<FJsonValue>>* PackageValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("packages"), PackageValues))
+	{
+		return;
+	}
+	for (const TSharedPtr<FJsonValue>& PackageValue : *PackageValues)
+	{
+		const TSharedPtr<FJsonObject>* PackageObj = nullptr;
+		FString PackageName;
+		if (!PackageValue->TryGetObject(PackageObj) || !(*PackageObj)->TryGetStringField(TEXT("package"), PackageName))
+		{
+			continue;
+		}
+
+		FPackageEntry Entry;
+		// int64/ticks are stored as strings; JSON numbers would lose precision.
+		FString SizeStr, MTimeStr;
+		if ((*PackageObj)->TryGetStringField(TEXT("file_size"), SizeStr))
+		{
+			LexFromString(Entry.FileSize, *SizeStr);
+		}
+		if ((*PackageObj)->TryGetStringField(TEXT("mtime_ticks"), MTimeStr))
+		{
+			int64 Ticks = 0;
+			LexFromString(Ticks, *MTimeStr);
+			Entry.ModifiedTime = FDateTime(Ticks);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Rows = nullptr;
+		if ((*PackageObj)->TryGetArrayField(TEXT("rows"), Rows))
+		{
+			Entry.Facts.Reserve(Rows->Num());
+			for (const TSharedPtr<FJsonValue>& RowValue : *Rows)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* Row = nullptr;
+				if (!RowValue->TryGetArray(Row) || Row->Num() != 6)
+				{
+					continue;
+				}
+				FFact& Fact = Entry.Facts.AddDefaulted_GetRef();
+				Fact.Graph = NameAt((*Row)[0]);
+				Fact.NodeClass = NameAt((*Row)[1]);
+				Fact.Kind = static_cast<EFactKind>(FMath::Clamp(static_cast<int32>((*Row)[2]->AsNumber()), 0, NumKinds - 1));
+				Fact.Member = NameAt((*Row)[3]);
+				Fact.Owner = NameAt((*Row)[4]);
+				FGuid::Parse((*Row)[5]->AsString(), Fact.NodeGuid);
+			}
+		}
+		Packages.Add(FName(*PackageName), MoveTemp(Entry));
+	}
+
+	bLookupDirty = true;
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCP GraphSearchIndex: loaded %d Blueprint(s)"), Packages.Num());
+}
+
+void FUnrealMCPGraphSearchIndex::EnsureScanned()
+{
+	EnsureLoaded();
+	if (bScanned)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = UnrealMcpGraphSearchIndex::GetAssetRegistry();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// The initial registry scan is still running; scan once it has finished
+		return;
+	}
+	bScanned = true;
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FAssetData> Blueprints;
+	AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Blueprints, true);
+
+	TSet<FName> Seen;
+	int32 Stale = 0;
+	for (const FAssetData& AssetData : Blueprints)
+	{
+		if (!IsProjectPackage(AssetData.PackageName))
+		{
+			continue;
+		}
+		Seen.Add(AssetData.PackageName);
+
+		FString Filename;
+		const FPackageEntry* Entry = Packages.Find(AssetData.PackageName);
+		if (Entry && GetPackageFilename(AssetData.PackageName, Filename))
+		{
+			const FFileStatData Stat = IFileManager::Get().GetStatData(*Filename);
+			if (Stat.bIsValid && Stat.FileSize == Entry->FileSize && Stat.ModificationTime == Entry->ModifiedTime)
+			{
+				continue;
+			}
+		}
+		Enqueue(AssetData.GetSoftObjectPath());
+		++Stale;
+	}
+
+	TArray<FName> Gone;
+	for (const TPair<FName, FPackageEntry>& Pair : Packages)
+	{
+		if (!Seen.Contains(Pair.Key))
+		{
+			Gone.Add(Pair.Key);
+		}
+	}
+	for (const FName PackageName : Gone)
+	{
+		Remove(PackageName);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCP GraphSearchIndex: %d Blueprint(s) current, %d queued, %d removed (%.1f ms)"),
+		Seen.Num() - Stale, Stale, Gone.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FUnrealMCPGraphSearchIndex::Enqueue(const FSoftObjectPath& AssetPath)
+{
+	const FName PackageName = AssetPath.GetLongPackageFName();
+	if (!PackageName.IsNone() && !PendingPackages.Contains(PackageName))
+	{
+		PendingPackages.Add(PackageName);
+		Pending.Add(AssetPath);
+		ScheduleTick();
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::CrawlOne(const FSoftObjectPath& AssetPath)
+{
+	const FName PackageName = AssetPath.GetLongPackageFName();
+	PendingPackages.Remove(PackageName);
+
+	FPackageEntry Entry;
+	FString Filename;
+	if (GetPackageFilename(PackageName, Filename))
+	{
+		const FFileStatData Stat = IFileManager::Get().GetStatData(*Filename);
+		Entry.FileSize = Stat.FileSize;
+		Entry.ModifiedTime = Stat.ModificationTime;
+	}
+
+	// A Blueprint that fails to load keeps an empty entry, so it is not retried until its file changes
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(AssetPath.TryLoad()))
+	{
+		ExtractFacts(Blueprint, Entry.Facts);
+	}
+	Packages.Add(PackageName, MoveTemp(Entry));
+	MarkChanged();
+}
+
+void FUnrealMCPGraphSearchIndex::Remove(FName PackageName)
+{
+	if (Packages.Remove(PackageName) > 0)
+	{
+		MarkChanged();
+	}
+	if (PendingPackages.Remove(PackageName) > 0)
+	{
+		Pending.RemoveAll([PackageName](const FSoftObjectPath& Path)
+		{
+			return Path.GetLongPackageFName() == PackageName;
+		});
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::MarkChanged()
+{
+	bLookupDirty = true;
+	bDiskDirty = true;
+	LastChangeTime = FPlatformTime::Seconds();
+	ScheduleTick();
+}
+
+void FUnrealMCPGraphSearchIndex::ScheduleTick()
+{
+	if (!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FUnrealMCPGraphSearchIndex::Tick), 0.0f);
+	}
+}
+
+bool FUnrealMCPGraphSearchIndex::Tick(float DeltaTime)
+{
+	using namespace UnrealMcpGraphSearchIndex;
+
+	if (Pending.Num() > 0)
+	{
+		// Stay out of the way of saves, GC and PIE; loading during those is unsafe or visibly slow
+		const bool bBusy = GIsSavingPackage || IsGarbageCollecting() || (GEditor && GEditor->PlayWorld) ||
+			GetAssetRegistry().IsLoadingAssets();
+		if (!bBusy)
+		{
+			const double Deadline = FPlatformTime::Seconds() + CrawlBudgetSeconds;
+			do
+			{
+				CrawlOne(Pending.Pop(EAllowShrinking::No));
+			}
+			while (Pending.Num() > 0 && FPlatformTime::Seconds() < Deadline);
+
+			if (Pending.Num() == 0)
+			{
+				UE_LOG(LogTemp, Log, TEXT("UnrealMCP GraphSearchIndex: crawl finished, %d Blueprint(s) indexed"), Packages.Num());
+			}
+		}
+		return true;
+	}
+
+	if (bDiskDirty && FPlatformTime::Seconds() - LastChangeTime < FlushDelaySeconds)
+	{
+		return true;
+	}
+	Flush();
+	TickHandle.Reset();
+	return false;
+}
+
+void FUnrealMCPGraphSearchIndex::FinishCrawl()
+{
+	check(IsInGameThread());
+	EnsureScanned();
+	while (Pending.Num() > 0)
+	{
+		CrawlOne(Pending.Pop(EAllowShrinking::No));
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::Rebuild()
+{
+	check(IsInGameThread());
+	EnsureLoaded();
+	Packages.Reset();
+	Pending.Reset();
+	PendingPackages.Reset();
+	bScanned = false;
+	MarkChanged();
+	EnsureScanned();
+}
+
+void FUnrealMCPGraphSearchIndex::EnsureLookup()
+{
+	if (!bLookupDirty)
+	{
+		return;
+	}
+	bLookupDirty = false;
+	ByMember.Reset();
+	ByNodeClass.Reset();
+
+	for (const TPair<FName, FPackageEntry>& Pair : Packages)
+	{
+		for (int32 Row = 0; Row < Pair.Value.Facts.Num(); ++Row)
+		{
+			const FFact& Fact = Pair.Value.Facts[Row];
+			ByNodeClass.FindOrAdd(Fact.NodeClass).Add({ Pair.Key, Row });
+			if (!Fact.Member.IsNone())
+			{
+				ByMember.FindOrAdd(Fact.Member).Add({ Pair.Key, Row });
+			}
+		}
+	}
+}
+
+int32 FUnrealMCPGraphSearchIndex::Search(const FQuery& Query, TArray<FMatch>& OutMatches)
+{
+	using namespace UnrealMcpGraphSearchIndex;
+
+	check(IsInGameThread());
+	EnsureScanned();
+	EnsureLookup();
+
+	TArray<FRowRef> Rows;
+	const bool bNodeClasses = !Query.Kind.IsSet() || Query.Kind.GetValue() == EFactKind::Node;
+	const bool bMembers = !Query.Kind.IsSet() || Query.Kind.GetValue() != EFactKind::Node;
+
+	TArray<FName> Keys;
+	if (bNodeClasses)
+	{
+		CollectKeys(ByNodeClass, Query.Name, Query.Match, Keys);
+		// "CallFunction" for K2Node_CallFunction
+		if (Keys.Num() == 0 && Query.Match == EMatch::Exact)
+		{
+			CollectKeys(ByNodeClass, TEXT("K2Node_") + Query.Name, Query.Match, Keys);
+		}
+		for (const FName Key : Keys)
+		{
+			Rows.Append(ByNodeClass.FindChecked(Key));
+		}
+	}
+	if (bMembers)
+	{
+		Keys.Reset();
+		CollectKeys(ByMember, Query.Name, Query.Match, Keys);
+		for (const FName Key : Keys)
+		{
+			for (const FRowRef& Ref : ByMember.FindChecked(Key))
+			{
+				const FFact& Fact = Packages.FindChecked(Ref.Package).Facts[Ref.Row];
+				if (!Query.Kind.IsSet() || Fact.Kind == Query.Kind.GetValue())
+				{
+					Rows.Add(Ref);
+				}
+			}
+		}
+	}
+
+	TArray<FMatch> Matches;
+	TSet<TPair<FName, int32>> SeenRows;
+	for (const FRowRef& Ref : Rows)
+	{
+		if (!Query.PathPrefix.IsEmpty() && !Ref.Package.ToString().StartsWith(Query.PathPrefix, ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+		const FFact& Fact = Packages.FindChecked(Ref.Package).Facts[Ref.Row];
+		if (!Query.Owner.IsEmpty() && !Fact.Owner.ToString().Equals(Query.Owner, ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+		bool bAlreadyMatched = false;
+		SeenRows.Add(TPair<FName, int32>(Ref.Package, Ref.Row), &bAlreadyMatched);
+		if (!bAlreadyMatched)
+		{
+			Matches.Add({ Ref.Package, &Fact });
+		}
+	}
+
+	Matches.Sort([](const FMatch& A, const FMatch& B)
+	{
+		return A.Package.LexicalLess(B.Package);
+	});
+	const int32 Total = Matches.Num();
+	if (Query.Limit > 0 && Matches.Num() > Query.Limit)
+	{
+		Matches.SetNum(Query.Limit);
+	}
+	OutMatches = MoveTemp(Matches);
+	return Total;
+}
+
+void FUnrealMCPGraphSearchIndex::Flush()
+{
+	using namespace UnrealMcpGraphSearchIndex;
+
+	if (!bDiskDirty)
+	{
+		return;
+	}
+	bDiskDirty = false;
+
+	TMap<FName, int32> NameIndices;
+	TArray<TSharedPtr<FJsonValue>> NameValues;
+	auto NameIndex = [&NameIndices, &NameValues](FName Name) -> TSharedPtr<FJsonValue>
+	{
+		int32* Existing = NameIndices.Find(Name);
+		if (!Existing)
+		{
+			Existing = &NameIndices.Add(Name, NameValues.Add(MakeShared<FJsonValueString>(Name.ToString())));
+		}
+		return MakeShared<FJsonValueNumber>(*Existing);
+	};
+
+	TArray<TSharedPtr<FJsonValue>> PackageValues;
+	PackageValues.Reserve(Packages.Num());
+	for (TPair<FName, FPackageEntry>& Pair : Packages)
+	{
+		FPackageEntry& Entry = Pair.Value;
+		FString Filename;
+		if (Entry.bStampPending && GetPackageFilename(Pair.Key, Filename))
+		{
+			const FFileStatData Stat = IFileManager::Get().GetStatData(*Filename);
+			Entry.FileSize = Stat.FileSize;
+			Entry.ModifiedTime = Stat.ModificationTime;
+			Entry.bStampPending = false;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Rows;
+		Rows.Reserve(Entry.Facts.Num());
+		for (const FFact& Fact : Entry.Facts)
+		{
+			TArray<TSharedPtr<FJsonValue>> Row;
+			Row.Add(NameIndex(Fact.Graph));
+			Row.Add(NameIndex(Fact.NodeClass));
+			Row.Add(MakeShared<FJsonValueNumber>(static_cast<int32>(Fact.Kind)));
+			Row.Add(NameIndex(Fact.Member));
+			Row.Add(NameIndex(Fact.Owner));
+			Row.Add(MakeShared<FJsonValueString>(Fact.NodeGuid.ToString()));
+			Rows.Add(MakeShared<FJsonValueArray>(Row));
+		}
+
+		TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+		PackageObj->SetStringField(TEXT("package"), Pair.Key.ToString());
+		PackageObj->SetStringField(TEXT("file_size"), LexToString(Entry.FileSize));
+		PackageObj->SetStringField(TEXT("mtime_ticks"), LexToString(Entry.ModifiedTime.GetTicks()));
+		PackageObj->SetArrayField(TEXT("rows"), Rows);
+		PackageValues.Add(MakeShared<FJsonValueObject>(PackageObj));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("version"), FileVersion);
+	Root->SetArrayField(TEXT("names"), NameValues);
+	Root->SetArrayField(TEXT("packages"), PackageValues);
+
+	FString Output;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	if (!FFileHelper::SaveStringToFile(Output, *GetIndexFilePath()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP GraphSearchIndex: failed to write %s"), *GetIndexFilePath());
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!Package || SaveContext.IsProceduralSave() || !IsProjectPackage(Package->GetFName()))
+	{
+		return;
+	}
+
+	UBlueprint* Blueprint = nullptr;
+	ForEachObjectWithPackage(Package, [&Blueprint](UObject* Object)
+	{
+		Blueprint = Cast<UBlueprint>(Object);
+		return Blueprint == nullptr;
+	}, false);
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	EnsureLoaded();
+	FPackageEntry Entry;
+	Entry.bStampPending = true;
+	ExtractFacts(Blueprint, Entry.Facts);
+	Packages.Add(Package->GetFName(), MoveTemp(Entry));
+	if (PendingPackages.Remove(Package->GetFName()) > 0)
+	{
+		const FName PackageName = Package->GetFName();
+		Pending.RemoveAll([PackageName](const FSoftObjectPath& Path)
+		{
+			return Path.GetLongPackageFName() == PackageName;
+		});
+	}
+	MarkChanged();
+}
+
+void FUnrealMCPGraphSearchIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	// Before the first scan, the scan itself picks new Blueprints up
+	if (bScanned && AssetData.IsInstanceOf(UBlueprint::StaticClass()) && !Packages.Contains(AssetData.PackageName) && IsProjectPackage(AssetData.PackageName))
+	{
+		Enqueue(AssetData.GetSoftObjectPath());
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bLoaded)
+	{
+		Remove(AssetData.PackageName);
+	}
+}
+
+void FUnrealMCPGraphSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bLoaded)
+	{
+		Remove(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+		OnAssetAdded(AssetData);
+	}
+}
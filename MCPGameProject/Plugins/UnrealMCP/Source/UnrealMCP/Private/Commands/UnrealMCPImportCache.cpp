@@ -0,0 +1,513 @@
+#include "Commands/UnrealMCPImportCache.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace UnrealMcpImportCache
+{
+	// Streamed read size for content hashing. Large enough to amortize syscalls, small enough for many concurrent hashes.
+	static constexpr int64 HashChunkSize = 1024 * 1024;
+
+	// Batches can nest sub-commands; bound recursion so a malformed request can't run away.
+	static constexpr int32 MaxBatchDepth = 4;
+
+	// Version 1 keyed records by source only; those records are dropped on load.
+	static constexpr int32 FileVersion = 2;
+
+	static void AppendCanonicalJson(const TSharedPtr<FJsonValue>& Value, FString& Out);
+
+	static void AppendCanonicalObject(const TSharedPtr<FJsonObject>& Obj, FString& Out)
+	{
+		if (!Obj.IsValid())
+		{
+			Out += TEXT("null");
+			return;
+		}
+
+		TArray<FString> Keys;
+		Obj->Values.GetKeys(Keys);
+		Keys.Sort();
+
+		Out += TEXT("{");
+		for (const FString& Key : Keys)
+		{
+			Out += Key;
+			Out += TEXT("=");
+			AppendCanonicalJson(Obj->Values.FindRef(Key), Out);
+			Out += TEXT(";");
+		}
+		Out += TEXT("}");
+	}
+
+	static void AppendCanonicalJson(const TSharedPtr<FJsonValue>& Value, FString& Out)
+	{
+		if (!Value.IsValid())
+		{
+			Out += TEXT("null");
+			return;
+		}
+
+		switch (Value->Type)
+		{
+		case EJson::Object:
+			AppendCanonicalObject(Value->AsObject(), Out);
+			break;
+		case EJson::Array:
+			Out += TEXT("[");
+			for (const TSharedPtr<FJsonValue>& Item : Value->AsArray())
+			{
+				AppendCanonicalJson(Item, Out);
+				Out += TEXT(",");
+			}
+			Out += TEXT("]");
+			break;
+		case EJson::Boolean:
+			Out += Value->AsBool() ? TEXT("true") : TEXT("false");
+			break;
+		case EJson::Number:
+			Out += FString::SanitizeFloat(Value->AsNumber());
+			break;
+		case EJson::String:
+			Out += TEXT("\"") + Value->AsString() + TEXT("\"");
+			break;
+		default:
+			Out += TEXT("null");
+			break;
+		}
+	}
+}
+
+FUnrealMCPImportCache& FUnrealMCPImportCache::Get()
+{
+	static FUnrealMCPImportCache Instance;
+	return Instance;
+}
+
+FString FUnrealMCPImportCache::NormalizeSourcePath(const FString& SourcePath)
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(SourcePath);
+	FPaths::NormalizeFilename(FullPath);
+	FPaths::CollapseRelativeDirectories(FullPath);
+	return FullPath;
+}
+
+FString FUnrealMCPImportCache::NormalizeAssetPath(const FString& AssetPath)
+{
+	FString Normalized;
+	FString Err;
+	return FUnrealMCPCommonUtils::NormalizeLongPackageAssetPath(AssetPath, Normalized, Err) ? Normalized : AssetPath;
+}
+
+FString FUnrealMCPImportCache::MakeRecordKey(const FString& FullSourcePath, const FString& NormalizedAssetPath)
+{
+	return FullSourcePath + TEXT("|") + NormalizedAssetPath;
+}
+
+FString FUnrealMCPImportCache::GetCacheFilePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("ImportCache.json"));
+}
+
+bool FUnrealMCPImportCache::HashFileContents(const FString& FullPath, FString& OutHash)
+{
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FullPath));
+	if (!Handle)
+	{
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(UnrealMcpImportCache::HashChunkSize, FMath::Max<int64>(Handle->Size(), 1))));
+
+	FXxHash64Builder Builder;
+	int64 Remaining = Handle->Size();
+	while (Remaining > 0)
+	{
+		const int64 ToRead = FMath::Min<int64>(Remaining, Buffer.Num());
+		if (!Handle->Read(Buffer.GetData(), ToRead))
+		{
+			return false;
+		}
+		Builder.Update(Buffer.GetData(), static_cast<uint64>(ToRead));
+		Remaining -= ToRead;
+	}
+
+	OutHash = FString::Printf(TEXT("xxh64:%016llx"), Builder.Finalize().Hash);
+	return true;
+}
+
+bool FUnrealMCPImportCache::GetContentHash(const FString& SourcePath, FString& OutHash)
+{
+	const FString FullPath = NormalizeSourcePath(SourcePath);
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FullPath);
+	if (!Stat.bIsValid || Stat.bIsDirectory)
+	{
+		return false;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FHashMemo* Memo = HashMemo.Find(FullPath))
+		{
+			if (Memo->FileSize == Stat.FileSize && Memo->ModifiedTime == Stat.ModificationTime)
+			{
+				OutHash = Memo->Hash;
+				return true;
+			}
+		}
+	}
+
+	// Hash outside the lock so concurrent callers (ParallelFor prehash) don't serialize on IO.
+	FString Hash;
+	if (!HashFileContents(FullPath, Hash))
+	{
+		return false;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		FHashMemo& Memo = HashMemo.FindOrAdd(FullPath);
+		Memo.FileSize = Stat.FileSize;
+		Memo.ModifiedTime = Stat.ModificationTime;
+		Memo.Hash = Hash;
+	}
+
+	OutHash = Hash;
+	return true;
+}
+
+void FUnrealMCPImportCache::CollectSourcePaths(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<FString>& OutPaths, int32 Depth)
+{
+	if (!Params.IsValid() || Depth > UnrealMcpImportCache::MaxBatchDepth)
+	{
+		return;
+	}
+
+	if (CommandType == TEXT("import_model"))
+	{
+		FString FilePath;
+		if (Params->TryGetStringField(TEXT("file_path"), FilePath) && !FilePath.IsEmpty())
+		{
+			OutPaths.AddUnique(FilePath);
+		}
+	}
+	else if (CommandType == TEXT("reimport_asset"))
+	{
+		FString AssetPath;
+		FString SourcePath;
+		if (Params->TryGetStringField(TEXT("asset_path"), AssetPath) && FindSourceForAsset(AssetPath, SourcePath))
+		{
+			OutPaths.AddUnique(SourcePath);
+		}
+	}
+	else if (CommandType == TEXT("batch"))
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+		if (Params->TryGetArrayField(TEXT("commands"), Commands) && Commands)
+		{
+			for (const TSharedPtr<FJsonValue>& V : *Commands)
+			{
+				const TSharedPtr<FJsonObject> CmdObj = V.IsValid() && V->Type == EJson::Object ? V->AsObject() : nullptr;
+				FString SubType;
+				if (!CmdObj.IsValid() || !CmdObj->TryGetStringField(TEXT("type"), SubType))
+				{
+					continue;
+				}
+
+				const TSharedPtr<FJsonValue> SubParams = CmdObj->TryGetField(TEXT("params"));
+				if (SubParams.IsValid() && SubParams->Type == EJson::Object)
+				{
+					CollectSourcePaths(SubType, SubParams->AsObject(), OutPaths, Depth + 1);
+				}
+			}
+		}
+	}
+}
+
+void FUnrealMCPImportCache::PrehashForCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+	if (!ensureMsgf(!IsInGameThread(), TEXT("PrehashForCommand would block the game thread")))
+	{
+		return;
+	}
+
+	TArray<FString> Paths;
+	CollectSourcePaths(CommandType, Params, Paths, 0);
+	if (Paths.Num() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	ParallelFor(Paths.Num(), [this, &Paths](int32 Index)
+	{
+		FString Unused;
+		GetContentHash(Paths[Index], Unused);
+	});
+
+	UE_LOG(LogTemp, Verbose, TEXT("UnrealMCP ImportCache: prehashed %d source file(s) in %.1f ms"),
+		Paths.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+FString FUnrealMCPImportCache::HashSettings(const TSharedPtr<FJsonObject>& Settings)
+{
+	FString Canonical;
+	UnrealMcpImportCache::AppendCanonicalObject(Settings, Canonical);
+
+	const FTCHARToUTF8 Utf8(*Canonical);
+	return FString::Printf(TEXT("xxh64:%016llx"), FXxHash64::HashBuffer(Utf8.Get(), Utf8.Length()).Hash);
+}
+
+bool FUnrealMCPImportCache::IsUpToDate(const FString& SourcePath, const FString& AssetPath, const FString& SettingsHash, FString& OutReason)
+{
+	const FString FullPath = NormalizeSourcePath(SourcePath);
+	const FString RecordKey = MakeRecordKey(FullPath, NormalizeAssetPath(AssetPath));
+
+	FRecord Record;
+	{
+		FScopeLock ScopeLock(&Lock);
+		EnsureLoadedLocked();
+		const FRecord* Found = Records.Find(RecordKey);
+		if (!Found)
+		{
+			OutReason = TEXT("no_cache_record");
+			return false;
+		}
+		Record = *Found;
+	}
+
+	// Without a settings hash on both sides there is nothing to prove the settings match.
+	if (SettingsHash.IsEmpty() || Record.SettingsHash.IsEmpty())
+	{
+		OutReason = TEXT("settings_unknown");
+		return false;
+	}
+
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FullPath);
+	if (!Stat.bIsValid)
+	{
+		OutReason = TEXT("source_missing");
+		return false;
+	}
+
+	// Cheap checks first: a size change or a settings change never needs a content hash.
+	if (Stat.FileSize != Record.FileSize)
+	{
+		OutReason = TEXT("size_changed");
+		return false;
+	}
+
+	if (SettingsHash != Record.SettingsHash)
+	{
+		OutReason = TEXT("settings_changed");
+		return false;
+	}
+
+	if (Stat.ModificationTime == Record.ModifiedTime)
+	{
+		OutReason = TEXT("unchanged_stat");
+		return true;
+	}
+
+	// mtime moved (e.g. a sync touched the file): fall back to the content hash.
+	FString CurrentHash;
+	if (!GetContentHash(FullPath, CurrentHash) || CurrentHash != Record.ContentHash)
+	{
+		OutReason = TEXT("content_changed");
+		return false;
+	}
+
+	// Content is identical; remember the new mtime so the next check is stat-only.
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FRecord* Stored = Records.Find(RecordKey))
+		{
+			Stored->ModifiedTime = Stat.ModificationTime;
+			bDirty = true;
+		}
+	}
+
+	OutReason = TEXT("content_unchanged");
+	return true;
+}
+
+void FUnrealMCPImportCache::RecordImport(const FString& SourcePath, const FString& AssetPath, const FString& SettingsHash)
+{
+	if (!ensureMsgf(!SettingsHash.IsEmpty(), TEXT("RecordImport needs a settings hash")) || AssetPath.IsEmpty())
+	{
+		return;
+	}
+
+	const FString FullPath = NormalizeSourcePath(SourcePath);
+	const FString NormalizedAssetPath = NormalizeAssetPath(AssetPath);
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FullPath);
+
+	FString Hash;
+	if (!Stat.bIsValid || !GetContentHash(FullPath, Hash))
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	EnsureLoadedLocked();
+
+	FRecord& Record = Records.FindOrAdd(MakeRecordKey(FullPath, NormalizedAssetPath));
+	Record.SourcePath = FullPath;
+	Record.AssetPath = NormalizedAssetPath;
+	Record.ContentHash = Hash;
+	Record.FileSize = Stat.FileSize;
+	Record.ModifiedTime = Stat.ModificationTime;
+	Record.SettingsHash = SettingsHash;
+	Record.ImportTime = FDateTime::UtcNow();
+	AssetToSource.Add(NormalizedAssetPath, FullPath);
+	bDirty = true;
+}
+
+bool FUnrealMCPImportCache::FindSourceForAsset(const FString& AssetPath, FString& OutSourcePath)
+{
+	FString Normalized;
+	FString Err;
+	if (!FUnrealMCPCommonUtils::NormalizeLongPackageAssetPath(AssetPath, Normalized, Err))
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	EnsureLoadedLocked();
+	if (const FString* Found = AssetToSource.Find(Normalized))
+	{
+		OutSourcePath = *Found;
+		return true;
+	}
+	return false;
+}
+
+void FUnrealMCPImportCache::EnsureLoadedLocked()
+{
+	if (bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetCacheFilePath()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP ImportCache: ignoring unreadable cache file %s"), *GetCacheFilePath());
+		return;
+	}
+
+	int32 Version = 0;
+	Root->TryGetNumberField(TEXT("version"), Version);
+	if (Version != UnrealMcpImportCache::FileVersion)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UnrealMCP ImportCache: discarding version %d cache file"), Version);
+		bDirty = true;
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!Root->TryGetArrayField(TEXT("entries"), Entries) || !Entries)
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& V : *Entries)
+	{
+		const TSharedPtr<FJsonObject> Obj = V.IsValid() && V->Type == EJson::Object ? V->AsObject() : nullptr;
+		FRecord Record;
+		if (!Obj.IsValid() || !Obj->TryGetStringField(TEXT("source_path"), Record.SourcePath) ||
+			!Obj->TryGetStringField(TEXT("asset_path"), Record.AssetPath))
+		{
+			continue;
+		}
+
+		Obj->TryGetStringField(TEXT("content_hash"), Record.ContentHash);
+		Obj->TryGetStringField(TEXT("settings_hash"), Record.SettingsHash);
+
+		// int64/ticks are stored as strings; JSON numbers would lose precision.
+		FString SizeStr, MTimeStr, ImportTimeStr;
+		if (Obj->TryGetStringField(TEXT("file_size"), SizeStr))
+		{
+			LexFromString(Record.FileSize, *SizeStr);
+		}
+		if (Obj->TryGetStringField(TEXT("mtime_ticks"), MTimeStr))
+		{
+			int64 Ticks = 0;
+			LexFromString(Ticks, *MTimeStr);
+			Record.ModifiedTime = FDateTime(Ticks);
+		}
+		if (Obj->TryGetStringField(TEXT("import_time"), ImportTimeStr))
+		{
+			FDateTime::ParseIso8601(*ImportTimeStr, Record.ImportTime);
+		}
+
+		AssetToSource.Add(Record.AssetPath, Record.SourcePath);
+
+		// Seed the hash memo so an unchanged file is never rehashed across editor sessions.
+		FHashMemo& Memo = HashMemo.FindOrAdd(Record.SourcePath);
+		Memo.FileSize = Record.FileSize;
+		Memo.ModifiedTime = Record.ModifiedTime;
+		Memo.Hash = Record.ContentHash;
+
+		const FString RecordKey = MakeRecordKey(Record.SourcePath, Record.AssetPath);
+		Records.Add(RecordKey, MoveTemp(Record));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCP ImportCache: loaded %d record(s)"), Records.Num());
+}
+
+void FUnrealMCPImportCache::Flush()
+{
+	FString Output;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bDirty)
+		{
+			return;
+		}
+		bDirty = false;
+
+		TArray<TSharedPtr<FJsonValue>> Entries;
+		Entries.Reserve(Records.Num());
+		for (const TPair<FString, FRecord>& Pair : Records)
+		{
+			const FRecord& Record = Pair.Value;
+			TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+			Obj->SetStringField(TEXT("source_path"), Record.SourcePath);
+			Obj->SetStringField(TEXT("asset_path"), Record.AssetPath);
+			Obj->SetStringField(TEXT("content_hash"), Record.ContentHash);
+			Obj->SetStringField(TEXT("file_size"), LexToString(Record.FileSize));
+			Obj->SetStringField(TEXT("mtime_ticks"), LexToString(Record.ModifiedTime.GetTicks()));
+			Obj->SetStringField(TEXT("settings_hash"), Record.SettingsHash);
+			Obj->SetStringField(TEXT("import_time"), Record.ImportTime.ToIso8601());
+			Entries.Add(MakeShared<FJsonValueObject>(Obj));
+		}
+
+		TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetNumberField(TEXT("version"), UnrealMcpImportCache::FileVersion);
+		Root->SetArrayField(TEXT("entries"), Entries);
+
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Output, *GetCacheFilePath()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCP ImportCache: failed to write %s"), *GetCacheFilePath());
+	}
+}
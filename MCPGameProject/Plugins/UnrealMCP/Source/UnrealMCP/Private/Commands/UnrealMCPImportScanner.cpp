@@ -0,0 +1,783 @@
+#include "Commands/UnrealMCPImportScanner.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/ParallelFor.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace UnrealMcpImportScanner
+{
+	// GLB JSON chunks and PLY headers larger than this are treated as malformed rather than read into memory.
+	static constexpr int64 MaxHeaderBytes = 64 * 1024 * 1024;
+
+	// FBX strings we care about (names, file names) are short; never pull a huge blob in just to read a name.
+	static constexpr uint32 MaxFbxStringBytes = 4096;
+
+	static bool ReadBytes(IFileHandle& Handle, int64 Offset, int64 Count, TArray<uint8>& Out)
+	{
+		if (Count < 0 || Count > MaxHeaderBytes || !Handle.Seek(Offset))
+		{
+			return false;
+		}
+		Out.SetNumUninitialized(static_cast<int32>(Count));
+		return Count == 0 || Handle.Read(Out.GetData(), Count);
+	}
+
+	static FString Utf8BytesToString(const uint8* Data, int32 Count)
+	{
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Count);
+		return FString::ConstructFromPtrSize(Converter.Get(), Converter.Length());
+	}
+
+	static int64 DecodedDataUriBytes(const FString& Uri)
+	{
+		const int32 Comma = Uri.Find(TEXT(","));
+		if (Comma == INDEX_NONE)
+		{
+			return 0;
+		}
+		const int64 EncodedLen = Uri.Len() - Comma - 1;
+		int64 Padding = 0;
+		if (Uri.EndsWith(TEXT("=="))) Padding = 2;
+		else if (Uri.EndsWith(TEXT("="))) Padding = 1;
+		return FMath::Max<int64>(0, EncodedLen * 3 / 4 - Padding);
+	}
+
+	/** Minimal binary FBX node reader (node headers and scalar/array property headers only). */
+	struct FFbxBinaryReader
+	{
+		struct FNode
+		{
+			int64 EndOffset = 0;
+			int64 NumProperties = 0;
+			int64 PropertyListLen = 0;
+			int64 PropertiesStart = 0;
+			FString Name;
+
+			int64 ChildrenStart() const { return PropertiesStart + PropertyListLen; }
+		};
+
+		struct FProperty
+		{
+			ANSICHAR Type = 0;
+			FString String;
+			int64 ArrayLength = 0;
+			int64 RawLength = 0;
+		};
+
+		IFileHandle& Handle;
+		int64 FileSize;
+		bool b64Bit;
+
+		FFbxBinaryReader(IFileHandle& InHandle, int64 InFileSize, uint32 Version)
+			: Handle(InHandle), FileSize(InFileSize), b64Bit(Version >= 7500)
+		{
+		}
+
+		bool ReadUInt(int64& Out, bool bWide)
+		{
+			if (bWide)
+			{
+				uint64 V = 0;
+				if (!Handle.Read(reinterpret_cast<uint8*>(&V), sizeof(V))) return false;
+				Out = static_cast<int64>(V);
+			}
+			else
+			{
+				uint32 V = 0;
+				if (!Handle.Read(reinterpret_cast<uint8*>(&V), sizeof(V))) return false;
+				Out = V;
+			}
+			return true;
+		}
+
+		/** Returns false on IO error or corruption. A zero EndOffset marks the null sentinel record. */
+		bool ReadNode(int64 Offset, FNode& Out)
+		{
+			if (Offset < 0 || Offset >= FileSize || !Handle.Seek(Offset))
+			{
+				return false;
+			}
+			uint8 NameLen = 0;
+			if (!ReadUInt(Out.EndOffset, b64Bit) || !ReadUInt(Out.NumProperties, b64Bit) || !ReadUInt(Out.PropertyListLen, b64Bit) ||
+				!Handle.Read(&NameLen, 1))
+			{
+				return false;
+			}
+			if (Out.EndOffset == 0)
+			{
+				return true;
+			}
+			if (Out.EndOffset <= Offset || Out.EndOffset > FileSize)
+			{
+				return false;
+			}
+			TArray<uint8> NameBytes;
+			NameBytes.SetNumUninitialized(NameLen);
+			if (NameLen > 0 && !Handle.Read(NameBytes.GetData(), NameLen))
+			{
+				return false;
+			}
+			Out.Name = Utf8BytesToString(NameBytes.GetData(), NameLen);
+			Out.PropertiesStart = Handle.Tell();
+			return true;
+		}
+
+		bool ReadProperties(const FNode& Node, int32 MaxCount, TArray<FProperty>& Out)
+		{
+			if (!Handle.Seek(Node.PropertiesStart))
+			{
+				return false;
+			}
+			const int32 Count = static_cast<int32>(FMath::Min<int64>(Node.NumProperties, MaxCount));
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				FProperty& Prop = Out.AddDefaulted_GetRef();
+				if (!Handle.Read(reinterpret_cast<uint8*>(&Prop.Type), 1))
+				{
+					return false;
+				}
+
+				int64 Skip = 0;
+				switch (Prop.Type)
+				{
+				case 'Y': Skip = 2; break;
+				case 'C': Skip = 1; break;
+				case 'I': case 'F': Skip = 4; break;
+				case 'D': case 'L': Skip = 8; break;
+				case 'f': case 'd': case 'l': case 'i': case 'b':
+				{
+					uint32 Header[3] = { 0, 0, 0 }; // ArrayLength, Encoding, CompressedLength
+					if (!Handle.Read(reinterpret_cast<uint8*>(Header), sizeof(Header))) return false;
+					Prop.ArrayLength = Header[0];
+					Skip = Header[1] == 0 ? static_cast<int64>(Header[0]) * ((Prop.Type == 'd' || Prop.Type == 'l') ? 8 : (Prop.Type == 'b' ? 1 : 4)) : Header[2];
+					break;
+				}
+				case 'S': case 'R':
+				{
+					uint32 Len = 0;
+					if (!Handle.Read(reinterpret_cast<uint8*>(&Len), sizeof(Len))) return false;
+					Prop.RawLength = Len;
+					if (Prop.Type == 'S' && Len <= MaxFbxStringBytes)
+					{
+						TArray<uint8> Bytes;
+						Bytes.SetNumUninitialized(Len);
+						if (Len > 0 && !Handle.Read(Bytes.GetData(), Len)) return false;
+						// FBX packs "Name\x00\x01Class"; keep only the part before the separator.
+						int32 NullIndex = INDEX_NONE;
+						const int32 StringLen = Bytes.Find(0, NullIndex) ? NullIndex : static_cast<int32>(Len);
+						Prop.String = Utf8BytesToString(Bytes.GetData(), StringLen);
+					}
+					else
+					{
+						Skip = Len;
+					}
+					break;
+				}
+				default:
+					return false;
+				}
+
+				if (Skip > 0 && !Handle.Seek(Handle.Tell() + Skip))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Visit the direct children of Node (or top-level records when Node is null). Stops on the null sentinel. */
+		template <typename VisitorType>
+		bool ForEachChild(const FNode* Node, int64 TopLevelStart, VisitorType&& Visitor)
+		{
+			int64 Pos = Node ? Node->ChildrenStart() : TopLevelStart;
+			const int64 End = Node ? Node->EndOffset : FileSize;
+			while (Pos < End)
+			{
+				FNode Child;
+				if (!ReadNode(Pos, Child))
+				{
+					return false;
+				}
+				if (Child.EndOffset == 0)
+				{
+					break;
+				}
+				if (!Visitor(Child))
+				{
+					return false;
+				}
+				Pos = Child.EndOffset;
+			}
+			return true;
+		}
+	};
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPImportScanResult::ToJson() const
+{
+	TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+	Obj->SetStringField(TEXT("file_path"), FilePath);
+	Obj->SetStringField(TEXT("format"), Format);
+	Obj->SetNumberField(TEXT("size"), static_cast<double>(FileSize));
+	Obj->SetBoolField(TEXT("parsed"), bParsed);
+	if (!FormatDetail.IsEmpty())
+	{
+		Obj->SetStringField(TEXT("format_detail"), FormatDetail);
+	}
+	if (!Error.IsEmpty())
+	{
+		Obj->SetStringField(TEXT("error"), Error);
+	}
+	Obj->SetNumberField(TEXT("mesh_count"), MeshCount);
+	Obj->SetNumberField(TEXT("material_count"), MaterialCount);
+	Obj->SetNumberField(TEXT("texture_count"), TextureCount);
+	Obj->SetNumberField(TEXT("vertex_count"), static_cast<double>(VertexCount));
+	Obj->SetNumberField(TEXT("embedded_texture_bytes"), static_cast<double>(EmbeddedTextureBytes));
+
+	TArray<TSharedPtr<FJsonValue>> ExternalArray;
+	for (const FString& File : ExternalFiles)
+	{
+		ExternalArray.Add(MakeShared<FJsonValueString>(File));
+	}
+	Obj->SetArrayField(TEXT("external_files"), ExternalArray);
+
+	TArray<TSharedPtr<FJsonValue>> MissingArray;
+	for (const FString& File : MissingExternalFiles)
+	{
+		MissingArray.Add(MakeShared<FJsonValueString>(File));
+	}
+	Obj->SetArrayField(TEXT("missing_external_files"), MissingArray);
+	return Obj;
+}
+
+FUnrealMCPImportScanResult FUnrealMCPImportScanner::ScanFile(const FString& FilePath)
+{
+	FUnrealMCPImportScanResult Result;
+	Result.FilePath = FilePath;
+	Result.Format = FPaths::GetExtension(FilePath).ToLower();
+
+	const FFileStatData Stat = IFileManager::Get().GetStatData(*FilePath);
+	if (!Stat.bIsValid || Stat.bIsDirectory)
+	{
+		Result.Error = TEXT("File not found");
+		return Result;
+	}
+	Result.FileSize = Stat.FileSize;
+
+	if (Result.Format == TEXT("gltf"))
+	{
+		ScanGltf(FilePath, Result);
+	}
+	else if (Result.Format == TEXT("glb"))
+	{
+		ScanGlb(FilePath, Result);
+	}
+	else if (Result.Format == TEXT("obj"))
+	{
+		ScanObj(FilePath, Result);
+	}
+	else if (Result.Format == TEXT("fbx"))
+	{
+		ScanFbx(FilePath, Result);
+	}
+	else if (Result.Format == TEXT("ply"))
+	{
+		ScanPly(FilePath, Result);
+	}
+	else
+	{
+		Result.FormatDetail = TEXT("not inspected");
+	}
+
+	for (const FString& External : Result.ExternalFiles)
+	{
+		if (!FPaths::FileExists(External))
+		{
+			Result.MissingExternalFiles.Add(External);
+		}
+	}
+	return Result;
+}
+
+TArray<FUnrealMCPImportScanResult> FUnrealMCPImportScanner::ScanFiles(const TArray<FString>& FilePaths)
+{
+	TArray<FUnrealMCPImportScanResult> Results;
+	Results.SetNum(FilePaths.Num());
+	ParallelFor(FilePaths.Num(), [&FilePaths, &Results](int32 Index)
+	{
+		Results[Index] = ScanFile(FilePaths[Index]);
+	});
+	return Results;
+}
+
+void FUnrealMCPImportScanner::ScanGltf(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	FString JsonText;
+	if (!FFileHelper::LoadFileToString(JsonText, *FilePath))
+	{
+		Result.Error = TEXT("Failed to read file");
+		return;
+	}
+	Result.FormatDetail = TEXT("gltf json");
+	ScanGltfJson(JsonText, FPaths::GetPath(FilePath), Result);
+}
+
+void FUnrealMCPImportScanner::ScanGlb(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle)
+	{
+		Result.Error = TEXT("Failed to open file");
+		return;
+	}
+
+	// 12-byte header (magic, version, length) followed by the JSON chunk header (length, type).
+	uint32 Header[5] = { 0, 0, 0, 0, 0 };
+	if (!Handle->Read(reinterpret_cast<uint8*>(Header), sizeof(Header)) || Header[0] != 0x46546C67 /* glTF */ || Header[4] != 0x4E4F534A /* JSON */)
+	{
+		Result.Error = TEXT("Not a valid GLB container");
+		return;
+	}
+
+	TArray<uint8> JsonBytes;
+	if (!UnrealMcpImportScanner::ReadBytes(*Handle, sizeof(Header), Header[3], JsonBytes))
+	{
+		Result.Error = TEXT("Failed to read GLB JSON chunk");
+		return;
+	}
+
+	Result.FormatDetail = FString::Printf(TEXT("glb %u"), Header[1]);
+	ScanGltfJson(UnrealMcpImportScanner::Utf8BytesToString(JsonBytes.GetData(), JsonBytes.Num()), FPaths::GetPath(FilePath), Result);
+}
+
+void FUnrealMCPImportScanner::ScanGltfJson(const FString& JsonText, const FString& BaseDir, FUnrealMCPImportScanResult& Result)
+{
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		Result.Error = TEXT("Invalid glTF JSON");
+		return;
+	}
+
+	auto GetArray = [&Root](const TCHAR* Field) -> const TArray<TSharedPtr<FJsonValue>>&
+	{
+		static const TArray<TSharedPtr<FJsonValue>> Empty;
+		const TArray<TSharedPtr<FJsonValue>>* Arr = nullptr;
+		return Root->TryGetArrayField(Field, Arr) && Arr ? *Arr : Empty;
+	};
+
+	// Index into a top-level array; null for out-of-range indices and non-object entries.
+	auto GetObjectAt = [](const TArray<TSharedPtr<FJsonValue>>& Arr, int32 Index) -> TSharedPtr<FJsonObject>
+	{
+		return Arr.IsValidIndex(Index) && Arr[Index].IsValid() && Arr[Index]->Type == EJson::Object ? Arr[Index]->AsObject() : nullptr;
+	};
+
+	// Entries that should be objects but aren't mark the file unreadable instead of being dereferenced.
+	auto GetEntry = [&Result](const TSharedPtr<FJsonValue>& Value, const FString& Where) -> TSharedPtr<FJsonObject>
+	{
+		if (Value.IsValid() && Value->Type == EJson::Object)
+		{
+			return Value->AsObject();
+		}
+		Result.Error = FString::Printf(TEXT("Malformed glTF: %s is not an object"), *Where);
+		return nullptr;
+	};
+
+	const TArray<TSharedPtr<FJsonValue>>& Meshes = GetArray(TEXT("meshes"));
+	const TArray<TSharedPtr<FJsonValue>>& Accessors = GetArray(TEXT("accessors"));
+	const TArray<TSharedPtr<FJsonValue>>& BufferViews = GetArray(TEXT("bufferViews"));
+	const TArray<TSharedPtr<FJsonValue>>& Images = GetArray(TEXT("images"));
+	const TArray<TSharedPtr<FJsonValue>>& Buffers = GetArray(TEXT("buffers"));
+
+	Result.MeshCount = Meshes.Num();
+	Result.MaterialCount = GetArray(TEXT("materials")).Num();
+	Result.TextureCount = Images.Num();
+
+	for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+	{
+		const TSharedPtr<FJsonObject> Mesh = GetEntry(Meshes[MeshIndex], FString::Printf(TEXT("meshes[%d]"), MeshIndex));
+		if (!Mesh.IsValid())
+		{
+			return;
+		}
+		const TArray<TSharedPtr<FJsonValue>>* Primitives = nullptr;
+		if (!Mesh->TryGetArrayField(TEXT("primitives"), Primitives) || !Primitives)
+		{
+			continue;
+		}
+		for (int32 PrimIndex = 0; PrimIndex < Primitives->Num(); ++PrimIndex)
+		{
+			const TSharedPtr<FJsonObject> Prim = GetEntry((*Primitives)[PrimIndex], FString::Printf(TEXT("meshes[%d].primitives[%d]"), MeshIndex, PrimIndex));
+			if (!Prim.IsValid())
+			{
+				return;
+			}
+			const TSharedPtr<FJsonObject>* Attributes = nullptr;
+			int32 PositionAccessor = INDEX_NONE;
+			if (!Prim->TryGetObjectField(TEXT("attributes"), Attributes) || !Attributes ||
+				!(*Attributes)->TryGetNumberField(TEXT("POSITION"), PositionAccessor))
+			{
+				continue;
+			}
+			const TSharedPtr<FJsonObject> Accessor = GetObjectAt(Accessors, PositionAccessor);
+			int64 Count = 0;
+			if (Accessor.IsValid() && Accessor->TryGetNumberField(TEXT("count"), Count) && Count > 0)
+			{
+				Result.VertexCount += Count;
+			}
+		}
+	}
+
+	for (int32 ImageIndex = 0; ImageIndex < Images.Num(); ++ImageIndex)
+	{
+		const TSharedPtr<FJsonObject> Image = GetEntry(Images[ImageIndex], FString::Printf(TEXT("images[%d]"), ImageIndex));
+		if (!Image.IsValid())
+		{
+			return;
+		}
+		int32 BufferView = INDEX_NONE;
+		FString Uri;
+		if (Image->TryGetNumberField(TEXT("bufferView"), BufferView))
+		{
+			const TSharedPtr<FJsonObject> View = GetObjectAt(BufferViews, BufferView);
+			int64 ByteLength = 0;
+			if (View.IsValid() && View->TryGetNumberField(TEXT("byteLength"), ByteLength) && ByteLength > 0)
+			{
+				Result.EmbeddedTextureBytes += ByteLength;
+			}
+		}
+		else if (Image->TryGetStringField(TEXT("uri"), Uri))
+		{
+			if (Uri.StartsWith(TEXT("data:")))
+			{
+				Result.EmbeddedTextureBytes += UnrealMcpImportScanner::DecodedDataUriBytes(Uri);
+			}
+			else
+			{
+				Result.ExternalFiles.AddUnique(FPaths::ConvertRelativePathToFull(BaseDir, FGenericPlatformHttp::UrlDecode(Uri)));
+			}
+		}
+	}
+
+	for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); ++BufferIndex)
+	{
+		const TSharedPtr<FJsonObject> Buffer = GetEntry(Buffers[BufferIndex], FString::Printf(TEXT("buffers[%d]"), BufferIndex));
+		if (!Buffer.IsValid())
+		{
+			return;
+		}
+		FString Uri;
+		if (Buffer->TryGetStringField(TEXT("uri"), Uri) && !Uri.StartsWith(TEXT("data:")))
+		{
+			Result.ExternalFiles.AddUnique(FPaths::ConvertRelativePathToFull(BaseDir, FGenericPlatformHttp::UrlDecode(Uri)));
+		}
+	}
+
+	Result.bParsed = true;
+}
+
+void FUnrealMCPImportScanner::ScanObj(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	const FString BaseDir = FPaths::GetPath(FilePath);
+	int32 ObjectCount = 0;
+	int32 GroupCount = 0;
+	TSet<FString> UsedMaterials;
+	TArray<FString> MtlFiles;
+
+	const bool bRead = FFileHelper::LoadFileToStringWithLineVisitor(*FilePath, [&](FStringView Line)
+	{
+		Line.TrimStartInline();
+		if (Line.StartsWith(TEXT("v ")) || Line.StartsWith(TEXT("v\t")))
+		{
+			++Result.VertexCount;
+		}
+		else if (Line.StartsWith(TEXT("o ")))
+		{
+			++ObjectCount;
+		}
+		else if (Line.StartsWith(TEXT("g ")))
+		{
+			++GroupCount;
+		}
+		else if (Line.StartsWith(TEXT("usemtl ")))
+		{
+			UsedMaterials.Add(FString(Line.RightChop(7)).TrimStartAndEnd());
+		}
+		else if (Line.StartsWith(TEXT("mtllib ")))
+		{
+			const FString MtlFile = FPaths::ConvertRelativePathToFull(BaseDir, FString(Line.RightChop(7)).TrimStartAndEnd());
+			Result.ExternalFiles.AddUnique(MtlFile);
+			MtlFiles.AddUnique(MtlFile);
+		}
+	});
+
+	if (!bRead)
+	{
+		Result.Error = TEXT("Failed to read file");
+		return;
+	}
+
+	Result.FormatDetail = TEXT("obj");
+	Result.MeshCount = ObjectCount > 0 ? ObjectCount : (GroupCount > 0 ? GroupCount : (Result.VertexCount > 0 ? 1 : 0));
+	Result.MaterialCount = UsedMaterials.Num();
+
+	for (const FString& MtlFile : MtlFiles)
+	{
+		if (FPaths::FileExists(MtlFile))
+		{
+			ScanMtl(MtlFile, Result);
+		}
+	}
+
+	Result.bParsed = true;
+}
+
+void FUnrealMCPImportScanner::ScanMtl(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	const FString BaseDir = FPaths::GetPath(FilePath);
+	int32 MaterialCount = 0;
+	TSet<FString> Textures;
+
+	FFileHelper::LoadFileToStringWithLineVisitor(*FilePath, [&](FStringView Line)
+	{
+		Line.TrimStartInline();
+		if (Line.StartsWith(TEXT("newmtl ")))
+		{
+			++MaterialCount;
+		}
+		else if (Line.StartsWith(TEXT("map_")) || Line.StartsWith(TEXT("bump ")) || Line.StartsWith(TEXT("disp ")) || Line.StartsWith(TEXT("norm ")))
+		{
+			// The texture file name is the last token; options like "-bm 1.0" precede it.
+			FString Rest = FString(Line).TrimEnd();
+			int32 LastSpace = INDEX_NONE;
+			if (Rest.FindLastChar(TEXT(' '), LastSpace))
+			{
+				const FString Texture = FPaths::ConvertRelativePathToFull(BaseDir, Rest.RightChop(LastSpace + 1));
+				Textures.Add(Texture);
+				Result.ExternalFiles.AddUnique(Texture);
+			}
+		}
+	});
+
+	// Declared materials beat usemtl references when the MTL is readable.
+	Result.MaterialCount = FMath::Max(Result.MaterialCount, MaterialCount);
+	Result.TextureCount += Textures.Num();
+}
+
+void FUnrealMCPImportScanner::ScanFbx(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	using FReader = UnrealMcpImportScanner::FFbxBinaryReader;
+
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle)
+	{
+		Result.Error = TEXT("Failed to open file");
+		return;
+	}
+
+	// Binary header: "Kaydara FBX Binary  \0", 0x1A 0x00, uint32 version.
+	uint8 Header[27];
+	FMemory::Memzero(Header);
+	const bool bHeaderRead = Handle->Read(Header, sizeof(Header));
+	if (!bHeaderRead || FMemory::Memcmp(Header, "Kaydara FBX Binary  ", 20) != 0)
+	{
+		Handle.Reset();
+		ScanFbxAscii(FilePath, Result);
+		return;
+	}
+
+	uint32 Version = 0;
+	FMemory::Memcpy(&Version, Header + 23, sizeof(Version));
+	Result.FormatDetail = FString::Printf(TEXT("binary %u"), Version);
+
+	const FString BaseDir = FPaths::GetPath(FilePath);
+	FReader Reader(*Handle, Result.FileSize, Version);
+
+	auto VisitObject = [&](const FReader::FNode& Object) -> bool
+	{
+		const bool bGeometry = Object.Name == TEXT("Geometry");
+		const bool bTexture = Object.Name == TEXT("Texture");
+		const bool bVideo = Object.Name == TEXT("Video");
+
+		if (Object.Name == TEXT("Material"))
+		{
+			++Result.MaterialCount;
+			return true;
+		}
+		if (!bGeometry && !bTexture && !bVideo)
+		{
+			return true;
+		}
+
+		if (bGeometry)
+		{
+			// Properties: id, "Name\0\1Geometry", "Mesh" | "Shape" | ...
+			TArray<FReader::FProperty> Props;
+			if (!Reader.ReadProperties(Object, 3, Props))
+			{
+				return false;
+			}
+			if (Props.Num() < 3 || Props[2].String != TEXT("Mesh"))
+			{
+				return true;
+			}
+			++Result.MeshCount;
+		}
+		else if (bTexture)
+		{
+			++Result.TextureCount;
+		}
+
+		return Reader.ForEachChild(&Object, 0, [&](const FReader::FNode& Child) -> bool
+		{
+			TArray<FReader::FProperty> Props;
+			if (bGeometry && Child.Name == TEXT("Vertices"))
+			{
+				if (!Reader.ReadProperties(Child, 1, Props)) return false;
+				if (Props.Num() == 1) Result.VertexCount += Props[0].ArrayLength / 3;
+			}
+			else if (bVideo && Child.Name == TEXT("Content"))
+			{
+				if (!Reader.ReadProperties(Child, 1, Props)) return false;
+				if (Props.Num() == 1) Result.EmbeddedTextureBytes += Props[0].RawLength;
+			}
+			else if (bTexture && Child.Name == TEXT("RelativeFilename"))
+			{
+				if (!Reader.ReadProperties(Child, 1, Props)) return false;
+				if (Props.Num() == 1 && !Props[0].String.IsEmpty())
+				{
+					Result.ExternalFiles.AddUnique(FPaths::ConvertRelativePathToFull(BaseDir, Props[0].String));
+				}
+			}
+			return true;
+		});
+	};
+
+	const bool bOk = Reader.ForEachChild(nullptr, sizeof(Header), [&](const FReader::FNode& TopLevel) -> bool
+	{
+		return TopLevel.Name != TEXT("Objects") || Reader.ForEachChild(&TopLevel, 0, VisitObject);
+	});
+
+	if (!bOk)
+	{
+		Result.Error = TEXT("Malformed or truncated FBX node records");
+		return;
+	}
+	Result.bParsed = true;
+}
+
+void FUnrealMCPImportScanner::ScanFbxAscii(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	const FString BaseDir = FPaths::GetPath(FilePath);
+	bool bSawHeader = false;
+
+	const bool bRead = FFileHelper::LoadFileToStringWithLineVisitor(*FilePath, [&](FStringView Line)
+	{
+		Line.TrimStartInline();
+		if (!bSawHeader && Line.StartsWith(TEXT("; FBX")))
+		{
+			bSawHeader = true;
+		}
+		else if (Line.StartsWith(TEXT("Geometry:")))
+		{
+			if (Line.Find(TEXT("\"Mesh\"")) != INDEX_NONE)
+			{
+				++Result.MeshCount;
+			}
+		}
+		else if (Line.StartsWith(TEXT("Material:")))
+		{
+			++Result.MaterialCount;
+		}
+		else if (Line.StartsWith(TEXT("Texture:")))
+		{
+			++Result.TextureCount;
+		}
+		else if (Line.StartsWith(TEXT("Vertices:")))
+		{
+			// "Vertices: *N {" where N is the number of doubles.
+			const int32 Star = Line.Find(TEXT("*"));
+			if (Star != INDEX_NONE)
+			{
+				int64 Count = 0;
+				LexFromString(Count, *FString(Line.RightChop(Star + 1)).TrimStartAndEnd().Replace(TEXT("{"), TEXT("")));
+				Result.VertexCount += Count / 3;
+			}
+		}
+		else if (Line.StartsWith(TEXT("RelativeFilename:")))
+		{
+			FString Value = FString(Line.RightChop(17)).TrimStartAndEnd().TrimQuotes();
+			if (!Value.IsEmpty())
+			{
+				Result.ExternalFiles.AddUnique(FPaths::ConvertRelativePathToFull(BaseDir, Value));
+			}
+		}
+	});
+
+	if (!bRead || !bSawHeader)
+	{
+		Result.Error = TEXT("Not a recognized FBX file (binary or ASCII)");
+		return;
+	}
+	Result.FormatDetail = TEXT("ascii");
+	Result.bParsed = true;
+}
+
+void FUnrealMCPImportScanner::ScanPly(const FString& FilePath, FUnrealMCPImportScanResult& Result)
+{
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle)
+	{
+		Result.Error = TEXT("Failed to open file");
+		return;
+	}
+
+	// The header is ASCII and terminated by "end_header"; binary payload follows, so never read past a bounded prefix.
+	TArray<uint8> Prefix;
+	const int64 PrefixSize = FMath::Min<int64>(Result.FileSize, 64 * 1024);
+	if (!UnrealMcpImportScanner::ReadBytes(*Handle, 0, PrefixSize, Prefix))
+	{
+		Result.Error = TEXT("Failed to read PLY header");
+		return;
+	}
+
+	const FString HeaderText = UnrealMcpImportScanner::Utf8BytesToString(Prefix.GetData(), Prefix.Num());
+	TArray<FString> Lines;
+	HeaderText.ParseIntoArrayLines(Lines);
+	if (Lines.Num() == 0 || Lines[0].TrimStartAndEnd() != TEXT("ply"))
+	{
+		Result.Error = TEXT("Not a valid PLY file");
+		return;
+	}
+
+	for (const FString& RawLine : Lines)
+	{
+		const FString Line = RawLine.TrimStartAndEnd();
+		if (Line == TEXT("end_header"))
+		{
+			Result.MeshCount = 1;
+			Result.bParsed = true;
+			return;
+		}
+		if (Line.StartsWith(TEXT("format ")))
+		{
+			Result.FormatDetail = Line.RightChop(7);
+		}
+		else if (Line.StartsWith(TEXT("element vertex ")))
+		{
+			LexFromString(Result.VertexCount, *Line.RightChop(15));
+		}
+		else if (Line.StartsWith(TEXT("comment TextureFile ")))
+		{
+			Result.ExternalFiles.AddUnique(FPaths::ConvertRelativePathToFull(FPaths::GetPath(FilePath), Line.RightChop(20)));
+			++Result.TextureCount;
+		}
+	}
+
+	Result.Error = TEXT("PLY header not terminated within the first 64 KB");
+}
@@ -1,5 +1,11 @@
 #include "Commands/UnrealMCPInterchangeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPSaveQueue.h"
+#include "Commands/UnrealMCPImportCache.h"
+#include "Commands/UnrealMCPImportScanner.h"
+#include "Commands/UnrealMCPBlueprintFingerprint.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/FileManager.h"
@@ -35,6 +41,7 @@
 
 // Editor reimport
 #include "EditorReimportHandler.h"
+#include "EditorFramework/AssetImportData.h"
 
 // Interchange headers
 #include "InterchangeManager.h"
@@ -50,6 +57,8 @@
 
 // Custom FBX Material Pipeline
 #include "Pipelines/UnrealMCPFBXMaterialPipeline.h"
+#include "Pipelines/UnrealMCPTextureSuffixPipeline.h"
+#include "JsonObjectConverter.h"
 
 // Blueprint Graph Node support
 #include "EdGraph/EdGraph.h"
@@ -63,7 +72,50 @@
 #include "K2Node_FunctionResult.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
-#include "ScopedTransaction.h"
+
+namespace UnrealMcpInterchange
+{
+	/** The asset's AssetImportData subobject, for classes that have one (meshes, textures, ...). */
+	static UAssetImportData* GetAssetImportData(UObject* Asset)
+	{
+		const FObjectProperty* Prop = Asset ? FindFProperty<FObjectProperty>(Asset->GetClass(), TEXT("AssetImportData")) : nullptr;
+		return Prop ? Cast<UAssetImportData>(Prop->GetObjectPropertyValue_InContainer(Asset)) : nullptr;
+	}
+
+	/** True when AssetPath exists and its import data lists SourcePath, imported at the file's current timestamp. */
+	static bool WasImportedFromCurrentSource(const FString& AssetPath, const FString& SourcePath)
+	{
+		if (!UEditorAssetLibrary::DoesAssetExist(AssetPath))
+		{
+			return false;
+		}
+
+		const UAssetImportData* ImportData = GetAssetImportData(FUnrealMCPCommonUtils::LoadAssetByPathSmart(AssetPath));
+		if (!ImportData)
+		{
+			return false;
+		}
+
+		const FDateTime SourceTime = IFileManager::Get().GetTimeStamp(*SourcePath);
+		for (const FAssetImportInfo::FSourceFile& File : ImportData->SourceData.SourceFiles)
+		{
+			if (FPaths::IsSamePath(ImportData->ResolveImportFilename(File.RelativeFilename), SourcePath) && File.Timestamp == SourceTime)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Cache settings hash for reimport_asset: the asset's own import settings, which reimport reuses. */
+	static FString GetReimportSettingsHash(UObject* Asset)
+	{
+		UAssetImportData* ImportData = GetAssetImportData(Asset);
+		return ImportData
+			? FString::Printf(TEXT("reimport:%08x"), FUnrealMCPPropertyPath::Get().HashState(ImportData, false))
+			: FString(TEXT("reimport"));
+	}
+}
 
 FUnrealMCPInterchangeCommands::FUnrealMCPInterchangeCommands()
 {
@@ -99,6 +151,10 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleCommand(const FStri
 	{
 		return HandleGetInterchangeInfo(Params);
 	}
+	else if (CommandType == TEXT("scan_import_sources"))
+	{
+		return HandleScanImportSources(Params);
+	}
 	else if (CommandType == TEXT("create_interchange_pipeline_blueprint"))
 	{
 		return HandleCreateInterchangePipelineBlueprint(Params);
@@ -191,10 +247,48 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleImportModel(const T
 	Params->TryGetBoolField(TEXT("import_skeleton"), bImportSkeleton);
 	Params->TryGetBoolField(TEXT("create_physics_asset"), bCreatePhysicsAsset);
 
+	bool bForce = false;
+	Params->TryGetBoolField(TEXT("force"), bForce);
+
 	// Get file info
 	FString FileExtension = FPaths::GetExtension(FilePath).ToLower();
 	FString FileName = FPaths::GetBaseFilename(FilePath);
 
+	TSharedPtr<FJsonObject> SettingsObj = MakeShared<FJsonObject>();
+	SettingsObj->SetBoolField(TEXT("import_mesh"), bImportMesh);
+	SettingsObj->SetBoolField(TEXT("import_material"), bImportMaterial);
+	SettingsObj->SetBoolField(TEXT("import_texture"), bImportTexture);
+	SettingsObj->SetBoolField(TEXT("import_skeleton"), bImportSkeleton);
+	SettingsObj->SetBoolField(TEXT("create_physics_asset"), bCreatePhysicsAsset);
+
+	// Import cache: skip sources whose content and settings match the last recorded import.
+	// Destination is part of the settings hash so importing the same file elsewhere is never skipped.
+	TSharedPtr<FJsonObject> SettingsKeyObj = MakeShared<FJsonObject>(*SettingsObj);
+	SettingsKeyObj->SetStringField(TEXT("destination"), DestinationPath);
+	const FString SettingsHash = FUnrealMCPImportCache::HashSettings(SettingsKeyObj);
+
+	// Records are keyed by the asset the import produces: <destination>/<file name>.
+	const FString ExpectedAssetPath = DestinationPath / FileName;
+
+	FString CacheReason = TEXT("forced");
+	bool bUpToDate = false;
+	if (!bForce)
+	{
+		FUnrealMCPImportCache& Cache = FUnrealMCPImportCache::Get();
+		bUpToDate = Cache.IsUpToDate(FilePath, ExpectedAssetPath, SettingsHash, CacheReason);
+
+		// No record yet, but the asset was imported (e.g. from the editor) from this exact source revision:
+		// record it under these settings so the next call is a stat-only check.
+		if (!bUpToDate && CacheReason == TEXT("no_cache_record") && UnrealMcpInterchange::WasImportedFromCurrentSource(ExpectedAssetPath, FilePath))
+		{
+			Cache.RecordImport(FilePath, ExpectedAssetPath, SettingsHash);
+			bUpToDate = Cache.IsUpToDate(FilePath, ExpectedAssetPath, SettingsHash, CacheReason);
+		}
+	}
+
+	FString ContentHash;
+	FUnrealMCPImportCache::Get().GetContentHash(FilePath, ContentHash);
+
 	// Note: For full Interchange import, use UE Editor's Import dialog
 	// This command provides the configuration and validation
 	// The actual import should be triggered via Editor or Interchange Manager
@@ -203,15 +297,21 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleImportModel(const T
 	ResultObj->SetBoolField(TEXT("success"), true);
 	ResultObj->SetStringField(TEXT("destination"), DestinationPath);
 	ResultObj->SetStringField(TEXT("source_file"), FilePath);
-	ResultObj->SetStringField(TEXT("message"), TEXT("Import configuration validated. Use UE Editor to complete import or call reimport_asset for existing assets."));
+	ResultObj->SetBoolField(TEXT("skipped"), bUpToDate);
+	ResultObj->SetStringField(TEXT("reason"), CacheReason);
+	ResultObj->SetStringField(TEXT("content_hash"), ContentHash);
+	ResultObj->SetStringField(TEXT("settings_hash"), SettingsHash);
+	ResultObj->SetStringField(TEXT("expected_asset_path"), ExpectedAssetPath);
+	if (bUpToDate)
+	{
+		ResultObj->SetStringField(TEXT("message"), TEXT("Source unchanged since last import; import skipped. Pass force=true to import anyway."));
+	}
+	else
+	{
+		ResultObj->SetStringField(TEXT("message"), TEXT("Import configuration validated. Use UE Editor to complete import or call reimport_asset for existing assets."));
+	}
 	
 	// Return import settings
-	TSharedPtr<FJsonObject> SettingsObj = MakeShared<FJsonObject>();
-	SettingsObj->SetBoolField(TEXT("import_mesh"), bImportMesh);
-	SettingsObj->SetBoolField(TEXT("import_material"), bImportMaterial);
-	SettingsObj->SetBoolField(TEXT("import_texture"), bImportTexture);
-	SettingsObj->SetBoolField(TEXT("import_skeleton"), bImportSkeleton);
-	SettingsObj->SetBoolField(TEXT("create_physics_asset"), bCreatePhysicsAsset);
 	ResultObj->SetObjectField(TEXT("import_settings"), SettingsObj);
 	
 	// Return file info
@@ -716,11 +816,69 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleReimportAsset(const
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Asset type does not support reimport"));
 	}
 
+	bool bForce = false;
+	Params->TryGetBoolField(TEXT("force"), bForce);
+
+	// Import cache: skip the reimport when every source file is unchanged since the last recorded import.
+	TArray<FString> SourceFiles;
+	FReimportManager::Instance()->CanReimport(Asset, &SourceFiles);
+	SourceFiles.RemoveAll([](const FString& S) { return S.IsEmpty(); });
+
+	FString CacheReason = bForce ? TEXT("forced") : TEXT("no_source_file");
+	bool bUpToDate = false;
+	if (!bForce && SourceFiles.Num() > 0)
+	{
+		const FString SettingsHash = UnrealMcpInterchange::GetReimportSettingsHash(Asset);
+		bUpToDate = true;
+		for (const FString& SourceFile : SourceFiles)
+		{
+			if (!FUnrealMCPImportCache::Get().IsUpToDate(SourceFile, AssetPath, SettingsHash, CacheReason))
+			{
+				bUpToDate = false;
+				break;
+			}
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> SourceArray;
+	for (const FString& SourceFile : SourceFiles)
+	{
+		SourceArray.Add(MakeShared<FJsonValueString>(SourceFile));
+	}
+
+	if (bUpToDate)
+	{
+		TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+		ResultObj->SetBoolField(TEXT("success"), true);
+		ResultObj->SetBoolField(TEXT("skipped"), true);
+		ResultObj->SetStringField(TEXT("reason"), CacheReason);
+		ResultObj->SetArrayField(TEXT("source_files"), SourceArray);
+		ResultObj->SetStringField(TEXT("asset_path"), AssetPath); // legacy
+		FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, AssetPath);
+		ResultObj->SetStringField(TEXT("message"), TEXT("Source unchanged since last import; reimport skipped. Pass force=true to reimport anyway."));
+
+		UE_LOG(LogTemp, Log, TEXT("Skipped reimport for asset: %s (%s)"), *AssetPath, *CacheReason);
+		return ResultObj;
+	}
+
 	// Trigger reimport
 	bool bReimportSuccess = FReimportManager::Instance()->Reimport(Asset, true);
 
+	if (bReimportSuccess)
+	{
+		// Hash after the reimport: that is the state the next reimport_asset call will compare against.
+		const FString SettingsHash = UnrealMcpInterchange::GetReimportSettingsHash(Asset);
+		for (const FString& SourceFile : SourceFiles)
+		{
+			FUnrealMCPImportCache::Get().RecordImport(SourceFile, AssetPath, SettingsHash);
+		}
+	}
+
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), bReimportSuccess);
+	ResultObj->SetBoolField(TEXT("skipped"), false);
+	ResultObj->SetStringField(TEXT("reason"), CacheReason);
+	ResultObj->SetArrayField(TEXT("source_files"), SourceArray);
 	ResultObj->SetStringField(TEXT("asset_path"), AssetPath); // legacy
 	FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, AssetPath);
 	ResultObj->SetStringField(TEXT("message"), bReimportSuccess ? TEXT("Asset reimport triggered") : TEXT("Reimport failed"));
@@ -765,6 +923,153 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleGetInterchangeInfo(
 	return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleScanImportSources(const TSharedPtr<FJsonObject>& Params)
+{
+	TArray<FString> FilePaths;
+
+	const TArray<TSharedPtr<FJsonValue>>* FilePathsArray = nullptr;
+	if (Params->TryGetArrayField(TEXT("file_paths"), FilePathsArray) && FilePathsArray)
+	{
+		for (const TSharedPtr<FJsonValue>& V : *FilePathsArray)
+		{
+			const FString Path = V.IsValid() ? V->AsString() : FString();
+			if (!Path.IsEmpty())
+			{
+				FilePaths.AddUnique(Path);
+			}
+		}
+	}
+
+	FString Directory;
+	if (Params->TryGetStringField(TEXT("directory"), Directory) && !Directory.IsEmpty())
+	{
+		if (!FPaths::DirectoryExists(Directory))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponseEx(FString::Printf(TEXT("Directory not found: %s"), *Directory), TEXT("ERR_INVALID_PATH"), TEXT(""));
+		}
+
+		bool bRecursive = true;
+		Params->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+		for (const FString& Format : GetSupportedInterchangeFormats())
+		{
+			TArray<FString> Found;
+			const FString Wildcard = FString::Printf(TEXT("*.%s"), *Format);
+			if (bRecursive)
+			{
+				IFileManager::Get().FindFilesRecursive(Found, *Directory, *Wildcard, true, false);
+			}
+			else
+			{
+				IFileManager::Get().FindFiles(Found, *FPaths::Combine(Directory, Wildcard), true, false);
+				for (FString& File : Found)
+				{
+					File = FPaths::Combine(Directory, File);
+				}
+			}
+			for (const FString& File : Found)
+			{
+				FilePaths.AddUnique(File);
+			}
+		}
+	}
+
+	if (FilePaths.Num() == 0)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'file_paths' and/or 'directory' with at least one supported source file"));
+	}
+
+	// Optional budget: flag files that would be expensive to import.
+	double MaxFileSizeMb = 0.0;
+	Params->TryGetNumberField(TEXT("max_file_size_mb"), MaxFileSizeMb);
+	int64 MaxVertices = 0;
+	Params->TryGetNumberField(TEXT("max_vertices"), MaxVertices);
+
+	TArray<FString> Supported;
+	TArray<TSharedPtr<FJsonValue>> UnsupportedArray;
+	for (const FString& Path : FilePaths)
+	{
+		if (IsValidInterchangeFile(Path))
+		{
+			Supported.Add(Path);
+		}
+		else
+		{
+			UnsupportedArray.Add(MakeShared<FJsonValueString>(Path));
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TArray<FUnrealMCPImportScanResult> Results = FUnrealMCPImportScanner::ScanFiles(Supported);
+	const double WallTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	int32 ParsedCount = 0;
+	int32 FailedCount = 0;
+	int64 TotalSize = 0;
+	int64 TotalVertices = 0;
+	int64 TotalEmbeddedBytes = 0;
+	int32 TotalMeshes = 0;
+	int32 TotalMaterials = 0;
+	int32 TotalTextures = 0;
+	int32 MissingExternalCount = 0;
+	TArray<TSharedPtr<FJsonValue>> FilesArray;
+	TArray<TSharedPtr<FJsonValue>> OversizedArray;
+
+	for (const FUnrealMCPImportScanResult& Result : Results)
+	{
+		TSharedPtr<FJsonObject> FileObj = Result.ToJson();
+
+		const bool bOversized = (MaxFileSizeMb > 0.0 && Result.FileSize > static_cast<int64>(MaxFileSizeMb * 1024.0 * 1024.0)) ||
+			(MaxVertices > 0 && Result.VertexCount > MaxVertices);
+		FileObj->SetBoolField(TEXT("oversized"), bOversized);
+		if (bOversized)
+		{
+			OversizedArray.Add(MakeShared<FJsonValueString>(Result.FilePath));
+		}
+
+		if (Result.bParsed)
+		{
+			++ParsedCount;
+		}
+		else
+		{
+			++FailedCount;
+		}
+		TotalSize += Result.FileSize;
+		TotalVertices += Result.VertexCount;
+		TotalEmbeddedBytes += Result.EmbeddedTextureBytes;
+		TotalMeshes += Result.MeshCount;
+		TotalMaterials += Result.MaterialCount;
+		TotalTextures += Result.TextureCount;
+		MissingExternalCount += Result.MissingExternalFiles.Num();
+		FilesArray.Add(MakeShared<FJsonValueObject>(FileObj));
+	}
+
+	TSharedPtr<FJsonObject> SummaryObj = MakeShared<FJsonObject>();
+	SummaryObj->SetNumberField(TEXT("file_count"), Results.Num());
+	SummaryObj->SetNumberField(TEXT("parsed"), ParsedCount);
+	SummaryObj->SetNumberField(TEXT("failed"), FailedCount);
+	SummaryObj->SetNumberField(TEXT("total_size"), static_cast<double>(TotalSize));
+	SummaryObj->SetNumberField(TEXT("total_meshes"), TotalMeshes);
+	SummaryObj->SetNumberField(TEXT("total_materials"), TotalMaterials);
+	SummaryObj->SetNumberField(TEXT("total_textures"), TotalTextures);
+	SummaryObj->SetNumberField(TEXT("total_vertices"), static_cast<double>(TotalVertices));
+	SummaryObj->SetNumberField(TEXT("total_embedded_texture_bytes"), static_cast<double>(TotalEmbeddedBytes));
+	SummaryObj->SetNumberField(TEXT("missing_external_files"), MissingExternalCount);
+	SummaryObj->SetArrayField(TEXT("oversized"), OversizedArray);
+	SummaryObj->SetArrayField(TEXT("unsupported"), UnsupportedArray);
+	SummaryObj->SetNumberField(TEXT("wall_time_ms"), WallTimeMs);
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetArrayField(TEXT("files"), FilesArray);
+	ResultObj->SetObjectField(TEXT("summary"), SummaryObj);
+
+	UE_LOG(LogTemp, Log, TEXT("Scanned %d import source(s) in %.1f ms"), Results.Num(), WallTimeMs);
+
+	return ResultObj;
+}
+
 bool FUnrealMCPInterchangeCommands::IsValidInterchangeFile(const FString& FilePath) const
 {
 	FString Extension = FPaths::GetExtension(FilePath).ToLower();
@@ -930,6 +1235,11 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleCreateInterchangePi
 			// Custom FBX Material Instance Pipeline
 			ParentPipelineClass = UUnrealMCPFBXMaterialPipeline::StaticClass();
 		}
+		else if (ParentClassName == TEXT("TextureSuffixPipeline") || ParentClassName == TEXT("UUnrealMCPTextureSuffixPipeline"))
+		{
+			// Native texture suffix classification pipeline
+			ParentPipelineClass = UUnrealMCPTextureSuffixPipeline::StaticClass();
+		}
 	}
 
 	// Create package
@@ -982,15 +1292,7 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleCreateInterchangePi
 	FKismetEditorUtilities::CompileBlueprint(NewPipelineBlueprint);
 
 	// Persist asset to disk so it can be found by AssetRegistry on next session
-	// Prefer object path for stability (matches EditorAssetLibrary expectations)
-	if (!ObjectPath.IsEmpty())
-	{
-		UEditorAssetLibrary::SaveAsset(ObjectPath, false);
-	}
-	else
-	{
-		UEditorAssetLibrary::SaveAsset(FullAssetPath, false);
-	}
+	FUnrealMCPSaveQueue::Get().SaveOrDefer(NewPipelineBlueprint);
 
 
 
@@ -1222,6 +1524,12 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleConfigureInterchang
 						PropInfo->SetBoolField(TEXT("set"), true);
 					}
 				}
+				else
+				{
+					// Arrays, maps, structs and enums (e.g. SuffixRules, TextureParameterMapping) go through the JSON converter
+					const bool bSet = FJsonObjectConverter::JsonValueToUProperty(Setting.Value, Property, PropertyAddress, 0, 0);
+					PropInfo->SetBoolField(TEXT("set"), bSet);
+				}
 				
 				ConfiguredProperties.Add(MakeShared<FJsonValueObject>(PropInfo));
 			}
@@ -1229,7 +1537,7 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleConfigureInterchang
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Configure Interchange Pipeline")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Configure Interchange Pipeline")));
 	PipelineBlueprint->Modify();
 	
 	// Mark the blueprint as modified
@@ -1315,6 +1623,14 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleGetInterchangePipel
 	ResultObj->SetStringField(TEXT("resolved_asset_path"), PipelineBlueprint->GetPathName());
 	ResultObj->SetStringField(TEXT("blueprint_name"), PipelineBlueprint->GetName());
 
+	// Opt-in: the structural fingerprint walks every graph of the pipeline.
+	bool bIncludeFingerprint = false;
+	Params->TryGetBoolField(TEXT("include_fingerprint"), bIncludeFingerprint);
+	if (bIncludeFingerprint)
+	{
+		ResultObj->SetStringField(TEXT("fingerprint"), FUnrealMCPBlueprintFingerprint::Compute(PipelineBlueprint));
+	}
+
 	// Get parent class info
 	if (PipelineBlueprint->ParentClass)
 	{
@@ -1561,7 +1877,7 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleAddInterchangePipel
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Interchange Pipeline Node")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Interchange Pipeline Node")));
 	PipelineBlueprint->Modify();
 
 	// Get the event graph (or first available graph)
@@ -1820,7 +2136,7 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleConnectInterchangeP
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Connect Interchange Pipeline Nodes")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Connect Interchange Pipeline Nodes")));
 	PipelineBlueprint->Modify();
 	if (FoundGraph)
 	{
@@ -2031,7 +2347,7 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleAddInterchangeItera
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add Interchange IterateNodes Block")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add Interchange IterateNodes Block")));
 	PipelineBlueprint->Modify();
 	TargetGraph->Modify();
 
@@ -2108,26 +2424,78 @@ TSharedPtr<FJsonObject> FUnrealMCPInterchangeCommands::HandleCompileInterchangeP
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Pipeline not found: %s"), *PipelinePath));
 	}
 
-	// Mark as modified and compile the blueprint
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(PipelineBlueprint);
-	PipelineBlueprint->MarkPackageDirty();
+	bool bForce = false;
+	Params->TryGetBoolField(TEXT("force"), bForce);
 
-	// Compile the blueprint
-	FKismetEditorUtilities::CompileBlueprint(PipelineBlueprint, EBlueprintCompileOptions::None);
+	// Defensive re-compiles are common; skip compile and save when nothing structural changed.
+	const FString Fingerprint = FUnrealMCPBlueprintFingerprint::Compute(PipelineBlueprint);
+	const bool bCompileUpToDate = !bForce && FUnrealMCPBlueprintFingerprint::Get().IsCompileUpToDate(PipelineBlueprint, Fingerprint);
+	const bool bPackageDirty = PipelineBlueprint->GetOutermost()->IsDirty();
+
+	FString CompiledFingerprint = Fingerprint;
+	if (!bCompileUpToDate)
+	{
+		if (bForce)
+		{
+			// Mark as modified so a forced compile also refreshes the skeleton
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(PipelineBlueprint);
+			PipelineBlueprint->MarkPackageDirty();
+		}
 
-	// Save the asset
-	bool bSaved = UEditorAssetLibrary::SaveLoadedAsset(PipelineBlueprint, false);
+		// Compile the blueprint
+		FKismetEditorUtilities::CompileBlueprint(PipelineBlueprint, EBlueprintCompileOptions::None);
+
+		CompiledFingerprint = FUnrealMCPBlueprintFingerprint::Compute(PipelineBlueprint);
+		FUnrealMCPBlueprintFingerprint::Get().RecordCompile(PipelineBlueprint, CompiledFingerprint);
+	}
+
+	// Save the asset (only when something is unsaved)
+	const bool bNeedsSave = bForce || !bCompileUpToDate || bPackageDirty;
+	const bool bSaveDeferred = bNeedsSave && FUnrealMCPSaveQueue::Get().IsDeferring();
+	// SaveOrDefer also returns true when it only queued the save
+	const bool bSaved = bNeedsSave && FUnrealMCPSaveQueue::Get().SaveOrDefer(PipelineBlueprint) && !bSaveDeferred;
+	const bool bCompiled = !bCompileUpToDate;
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
 	ResultObj->SetStringField(TEXT("pipeline_path"), PipelinePath);
 	ResultObj->SetStringField(TEXT("resolved_asset_path"), PipelineBlueprint->GetPathName());
-	ResultObj->SetStringField(TEXT("status"), bSaved ? TEXT("Compiled and Saved") : TEXT("Compiled"));
-	ResultObj->SetStringField(TEXT("message"), bSaved ? 
-		TEXT("Pipeline compiled and saved successfully.") : 
-		TEXT("Pipeline compiled but save failed. Please save manually."));
+	ResultObj->SetStringField(TEXT("fingerprint"), CompiledFingerprint);
+	ResultObj->SetBoolField(TEXT("compiled"), bCompiled);
+	ResultObj->SetBoolField(TEXT("saved"), bSaved);
+	if (bSaveDeferred)
+	{
+		ResultObj->SetBoolField(TEXT("save_deferred"), true);
+	}
+
+	// Status text follows the compiled/saved/save_deferred fields above
+	const TCHAR* Status = nullptr;
+	FString Message;
+	if (!bNeedsSave)
+	{
+		ResultObj->SetBoolField(TEXT("skipped"), true);
+		Status = TEXT("Up to date");
+		Message = TEXT("Pipeline unchanged since its last compile; nothing to compile or save. Pass force=true to recompile.");
+	}
+	else if (bSaveDeferred)
+	{
+		Status = TEXT("Save deferred");
+		Message = bCompiled ? TEXT("Pipeline compiled; save queued until the batch ends.") : TEXT("Pipeline already compiled; save queued until the batch ends.");
+	}
+	else if (bSaved)
+	{
+		Status = bCompiled ? TEXT("Compiled and saved") : TEXT("Saved");
+		Message = bCompiled ? TEXT("Pipeline compiled and saved successfully.") : TEXT("Pipeline already compiled; unsaved changes were saved.");
+	}
+	else
+	{
+		Status = bCompiled ? TEXT("Compiled") : TEXT("Save failed");
+		Message = bCompiled ? TEXT("Pipeline compiled but save failed. Please save manually.") : TEXT("Pipeline already compiled but save failed. Please save manually.");
+	}
+	ResultObj->SetStringField(TEXT("status"), Status);
+	ResultObj->SetStringField(TEXT("message"), Message);
 
-	UE_LOG(LogTemp, Log, TEXT("Compiled pipeline %s (Saved: %s)"), *PipelinePath, bSaved ? TEXT("Yes") : TEXT("No"));
+	UE_LOG(LogTemp, Log, TEXT("Compile pipeline %s: %s"), *PipelinePath, Status);
 
 	return ResultObj;
 }
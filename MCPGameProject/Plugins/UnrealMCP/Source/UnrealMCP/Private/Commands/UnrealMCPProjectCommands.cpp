@@ -1,6 +1,213 @@
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPSaveQueue.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 #include "GameFramework/InputSettings.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+namespace UnrealMcpInputMappings
+{
+    /** A modifier or trigger to instance on a key mapping. */
+    struct FInstancedSpec
+    {
+        UClass* Class = nullptr;
+        TSharedPtr<FJsonObject> Properties;
+    };
+
+    struct FKeySpec
+    {
+        FKey Key;
+        TArray<FInstancedSpec> Modifiers;
+        TArray<FInstancedSpec> Triggers;
+        /** Indices into the action specs of modifier-key actions this mapping is chorded with (legacy shift/ctrl/alt/cmd). */
+        TArray<int32> Chords;
+    };
+
+    struct FActionSpec
+    {
+        FString Name;
+        EInputActionValueType ValueType = EInputActionValueType::Boolean;
+        /** value_type was passed; otherwise ValueType only applies to newly created actions. */
+        bool bExplicitValueType = false;
+        TArray<FKeySpec> Keys;
+        FString AssetPath;
+        UInputAction* Existing = nullptr;
+    };
+
+    static bool ParseKey(const FString& KeyName, FKey& OutKey)
+    {
+        OutKey = FKey(*KeyName);
+        return OutKey.IsValid();
+    }
+
+    static bool ParseValueType(const FString& Name, EInputActionValueType& OutType)
+    {
+        if (Name.IsEmpty() || Name.Equals(TEXT("Boolean"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("Digital"), ESearchCase::IgnoreCase))
+        {
+            OutType = EInputActionValueType::Boolean;
+        }
+        else if (Name.Equals(TEXT("Axis1D"), ESearchCase::IgnoreCase))
+        {
+            OutType = EInputActionValueType::Axis1D;
+        }
+        else if (Name.Equals(TEXT("Axis2D"), ESearchCase::IgnoreCase))
+        {
+            OutType = EInputActionValueType::Axis2D;
+        }
+        else if (Name.Equals(TEXT("Axis3D"), ESearchCase::IgnoreCase))
+        {
+            OutType = EInputActionValueType::Axis3D;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /** Entries are a class name ("Negate", "InputModifierNegate", a path) or {type, properties}. */
+    static void ParseInstanced(const TSharedPtr<FJsonObject>& Obj, const TCHAR* Field, UClass* BaseClass, const TCHAR* Prefix,
+        TArray<FInstancedSpec>& Out, TArray<FString>& OutErrors, const FString& Context)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+        if (!Obj->TryGetArrayField(Field, Entries))
+        {
+            return;
+        }
+        for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+        {
+            FInstancedSpec Spec;
+            FString TypeName;
+            const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+            if (Entry->TryGetObject(EntryObj))
+            {
+                (*EntryObj)->TryGetStringField(TEXT("type"), TypeName);
+                const TSharedPtr<FJsonObject>* Props = nullptr;
+                if ((*EntryObj)->TryGetObjectField(TEXT("properties"), Props))
+                {
+                    Spec.Properties = *Props;
+                }
+            }
+            else
+            {
+                Entry->TryGetString(TypeName);
+            }
+
+            FUnrealMCPClassIndex& Classes = FUnrealMCPClassIndex::Get();
+            TArray<FString> Candidates;
+            Spec.Class = Classes.FindClass(TypeName, BaseClass, &Candidates);
+            if (!Spec.Class && Candidates.Num() == 0 && !TypeName.StartsWith(Prefix))
+            {
+                Spec.Class = Classes.FindClass(Prefix + TypeName, BaseClass, &Candidates);
+            }
+            if (!Spec.Class || Spec.Class->HasAnyClassFlags(CLASS_Abstract))
+            {
+                OutErrors.Add(FString::Printf(TEXT("%s: unknown or ambiguous %s '%s'"), *Context, Field, *TypeName));
+                continue;
+            }
+            Out.Add(MoveTemp(Spec));
+        }
+    }
+
+    /**
+     * Apply each spec's properties to a transient instance of its class, so bad paths or values are reported
+     * before anything is created. The instance starts from the class defaults, like the ones Instantiate makes.
+     */
+    static void ValidateProperties(const TArray<FInstancedSpec>& Specs, TArray<FString>& OutErrors, const FString& Context)
+    {
+        for (const FInstancedSpec& Spec : Specs)
+        {
+            if (!Spec.Properties.IsValid())
+            {
+                continue;
+            }
+            UObject* Probe = NewObject<UObject>(GetTransientPackage(), Spec.Class);
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Spec.Properties->Values)
+            {
+                FString Err;
+                if (!FUnrealMCPPropertyPath::Get().SetValue(Probe, Pair.Key, Pair.Value, Err))
+                {
+                    OutErrors.Add(FString::Printf(TEXT("%s: %s.%s: %s"), *Context, *Spec.Class->GetName(), *Pair.Key, *Err));
+                }
+            }
+            Probe->MarkAsGarbage();
+        }
+    }
+
+    /** Chord trigger set of an existing mapping, to tell "Shift+Space" apart from "Space". */
+    static TArray<const UInputAction*> GetChordActions(const FEnhancedActionKeyMapping& Mapping)
+    {
+        TArray<const UInputAction*> Out;
+        for (const UInputTrigger* Trigger : Mapping.Triggers)
+        {
+            if (const UInputTriggerChordAction* Chord = Cast<UInputTriggerChordAction>(Trigger))
+            {
+                Out.Add(Chord->ChordAction);
+            }
+        }
+        return Out;
+    }
+
+    static void Instantiate(const TArray<FInstancedSpec>& Specs, UObject* Outer, TArray<UObject*>& OutObjects,
+        TArray<FString>& OutErrors, const FString& Context)
+    {
+        for (const FInstancedSpec& Spec : Specs)
+        {
+            UObject* Instance = NewObject<UObject>(Outer, Spec.Class, NAME_None, RF_Transactional);
+            if (Spec.Properties.IsValid())
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Spec.Properties->Values)
+                {
+                    FString Err;
+                    if (!FUnrealMCPPropertyPath::Get().SetValue(Instance, Pair.Key, Pair.Value, Err))
+                    {
+                        OutErrors.Add(FString::Printf(TEXT("%s: %s.%s: %s"), *Context, *Spec.Class->GetName(), *Pair.Key, *Err));
+                    }
+                }
+            }
+            OutObjects.Add(Instance);
+        }
+    }
+
+    /** Existing asset of the expected class at AssetPath; sets OutError when something else lives there. */
+    template <typename T>
+    static T* FindExistingAsset(const FString& AssetPath, FString& OutError)
+    {
+        FString ObjectPath;
+        if (!FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(AssetPath, ObjectPath, OutError))
+        {
+            return nullptr;
+        }
+        if (!FPackageName::DoesPackageExist(AssetPath) && !FindPackage(nullptr, *AssetPath))
+        {
+            return nullptr;
+        }
+        UObject* Existing = LoadObject<UObject>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+        if (Existing && !Existing->IsA<T>())
+        {
+            OutError = FString::Printf(TEXT("'%s' exists and is a %s, not a %s"), *AssetPath, *Existing->GetClass()->GetName(), *T::StaticClass()->GetName());
+            return nullptr;
+        }
+        return Cast<T>(Existing);
+    }
+
+    template <typename T>
+    static T* CreateAsset(const FString& AssetPath)
+    {
+        UPackage* Package = CreatePackage(*AssetPath);
+        T* Asset = NewObject<T>(Package, FName(*FPackageName::GetLongPackageAssetName(AssetPath)), RF_Public | RF_Standalone | RF_Transactional);
+        FAssetRegistryModule::AssetCreated(Asset);
+        return Asset;
+    }
+}
 
 FUnrealMCPProjectCommands::FUnrealMCPProjectCommands()
 {
@@ -12,6 +219,10 @@ TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCommand(const FString&
     {
         return HandleCreateInputMapping(Params);
     }
+    else if (CommandType == TEXT("create_input_mappings"))
+    {
+        return HandleCreateInputMappings(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown project command: %s"), *CommandType));
 }
@@ -63,10 +274,546 @@ TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCreateInputMapping(cons
 
     // Add the mapping
     InputSettings->AddActionMapping(ActionMapping);
-    InputSettings->SaveConfig();
+    FUnrealMCPSaveQueue::Get().SaveConfigOrDefer(InputSettings);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("action_name"), ActionName);
     ResultObj->SetStringField(TEXT("key"), Key);
     return ResultObj;
-} 
\ No newline at end of file
+} 
+
+TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCreateInputMappings(const TSharedPtr<FJsonObject>& Params)
+{
+    using namespace UnrealMcpInputMappings;
+
+    const double StartTime = FPlatformTime::Seconds();
+    bool bReplace = false;
+    Params->TryGetBoolField(TEXT("replace"), bReplace);
+
+    // Validate everything before touching settings or assets, so a bad entry leaves the project unchanged
+    TArray<FString> Errors;
+    TArray<FInputActionKeyMapping> ActionMappings;
+    TArray<FInputAxisKeyMapping> AxisMappings;
+
+    const TArray<TSharedPtr<FJsonValue>>* ActionValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("action_mappings"), ActionValues))
+    {
+        for (int32 Index = 0; Index < ActionValues->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+            FString ActionName;
+            FString KeyName;
+            if (!(*ActionValues)[Index]->TryGetObject(EntryObj) ||
+                !(*EntryObj)->TryGetStringField(TEXT("action_name"), ActionName) ||
+                !(*EntryObj)->TryGetStringField(TEXT("key"), KeyName))
+            {
+                Errors.Add(FString::Printf(TEXT("action_mappings[%d]: expected {action_name, key}"), Index));
+                continue;
+            }
+            FInputActionKeyMapping& Mapping = ActionMappings.AddDefaulted_GetRef();
+            Mapping.ActionName = FName(*ActionName);
+            if (!ParseKey(KeyName, Mapping.Key))
+            {
+                Errors.Add(FString::Printf(TEXT("action_mappings[%d]: unknown key '%s'"), Index, *KeyName));
+            }
+            // The modifier flags are bitfields, so they can't bind to TryGetBoolField directly
+            bool bShift = false, bCtrl = false, bAlt = false, bCmd = false;
+            (*EntryObj)->TryGetBoolField(TEXT("shift"), bShift);
+            (*EntryObj)->TryGetBoolField(TEXT("ctrl"), bCtrl);
+            (*EntryObj)->TryGetBoolField(TEXT("alt"), bAlt);
+            (*EntryObj)->TryGetBoolField(TEXT("cmd"), bCmd);
+            Mapping.bShift = bShift;
+            Mapping.bCtrl = bCtrl;
+            Mapping.bAlt = bAlt;
+            Mapping.bCmd = bCmd;
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* AxisValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("axis_mappings"), AxisValues))
+    {
+        for (int32 Index = 0; Index < AxisValues->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+            FString AxisName;
+            FString KeyName;
+            if (!(*AxisValues)[Index]->TryGetObject(EntryObj) ||
+                !(*EntryObj)->TryGetStringField(TEXT("axis_name"), AxisName) ||
+                !(*EntryObj)->TryGetStringField(TEXT("key"), KeyName))
+            {
+                Errors.Add(FString::Printf(TEXT("axis_mappings[%d]: expected {axis_name, key}"), Index));
+                continue;
+            }
+            FInputAxisKeyMapping& Mapping = AxisMappings.AddDefaulted_GetRef();
+            Mapping.AxisName = FName(*AxisName);
+            if (!ParseKey(KeyName, Mapping.Key))
+            {
+                Errors.Add(FString::Printf(TEXT("axis_mappings[%d]: unknown key '%s'"), Index, *KeyName));
+            }
+            double Scale = 1.0;
+            (*EntryObj)->TryGetNumberField(TEXT("scale"), Scale);
+            Mapping.Scale = static_cast<float>(Scale);
+        }
+    }
+
+    // Optional Enhanced Input assets: explicit actions, or one action per legacy action/axis name
+    const TSharedPtr<FJsonObject>* EnhancedObj = nullptr;
+    const bool bEnhanced = Params->TryGetObjectField(TEXT("enhanced_input"), EnhancedObj);
+    TArray<FActionSpec> ActionSpecs;
+    FString ContextPath;
+    UInputMappingContext* ExistingContext = nullptr;
+    if (bEnhanced)
+    {
+        const TSharedPtr<FJsonObject>& Enhanced = *EnhancedObj;
+        FString Folder = TEXT("/Game/Input");
+        Enhanced->TryGetStringField(TEXT("path"), Folder);
+        FString Err;
+        if (!FUnrealMCPCommonUtils::NormalizeLongPackageFolder(Folder, Folder, Err))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(TEXT("Invalid enhanced_input.path"), TEXT("ERR_INVALID_PATH"), Err);
+        }
+        if (!FUnrealMCPCommonUtils::IsWritePathAllowed(Folder, Err))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponseEx(TEXT("Write path not allowed"), TEXT("ERR_WRITE_PATH_NOT_ALLOWED"), Err);
+        }
+
+        FString ContextName = TEXT("IMC_Default");
+        Enhanced->TryGetStringField(TEXT("mapping_context"), ContextName);
+        FString ActionPrefix = TEXT("IA_");
+        Enhanced->TryGetStringField(TEXT("action_prefix"), ActionPrefix);
+
+        const TArray<TSharedPtr<FJsonValue>>* ActionEntries = nullptr;
+        if (Enhanced->TryGetArrayField(TEXT("actions"), ActionEntries))
+        {
+            for (int32 Index = 0; Index < ActionEntries->Num(); ++Index)
+            {
+                const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+                FActionSpec Spec;
+                if (!(*ActionEntries)[Index]->TryGetObject(EntryObj) || !(*EntryObj)->TryGetStringField(TEXT("name"), Spec.Name) || Spec.Name.IsEmpty())
+                {
+                    Errors.Add(FString::Printf(TEXT("enhanced_input.actions[%d]: expected {name, value_type, keys}"), Index));
+                    continue;
+                }
+                const FString Context = FString::Printf(TEXT("enhanced_input.actions[%d]"), Index);
+                FString ValueTypeName;
+                (*EntryObj)->TryGetStringField(TEXT("value_type"), ValueTypeName);
+                if (!ParseValueType(ValueTypeName, Spec.ValueType))
+                {
+                    Errors.Add(FString::Printf(TEXT("%s: unknown value_type '%s' (Boolean, Axis1D, Axis2D, Axis3D)"), *Context, *ValueTypeName));
+                }
+                Spec.bExplicitValueType = !ValueTypeName.IsEmpty();
+
+                const TArray<TSharedPtr<FJsonValue>>* KeyEntries = nullptr;
+                if ((*EntryObj)->TryGetArrayField(TEXT("keys"), KeyEntries))
+                {
+                    for (const TSharedPtr<FJsonValue>& KeyEntry : *KeyEntries)
+                    {
+                        FKeySpec& KeySpec = Spec.Keys.AddDefaulted_GetRef();
+                        FString KeyName;
+                        const TSharedPtr<FJsonObject>* KeyObj = nullptr;
+                        if (KeyEntry->TryGetObject(KeyObj))
+                        {
+                            (*KeyObj)->TryGetStringField(TEXT("key"), KeyName);
+                            ParseInstanced(*KeyObj, TEXT("modifiers"), UInputModifier::StaticClass(), TEXT("InputModifier"), KeySpec.Modifiers, Errors, Context);
+                            ParseInstanced(*KeyObj, TEXT("triggers"), UInputTrigger::StaticClass(), TEXT("InputTrigger"), KeySpec.Triggers, Errors, Context);
+                        }
+                        else
+                        {
+                            KeyEntry->TryGetString(KeyName);
+                        }
+                        if (!ParseKey(KeyName, KeySpec.Key))
+                        {
+                            Errors.Add(FString::Printf(TEXT("%s: unknown key '%s'"), *Context, *KeyName));
+                        }
+                    }
+                }
+                ActionSpecs.Add(MoveTemp(Spec));
+            }
+        }
+        else
+        {
+            // Legacy actions become digital actions; axes become Axis1D with their scale as a modifier.
+            // Shift/ctrl/alt/cmd become chord triggers on a shared modifier-key action per flag.
+            struct FChordKey
+            {
+                const TCHAR* Name;
+                FKey Left;
+                FKey Right;
+            };
+            const FChordKey ChordKeys[] = {
+                { TEXT("Shift"), EKeys::LeftShift, EKeys::RightShift },
+                { TEXT("Ctrl"), EKeys::LeftControl, EKeys::RightControl },
+                { TEXT("Alt"), EKeys::LeftAlt, EKeys::RightAlt },
+                { TEXT("Cmd"), EKeys::LeftCommand, EKeys::RightCommand },
+            };
+            int32 ChordSpecs[UE_ARRAY_COUNT(ChordKeys)];
+            for (int32& ChordSpec : ChordSpecs)
+            {
+                ChordSpec = INDEX_NONE;
+            }
+
+            TMap<FName, int32> SpecByName;
+            for (const FInputActionKeyMapping& Mapping : ActionMappings)
+            {
+                int32& SpecIndex = SpecByName.FindOrAdd(Mapping.ActionName, INDEX_NONE);
+                if (SpecIndex == INDEX_NONE)
+                {
+                    SpecIndex = ActionSpecs.Num();
+                    ActionSpecs.AddDefaulted_GetRef().Name = ActionPrefix + Mapping.ActionName.ToString();
+                }
+                const int32 MappingSpec = SpecIndex;
+                const bool Flags[] = { Mapping.bShift, Mapping.bCtrl, Mapping.bAlt, Mapping.bCmd };
+                TArray<int32> Chords;
+                for (int32 ChordIndex = 0; ChordIndex < UE_ARRAY_COUNT(ChordKeys); ++ChordIndex)
+                {
+                    const FChordKey& Chord = ChordKeys[ChordIndex];
+                    if (!Flags[ChordIndex])
+                    {
+                        continue;
+                    }
+                    if (ChordSpecs[ChordIndex] == INDEX_NONE)
+                    {
+                        ChordSpecs[ChordIndex] = ActionSpecs.Num();
+                        FActionSpec& ChordSpec = ActionSpecs.AddDefaulted_GetRef();
+                        ChordSpec.Name = ActionPrefix + TEXT("Modifier") + Chord.Name;
+                        ChordSpec.Keys.AddDefaulted_GetRef().Key = Chord.Left;
+                        ChordSpec.Keys.AddDefaulted_GetRef().Key = Chord.Right;
+                    }
+                    Chords.Add(ChordSpecs[ChordIndex]);
+                }
+                FKeySpec& KeySpec = ActionSpecs[MappingSpec].Keys.AddDefaulted_GetRef();
+                KeySpec.Key = Mapping.Key;
+                KeySpec.Chords = MoveTemp(Chords);
+            }
+            SpecByName.Reset();
+            for (const FInputAxisKeyMapping& Mapping : AxisMappings)
+            {
+                int32& SpecIndex = SpecByName.FindOrAdd(Mapping.AxisName, INDEX_NONE);
+                if (SpecIndex == INDEX_NONE)
+                {
+                    SpecIndex = ActionSpecs.Num();
+                    FActionSpec& Spec = ActionSpecs.AddDefaulted_GetRef();
+                    Spec.Name = ActionPrefix + Mapping.AxisName.ToString();
+                    Spec.ValueType = EInputActionValueType::Axis1D;
+                }
+                FKeySpec& KeySpec = ActionSpecs[SpecIndex].Keys.AddDefaulted_GetRef();
+                KeySpec.Key = Mapping.Key;
+                if (Mapping.Scale == -1.0f)
+                {
+                    KeySpec.Modifiers.Add({ UInputModifierNegate::StaticClass(), nullptr });
+                }
+                else if (Mapping.Scale != 1.0f)
+                {
+                    FInstancedSpec& Scalar = KeySpec.Modifiers.AddDefaulted_GetRef();
+                    Scalar.Class = UInputModifierScalar::StaticClass();
+                    Scalar.Properties = MakeShared<FJsonObject>();
+                    TArray<TSharedPtr<FJsonValue>> ScaleValues;
+                    ScaleValues.Init(MakeShared<FJsonValueNumber>(Mapping.Scale), 3);
+                    Scalar.Properties->SetArrayField(TEXT("Scalar"), ScaleValues);
+                }
+            }
+        }
+
+        for (FActionSpec& Spec : ActionSpecs)
+        {
+            for (const FKeySpec& KeySpec : Spec.Keys)
+            {
+                ValidateProperties(KeySpec.Modifiers, Errors, Spec.Name);
+                ValidateProperties(KeySpec.Triggers, Errors, Spec.Name);
+            }
+            Spec.AssetPath = Folder + Spec.Name;
+            if (!FPackageName::IsValidLongPackageName(Spec.AssetPath))
+            {
+                Errors.Add(FString::Printf(TEXT("'%s' is not a valid asset path"), *Spec.AssetPath));
+                continue;
+            }
+            Spec.Existing = FindExistingAsset<UInputAction>(Spec.AssetPath, Err);
+            if (!Err.IsEmpty())
+            {
+                Errors.Add(Err);
+                Err.Reset();
+            }
+        }
+
+        ContextPath = Folder + ContextName;
+        if (!FPackageName::IsValidLongPackageName(ContextPath))
+        {
+            Errors.Add(FString::Printf(TEXT("'%s' is not a valid asset path"), *ContextPath));
+        }
+        else
+        {
+            ExistingContext = FindExistingAsset<UInputMappingContext>(ContextPath, Err);
+            if (!Err.IsEmpty())
+            {
+                Errors.Add(Err);
+            }
+        }
+    }
+
+    if (ActionMappings.Num() == 0 && AxisMappings.Num() == 0 && ActionSpecs.Num() == 0 && Errors.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(TEXT("Nothing to create"), TEXT("ERR_BAD_REQUEST"),
+            TEXT("Pass action_mappings, axis_mappings and/or enhanced_input.actions"));
+    }
+    if (Errors.Num() > 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+            FString::Printf(TEXT("%d invalid input mapping entries; nothing was changed"), Errors.Num()),
+            TEXT("ERR_BAD_REQUEST"),
+            FString::Join(Errors, TEXT("\n")));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+
+    // Legacy mappings: add without per-mapping keymap rebuilds, then rebuild and write config once
+    if (ActionMappings.Num() > 0 || AxisMappings.Num() > 0)
+    {
+        UInputSettings* InputSettings = GetMutableDefault<UInputSettings>();
+        if (!InputSettings)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get input settings"));
+        }
+
+        int32 Removed = 0;
+        if (bReplace)
+        {
+            TSet<FName> ActionNames;
+            TSet<FName> AxisNames;
+            for (const FInputActionKeyMapping& Mapping : ActionMappings)
+            {
+                ActionNames.Add(Mapping.ActionName);
+            }
+            for (const FInputAxisKeyMapping& Mapping : AxisMappings)
+            {
+                AxisNames.Add(Mapping.AxisName);
+            }
+            const TArray<FInputActionKeyMapping> OldActions = InputSettings->GetActionMappings();
+            for (const FInputActionKeyMapping& Mapping : OldActions)
+            {
+                if (ActionNames.Contains(Mapping.ActionName))
+                {
+                    InputSettings->RemoveActionMapping(Mapping, false);
+                    ++Removed;
+                }
+            }
+            const TArray<FInputAxisKeyMapping> OldAxes = InputSettings->GetAxisMappings();
+            for (const FInputAxisKeyMapping& Mapping : OldAxes)
+            {
+                if (AxisNames.Contains(Mapping.AxisName))
+                {
+                    InputSettings->RemoveAxisMapping(Mapping, false);
+                    ++Removed;
+                }
+            }
+        }
+
+        int32 ActionsAdded = 0;
+        int32 AxesAdded = 0;
+        for (const FInputActionKeyMapping& Mapping : ActionMappings)
+        {
+            if (!InputSettings->GetActionMappings().Contains(Mapping))
+            {
+                InputSettings->AddActionMapping(Mapping, false);
+                ++ActionsAdded;
+            }
+        }
+        for (const FInputAxisKeyMapping& Mapping : AxisMappings)
+        {
+            if (!InputSettings->GetAxisMappings().Contains(Mapping))
+            {
+                InputSettings->AddAxisMapping(Mapping, false);
+                ++AxesAdded;
+            }
+        }
+
+        const bool bChanged = Removed > 0 || ActionsAdded > 0 || AxesAdded > 0;
+        if (bChanged)
+        {
+            InputSettings->ForceRebuildKeymaps();
+            FUnrealMCPSaveQueue::Get().SaveConfigOrDefer(InputSettings);
+        }
+
+        ResultObj->SetNumberField(TEXT("action_mappings_added"), ActionsAdded);
+        ResultObj->SetNumberField(TEXT("action_mappings_skipped"), ActionMappings.Num() - ActionsAdded);
+        ResultObj->SetNumberField(TEXT("axis_mappings_added"), AxesAdded);
+        ResultObj->SetNumberField(TEXT("axis_mappings_skipped"), AxisMappings.Num() - AxesAdded);
+        ResultObj->SetNumberField(TEXT("mappings_removed"), Removed);
+        ResultObj->SetBoolField(TEXT("config_saved"), bChanged);
+    }
+
+    if (bEnhanced && ActionSpecs.Num() > 0)
+    {
+        FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("MCP Create Input Mappings")));
+        TArray<FString> ApplyErrors;
+        TArray<FString> Warnings;
+        TArray<UObject*> Touched;
+        TArray<TSharedPtr<FJsonValue>> ActionItems;
+
+        UInputMappingContext* MappingContext = ExistingContext;
+        const bool bCreatedContext = MappingContext == nullptr;
+        if (MappingContext)
+        {
+            MappingContext->Modify();
+        }
+        else
+        {
+            MappingContext = CreateAsset<UInputMappingContext>(ContextPath);
+        }
+        Touched.Add(MappingContext);
+
+        // All actions first, so chord triggers can point at modifier-key actions created later in the list
+        TArray<UInputAction*> Actions;
+        const UEnum* ValueTypeEnum = StaticEnum<EInputActionValueType>();
+        for (const FActionSpec& Spec : ActionSpecs)
+        {
+            UInputAction* Action = Spec.Existing;
+            if (Action)
+            {
+                Action->Modify();
+                // Existing bindings depend on the value type, so only an explicit value_type changes it
+                if (Action->ValueType != Spec.ValueType)
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: existing value type %s %s (requested %s)"), *Spec.Name,
+                        *ValueTypeEnum->GetNameStringByValue(static_cast<int64>(Action->ValueType)),
+                        Spec.bExplicitValueType ? TEXT("replaced") : TEXT("kept"),
+                        *ValueTypeEnum->GetNameStringByValue(static_cast<int64>(Spec.ValueType))));
+                    if (Spec.bExplicitValueType)
+                    {
+                        Action->ValueType = Spec.ValueType;
+                    }
+                }
+            }
+            else
+            {
+                Action = CreateAsset<UInputAction>(Spec.AssetPath);
+                Action->ValueType = Spec.ValueType;
+            }
+            Touched.Add(Action);
+            Actions.Add(Action);
+        }
+
+        int32 MappingsAdded = 0;
+        int32 MappingsSkipped = 0;
+        for (int32 SpecIndex = 0; SpecIndex < ActionSpecs.Num(); ++SpecIndex)
+        {
+            const FActionSpec& Spec = ActionSpecs[SpecIndex];
+            UInputAction* Action = Actions[SpecIndex];
+
+            if (bReplace)
+            {
+                MappingContext->UnmapAllKeysFromAction(Action);
+            }
+            for (const FKeySpec& KeySpec : Spec.Keys)
+            {
+                TArray<const UInputAction*> ChordActions;
+                for (const int32 ChordSpec : KeySpec.Chords)
+                {
+                    ChordActions.Add(Actions[ChordSpec]);
+                }
+                const bool bMapped = MappingContext->GetMappings().ContainsByPredicate([Action, &KeySpec, &ChordActions](const FEnhancedActionKeyMapping& Existing)
+                {
+                    if (Existing.Action != Action || Existing.Key != KeySpec.Key)
+                    {
+                        return false;
+                    }
+                    const TArray<const UInputAction*> ExistingChords = GetChordActions(Existing);
+                    if (ExistingChords.Num() != ChordActions.Num())
+                    {
+                        return false;
+                    }
+                    for (const UInputAction* Chord : ChordActions)
+                    {
+                        if (!ExistingChords.Contains(Chord))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                });
+                if (bMapped)
+                {
+                    ++MappingsSkipped;
+                    continue;
+                }
+
+                TArray<UObject*> Modifiers;
+                TArray<UObject*> Triggers;
+                Instantiate(KeySpec.Modifiers, MappingContext, Modifiers, ApplyErrors, Spec.Name);
+                Instantiate(KeySpec.Triggers, MappingContext, Triggers, ApplyErrors, Spec.Name);
+
+                FEnhancedActionKeyMapping& Mapping = MappingContext->MapKey(Action, KeySpec.Key);
+                for (UObject* Modifier : Modifiers)
+                {
+                    Mapping.Modifiers.Add(CastChecked<UInputModifier>(Modifier));
+                }
+                for (UObject* Trigger : Triggers)
+                {
+                    Mapping.Triggers.Add(CastChecked<UInputTrigger>(Trigger));
+                }
+                for (const UInputAction* ChordAction : ChordActions)
+                {
+                    UInputTriggerChordAction* Chord = NewObject<UInputTriggerChordAction>(MappingContext, NAME_None, RF_Transactional);
+                    Chord->ChordAction = ChordAction;
+                    Mapping.Triggers.Add(Chord);
+                }
+                ++MappingsAdded;
+            }
+
+            TSharedPtr<FJsonObject> ActionItem = MakeShared<FJsonObject>();
+            ActionItem->SetStringField(TEXT("name"), Spec.Name);
+            ActionItem->SetBoolField(TEXT("created"), Spec.Existing == nullptr);
+            ActionItem->SetNumberField(TEXT("keys"), Spec.Keys.Num());
+            FUnrealMCPCommonUtils::AddResolvedAssetFields(ActionItem, Spec.AssetPath);
+            ActionItems.Add(MakeShared<FJsonValueObject>(ActionItem));
+        }
+
+        // Every created or edited asset goes out in one save pass (one async-write flush)
+        TArray<FString> PackageNames;
+        for (UObject* Asset : Touched)
+        {
+            UPackage* Package = Asset->GetPackage();
+            Package->MarkPackageDirty();
+            FUnrealMCPSaveQueue::Get().Track(Package);
+            PackageNames.AddUnique(Package->GetName());
+        }
+
+        TSharedPtr<FJsonObject> EnhancedResult = MakeShared<FJsonObject>();
+        TSharedPtr<FJsonObject> ContextItem = MakeShared<FJsonObject>();
+        ContextItem->SetBoolField(TEXT("created"), bCreatedContext);
+        FUnrealMCPCommonUtils::AddResolvedAssetFields(ContextItem, ContextPath);
+        EnhancedResult->SetObjectField(TEXT("mapping_context"), ContextItem);
+        EnhancedResult->SetArrayField(TEXT("actions"), ActionItems);
+        EnhancedResult->SetNumberField(TEXT("mappings_added"), MappingsAdded);
+        EnhancedResult->SetNumberField(TEXT("mappings_skipped"), MappingsSkipped);
+        if (FUnrealMCPSaveQueue::Get().IsDeferring())
+        {
+            EnhancedResult->SetBoolField(TEXT("save_deferred"), true);
+        }
+        else
+        {
+            EnhancedResult->SetObjectField(TEXT("saves"), FUnrealMCPSaveQueue::Get().SaveDirty(PackageNames));
+        }
+        if (Warnings.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> WarningValues;
+            for (const FString& Warning : Warnings)
+            {
+                WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+            }
+            EnhancedResult->SetArrayField(TEXT("warnings"), WarningValues);
+        }
+        if (ApplyErrors.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> ErrorValues;
+            for (const FString& ApplyError : ApplyErrors)
+            {
+                ErrorValues.Add(MakeShared<FJsonValueString>(ApplyError));
+            }
+            EnhancedResult->SetArrayField(TEXT("errors"), ErrorValues);
+        }
+        ResultObj->SetObjectField(TEXT("enhanced_input"), EnhancedResult);
+    }
+
+    ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
@@ -0,0 +1,1173 @@
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "JsonObjectConverter.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace UnrealMcpPropertyPath
+{
+	enum class EKind : uint8
+	{
+		Bool,
+		Integer,
+		Float,
+		String,
+		Name,
+		Text,
+		Enum,
+		Vector,
+		Vector2D,
+		Rotator,
+		LinearColor,
+		Color,
+		Transform,
+		SoftObject,
+		Object,
+		Array,
+		Map,
+		Set,
+		Struct,
+		Other
+	};
+
+	/** Heap copy of an imported map key, kept with the compiled path so lookups never re-import it. */
+	struct FMapKey
+	{
+		const FProperty* KeyProperty = nullptr;
+		void* Data = nullptr;
+
+		explicit FMapKey(const FProperty* InKeyProperty)
+			: KeyProperty(InKeyProperty)
+		{
+			Data = FMemory::Malloc(KeyProperty->GetSize(), KeyProperty->GetMinAlignment());
+			KeyProperty->InitializeValue(Data);
+		}
+
+		~FMapKey()
+		{
+			KeyProperty->DestroyValue(Data);
+			FMemory::Free(Data);
+		}
+	};
+
+	enum class EIndexKind : uint8
+	{
+		None,
+		Array,
+		Map
+	};
+
+	struct FSegment
+	{
+		const FProperty* Property = nullptr;
+		/** Property the segment yields: Property itself, the array inner or the map value. */
+		const FProperty* ValueProperty = nullptr;
+		int32 StaticIndex = 0;
+		EIndexKind IndexKind = EIndexKind::None;
+		int32 ArrayIndex = 0;
+		TSharedPtr<FMapKey> MapKey;
+	};
+
+	static bool IsNativeStruct(const UStruct* Struct)
+	{
+		if (const UClass* Class = Cast<UClass>(Struct))
+		{
+			return Class->HasAnyClassFlags(CLASS_Native);
+		}
+		if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+		{
+			return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+		}
+		return false;
+	}
+
+	/** Split on '.' outside brackets and quotes. */
+	static bool Tokenize(const FString& Path, TArray<FString>& OutTokens)
+	{
+		FString Current;
+		int32 Depth = 0;
+		bool bInQuote = false;
+		for (const TCHAR Char : Path)
+		{
+			if (Char == TEXT('"'))
+			{
+				bInQuote = !bInQuote;
+			}
+			else if (!bInQuote && Char == TEXT('['))
+			{
+				++Depth;
+			}
+			else if (!bInQuote && Char == TEXT(']'))
+			{
+				--Depth;
+			}
+			else if (!bInQuote && Depth == 0 && Char == TEXT('.'))
+			{
+				OutTokens.Add(MoveTemp(Current));
+				Current.Reset();
+				continue;
+			}
+			Current.AppendChar(Char);
+		}
+		OutTokens.Add(MoveTemp(Current));
+		return !bInQuote && Depth == 0 && !OutTokens.ContainsByPredicate([](const FString& Token) { return Token.IsEmpty(); });
+	}
+}
+
+using namespace UnrealMcpPropertyPath;
+
+struct FUnrealMCPPropertyPath::FAccessor
+{
+	EKind Kind = EKind::Other;
+	const FProperty* Property = nullptr;
+	const FNumericProperty* Numeric = nullptr;
+	const UEnum* Enum = nullptr;
+	const UScriptStruct* Struct = nullptr;
+	TUniquePtr<FAccessor> Inner;
+	TUniquePtr<FAccessor> Key;
+
+	static TUniquePtr<FAccessor> Make(const FProperty* Property)
+	{
+		TUniquePtr<FAccessor> Accessor = MakeUnique<FAccessor>();
+		Accessor->Property = Property;
+
+		if (CastField<FBoolProperty>(Property))
+		{
+			Accessor->Kind = EKind::Bool;
+		}
+		else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		{
+			Accessor->Kind = EKind::Enum;
+			Accessor->Enum = EnumProp->GetEnum();
+			Accessor->Numeric = EnumProp->GetUnderlyingProperty();
+		}
+		else if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Property))
+		{
+			Accessor->Numeric = NumProp;
+			Accessor->Enum = NumProp->GetIntPropertyEnum();
+			Accessor->Kind = Accessor->Enum ? EKind::Enum : (NumProp->IsFloatingPoint() ? EKind::Float : EKind::Integer);
+		}
+		else if (CastField<FStrProperty>(Property))
+		{
+			Accessor->Kind = EKind::String;
+		}
+		else if (CastField<FNameProperty>(Property))
+		{
+			Accessor->Kind = EKind::Name;
+		}
+		else if (CastField<FTextProperty>(Property))
+		{
+			Accessor->Kind = EKind::Text;
+		}
+		else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			const UScriptStruct* Struct = StructProp->Struct;
+			Accessor->Struct = Struct;
+			if (Struct == TBaseStructure<FVector>::Get()) Accessor->Kind = EKind::Vector;
+			else if (Struct == TBaseStructure<FVector2D>::Get()) Accessor->Kind = EKind::Vector2D;
+			else if (Struct == TBaseStructure<FRotator>::Get()) Accessor->Kind = EKind::Rotator;
+			else if (Struct == TBaseStructure<FLinearColor>::Get()) Accessor->Kind = EKind::LinearColor;
+			else if (Struct == TBaseStructure<FColor>::Get()) Accessor->Kind = EKind::Color;
+			else if (Struct == TBaseStructure<FTransform>::Get()) Accessor->Kind = EKind::Transform;
+			else Accessor->Kind = EKind::Struct;
+		}
+		// Soft references derive from FObjectPropertyBase; test them first
+		else if (CastField<FSoftObjectProperty>(Property))
+		{
+			Accessor->Kind = EKind::SoftObject;
+		}
+		else if (CastField<FObjectPropertyBase>(Property))
+		{
+			Accessor->Kind = EKind::Object;
+		}
+		else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		{
+			Accessor->Kind = EKind::Array;
+			Accessor->Inner = Make(ArrayProp->Inner);
+		}
+		else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+		{
+			Accessor->Kind = EKind::Map;
+			Accessor->Key = Make(MapProp->KeyProp);
+			Accessor->Inner = Make(MapProp->ValueProp);
+		}
+		else if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+		{
+			Accessor->Kind = EKind::Set;
+			Accessor->Inner = Make(SetProp->ElementProp);
+		}
+		return Accessor;
+	}
+};
+
+struct FUnrealMCPPropertyPath::FCompiledPath
+{
+	TArray<FSegment> Segments;
+	/** Typed accessor for the leaf; null when the path continues through an object reference. */
+	TUniquePtr<FAccessor> Leaf;
+	FString Continuation;
+
+	/** Layout stamp for non-native owners, whose properties are regenerated on compile. */
+	bool bGenerated = false;
+	const FProperty* PropertyLink = nullptr;
+	int32 PropertiesSize = 0;
+};
+
+struct FUnrealMCPPropertyPath::FExportPlan
+{
+	struct FEntry
+	{
+		const FProperty* Property = nullptr;
+		const UClass* OwnerClass = nullptr;
+		int32 Offset = 0;
+		FString Name;
+		TUniquePtr<FAccessor> Accessor;
+	};
+
+	TArray<FEntry> Entries;
+	const FProperty* PropertyLink = nullptr;
+	int32 PropertiesSize = 0;
+};
+
+namespace UnrealMcpPropertyPath
+{
+	static bool ReadNumbers(const TSharedPtr<FJsonValue>& Value, int32 Count, double* Out)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+		if (!Value->TryGetArray(Array) || Array->Num() < Count)
+		{
+			return false;
+		}
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Out[i] = (*Array)[i]->AsNumber();
+		}
+		return true;
+	}
+
+	static TSharedPtr<FJsonValue> MakeNumbers(std::initializer_list<double> Numbers)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		Array.Reserve(Numbers.size());
+		for (double Number : Numbers)
+		{
+			Array.Add(MakeShared<FJsonValueNumber>(Number));
+		}
+		return MakeShared<FJsonValueArray>(Array);
+	}
+
+	static bool ImportFromString(const FProperty* Property, void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+	{
+		FString Text;
+		if (!Value->TryGetString(Text) || !Property->ImportText_Direct(*Text, ValuePtr, nullptr, PPF_None))
+		{
+			OutError = FString::Printf(TEXT("Unsupported value for %s property %s"), *Property->GetCPPType(), *Property->GetName());
+			return false;
+		}
+		return true;
+	}
+
+	static bool ResolveEnumValue(const UEnum* Enum, const TSharedPtr<FJsonValue>& Value, int64& OutValue, FString& OutError)
+	{
+		if (Value->Type == EJson::Number)
+		{
+			OutValue = static_cast<int64>(Value->AsNumber());
+			return true;
+		}
+
+		FString Name = Value->AsString();
+		if (Name.IsNumeric())
+		{
+			OutValue = FCString::Atoi64(*Name);
+			return true;
+		}
+
+		// Accept "Player0" and "EAutoReceiveInput::Player0"
+		FString ShortName = Name;
+		if (ShortName.Contains(TEXT("::")))
+		{
+			ShortName.Split(TEXT("::"), nullptr, &ShortName);
+		}
+		OutValue = Enum->GetValueByNameString(ShortName);
+		if (OutValue == INDEX_NONE)
+		{
+			OutValue = Enum->GetValueByNameString(Name);
+		}
+		if (OutValue != INDEX_NONE)
+		{
+			return true;
+		}
+
+		FString Options;
+		for (int32 i = 0; i < Enum->NumEnums() - 1; ++i)
+		{
+			Options += (i ? TEXT(", ") : TEXT("")) + Enum->GetNameStringByIndex(i);
+		}
+		OutError = FString::Printf(TEXT("Could not find enum value for '%s'. Available options: %s"), *Name, *Options);
+		return false;
+	}
+
+	/** Default-initialized temporary of one property's type; whole-container writes build here and copy on success. */
+	struct FScratchValue
+	{
+		explicit FScratchValue(const FProperty* InProperty)
+			: Property(InProperty)
+			, Memory(FMemory::Malloc(InProperty->GetSize(), InProperty->GetMinAlignment()))
+		{
+			Property->InitializeValue(Memory);
+		}
+
+		~FScratchValue()
+		{
+			Property->DestroyValue(Memory);
+			FMemory::Free(Memory);
+		}
+
+		FScratchValue(const FScratchValue&) = delete;
+		FScratchValue& operator=(const FScratchValue&) = delete;
+
+		const FProperty* Property;
+		void* Memory;
+	};
+
+	static bool WriteValue(const FUnrealMCPPropertyPath::FAccessor& Accessor, void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+	static TSharedPtr<FJsonValue> ReadValue(const FUnrealMCPPropertyPath::FAccessor& Accessor, const void* ValuePtr, bool& bOutSupported);
+
+	static bool WriteValue(const FUnrealMCPPropertyPath::FAccessor& Accessor, void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+	{
+		if (!Value.IsValid())
+		{
+			OutError = TEXT("Missing value");
+			return false;
+		}
+
+		const FProperty* Property = Accessor.Property;
+		double N[4];
+
+		switch (Accessor.Kind)
+		{
+		case EKind::Bool:
+		{
+			bool bValue = false;
+			if (!Value->TryGetBool(bValue))
+			{
+				bValue = Value->AsString().ToBool();
+			}
+			CastFieldChecked<FBoolProperty>(Property)->SetPropertyValue(ValuePtr, bValue);
+			return true;
+		}
+		case EKind::Integer:
+			Accessor.Numeric->SetIntPropertyValue(ValuePtr, Value->Type == EJson::String ? FCString::Atoi64(*Value->AsString()) : static_cast<int64>(Value->AsNumber()));
+			return true;
+		case EKind::Float:
+			Accessor.Numeric->SetFloatingPointPropertyValue(ValuePtr, Value->Type == EJson::String ? FCString::Atod(*Value->AsString()) : Value->AsNumber());
+			return true;
+		case EKind::String:
+			*static_cast<FString*>(ValuePtr) = Value->AsString();
+			return true;
+		case EKind::Name:
+			*static_cast<FName*>(ValuePtr) = FName(*Value->AsString());
+			return true;
+		case EKind::Text:
+			*static_cast<FText*>(ValuePtr) = FText::FromString(Value->AsString());
+			return true;
+		case EKind::Enum:
+		{
+			int64 EnumValue = 0;
+			if (!ResolveEnumValue(Accessor.Enum, Value, EnumValue, OutError))
+			{
+				return false;
+			}
+			Accessor.Numeric->SetIntPropertyValue(ValuePtr, EnumValue);
+			return true;
+		}
+		case EKind::Vector:
+			if (ReadNumbers(Value, 3, N))
+			{
+				*static_cast<FVector*>(ValuePtr) = FVector(N[0], N[1], N[2]);
+				return true;
+			}
+			break;
+		case EKind::Vector2D:
+			if (ReadNumbers(Value, 2, N))
+			{
+				*static_cast<FVector2D*>(ValuePtr) = FVector2D(N[0], N[1]);
+				return true;
+			}
+			break;
+		case EKind::Rotator:
+			if (ReadNumbers(Value, 3, N))
+			{
+				*static_cast<FRotator*>(ValuePtr) = FRotator(N[0], N[1], N[2]);
+				return true;
+			}
+			break;
+		case EKind::LinearColor:
+			if (ReadNumbers(Value, 3, N))
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+				*static_cast<FLinearColor*>(ValuePtr) = FLinearColor(
+					static_cast<float>(N[0]), static_cast<float>(N[1]), static_cast<float>(N[2]),
+					Array.Num() > 3 ? static_cast<float>(Array[3]->AsNumber()) : 1.0f);
+				return true;
+			}
+			break;
+		case EKind::Color:
+			if (ReadNumbers(Value, 3, N))
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+				*static_cast<FColor*>(ValuePtr) = FColor(
+					static_cast<uint8>(N[0]), static_cast<uint8>(N[1]), static_cast<uint8>(N[2]),
+					Array.Num() > 3 ? static_cast<uint8>(Array[3]->AsNumber()) : 255);
+				return true;
+			}
+			break;
+		case EKind::Transform:
+		{
+			const TSharedPtr<FJsonObject>* Obj = nullptr;
+			if (Value->TryGetObject(Obj) && ((*Obj)->HasField(TEXT("location")) || (*Obj)->HasField(TEXT("rotation")) || (*Obj)->HasField(TEXT("scale"))))
+			{
+				FTransform& Transform = *static_cast<FTransform*>(ValuePtr);
+				if ((*Obj)->HasField(TEXT("location")))
+				{
+					Transform.SetLocation(FUnrealMCPCommonUtils::GetVectorFromJson(*Obj, TEXT("location")));
+				}
+				if ((*Obj)->HasField(TEXT("rotation")))
+				{
+					Transform.SetRotation(FUnrealMCPCommonUtils::GetRotatorFromJson(*Obj, TEXT("rotation")).Quaternion());
+				}
+				if ((*Obj)->HasField(TEXT("scale")))
+				{
+					Transform.SetScale3D(FUnrealMCPCommonUtils::GetVectorFromJson(*Obj, TEXT("scale")));
+				}
+				return true;
+			}
+			break;
+		}
+		case EKind::SoftObject:
+			*static_cast<FSoftObjectPtr*>(ValuePtr) = FSoftObjectPath(Value->IsNull() ? FString() : Value->AsString());
+			return true;
+		case EKind::Object:
+		{
+			const FObjectPropertyBase* ObjProp = CastFieldChecked<FObjectPropertyBase>(Property);
+			if (Value->IsNull() || Value->AsString().IsEmpty())
+			{
+				ObjProp->SetObjectPropertyValue(ValuePtr, nullptr);
+				return true;
+			}
+
+			const FString ObjectPath = Value->AsString();
+			UObject* Object = nullptr;
+			if (const FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+			{
+				UClass* Class = FindFirstObject<UClass>(*ObjectPath, EFindFirstObjectOptions::NativeFirst);
+				Class = Class ? Class : LoadObject<UClass>(nullptr, *ObjectPath);
+				if (Class && !Class->IsChildOf(ClassProp->MetaClass))
+				{
+					OutError = FString::Printf(TEXT("Class '%s' is not a %s"), *ObjectPath, *ClassProp->MetaClass->GetName());
+					return false;
+				}
+				Object = Class;
+			}
+			else
+			{
+				Object = FUnrealMCPCommonUtils::LoadAssetByPathSmart(ObjectPath);
+				if (Object && !Object->IsA(ObjProp->PropertyClass))
+				{
+					OutError = FString::Printf(TEXT("Object '%s' is not a %s"), *ObjectPath, *ObjProp->PropertyClass->GetName());
+					return false;
+				}
+			}
+			if (!Object)
+			{
+				OutError = FString::Printf(TEXT("Object not found: %s"), *ObjectPath);
+				return false;
+			}
+			ObjProp->SetObjectPropertyValue(ValuePtr, Object);
+			return true;
+		}
+		case EKind::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+			if (!Value->TryGetArray(Items))
+			{
+				break;
+			}
+			// Built aside so a bad element leaves the property as it was
+			FScratchValue Scratch(Property);
+			FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Property), Scratch.Memory);
+			Helper.Resize(Items->Num());
+			for (int32 i = 0; i < Items->Num(); ++i)
+			{
+				if (!WriteValue(*Accessor.Inner, Helper.GetRawPtr(i), (*Items)[i], OutError))
+				{
+					OutError = FString::Printf(TEXT("[%d]: %s"), i, *OutError);
+					return false;
+				}
+			}
+			Property->CopyCompleteValue(ValuePtr, Scratch.Memory);
+			return true;
+		}
+		case EKind::Map:
+		{
+			const TSharedPtr<FJsonObject>* Obj = nullptr;
+			if (!Value->TryGetObject(Obj))
+			{
+				break;
+			}
+			FScratchValue Scratch(Property);
+			FScriptMapHelper Helper(CastFieldChecked<FMapProperty>(Property), Scratch.Memory);
+			Helper.EmptyValues((*Obj)->Values.Num());
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Obj)->Values)
+			{
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				if (!WriteValue(*Accessor.Key, Helper.GetKeyPtr(Index), MakeShared<FJsonValueString>(Pair.Key), OutError) ||
+					!WriteValue(*Accessor.Inner, Helper.GetValuePtr(Index), Pair.Value, OutError))
+				{
+					Helper.Rehash();
+					OutError = FString::Printf(TEXT("[\"%s\"]: %s"), *Pair.Key, *OutError);
+					return false;
+				}
+			}
+			Helper.Rehash();
+			Property->CopyCompleteValue(ValuePtr, Scratch.Memory);
+			return true;
+		}
+		case EKind::Set:
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+			if (!Value->TryGetArray(Items))
+			{
+				break;
+			}
+			FScratchValue Scratch(Property);
+			FScriptSetHelper Helper(CastFieldChecked<FSetProperty>(Property), Scratch.Memory);
+			Helper.EmptyElements(Items->Num());
+			for (int32 i = 0; i < Items->Num(); ++i)
+			{
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				if (!WriteValue(*Accessor.Inner, Helper.GetElementPtr(Index), (*Items)[i], OutError))
+				{
+					Helper.Rehash();
+					OutError = FString::Printf(TEXT("[%d]: %s"), i, *OutError);
+					return false;
+				}
+			}
+			Helper.Rehash();
+			Property->CopyCompleteValue(ValuePtr, Scratch.Memory);
+			return true;
+		}
+		case EKind::Struct:
+		case EKind::Other:
+			break;
+		}
+
+		// Structs given as {"Field": value} objects go through the JSON converter; anything else as export text
+		const TSharedPtr<FJsonObject>* Obj = nullptr;
+		if (Accessor.Struct && Value->TryGetObject(Obj))
+		{
+			if (FJsonObjectConverter::JsonObjectToUStruct(Obj->ToSharedRef(), Accessor.Struct, ValuePtr))
+			{
+				return true;
+			}
+			OutError = FString::Printf(TEXT("Failed to convert object to %s"), *Accessor.Struct->GetName());
+			return false;
+		}
+		return ImportFromString(Property, ValuePtr, Value, OutError);
+	}
+
+	static TSharedPtr<FJsonValue> ReadValue(const FUnrealMCPPropertyPath::FAccessor& Accessor, const void* ValuePtr, bool& bOutSupported)
+	{
+		const FProperty* Property = Accessor.Property;
+
+		switch (Accessor.Kind)
+		{
+		case EKind::Bool:
+			return MakeShared<FJsonValueBoolean>(CastFieldChecked<FBoolProperty>(Property)->GetPropertyValue(ValuePtr));
+		case EKind::Integer:
+			return MakeShared<FJsonValueNumber>(static_cast<double>(Accessor.Numeric->GetSignedIntPropertyValue(ValuePtr)));
+		case EKind::Float:
+			return MakeShared<FJsonValueNumber>(Accessor.Numeric->GetFloatingPointPropertyValue(ValuePtr));
+		case EKind::String:
+			return MakeShared<FJsonValueString>(*static_cast<const FString*>(ValuePtr));
+		case EKind::Name:
+			return MakeShared<FJsonValueString>(static_cast<const FName*>(ValuePtr)->ToString());
+		case EKind::Text:
+			return MakeShared<FJsonValueString>(static_cast<const FText*>(ValuePtr)->ToString());
+		case EKind::Enum:
+		{
+			const int64 EnumValue = Accessor.Numeric->GetSignedIntPropertyValue(ValuePtr);
+			TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+			Obj->SetStringField(TEXT("name"), Accessor.Enum->GetNameStringByValue(EnumValue));
+			Obj->SetNumberField(TEXT("value"), static_cast<double>(EnumValue));
+			Obj->SetStringField(TEXT("enum"), Accessor.Enum->GetName());
+			return MakeShared<FJsonValueObject>(Obj);
+		}
+		case EKind::Vector:
+		{
+			const FVector& V = *static_cast<const FVector*>(ValuePtr);
+			return MakeNumbers({ V.X, V.Y, V.Z });
+		}
+		case EKind::Vector2D:
+		{
+			const FVector2D& V = *static_cast<const FVector2D*>(ValuePtr);
+			return MakeNumbers({ V.X, V.Y });
+		}
+		case EKind::Rotator:
+		{
+			const FRotator& R = *static_cast<const FRotator*>(ValuePtr);
+			return MakeNumbers({ R.Pitch, R.Yaw, R.Roll });
+		}
+		case EKind::LinearColor:
+		{
+			const FLinearColor& C = *static_cast<const FLinearColor*>(ValuePtr);
+			return MakeNumbers({ C.R, C.G, C.B, C.A });
+		}
+		case EKind::Transform:
+		{
+			const FTransform& T = *static_cast<const FTransform*>(ValuePtr);
+			const FVector L = T.GetLocation();
+			const FRotator R = T.GetRotation().Rotator();
+			const FVector S = T.GetScale3D();
+			TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+			Obj->SetField(TEXT("location"), MakeNumbers({ L.X, L.Y, L.Z }));
+			Obj->SetField(TEXT("rotation"), MakeNumbers({ R.Pitch, R.Yaw, R.Roll }));
+			Obj->SetField(TEXT("scale"), MakeNumbers({ S.X, S.Y, S.Z }));
+			return MakeShared<FJsonValueObject>(Obj);
+		}
+		case EKind::SoftObject:
+			return MakeShared<FJsonValueString>(static_cast<const FSoftObjectPtr*>(ValuePtr)->ToSoftObjectPath().ToString());
+		case EKind::Object:
+		{
+			const UObject* Object = CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(ValuePtr);
+			if (!Object)
+			{
+				return MakeShared<FJsonValueNull>();
+			}
+			return MakeShared<FJsonValueString>(Object->GetPathName());
+		}
+		case EKind::Array:
+		{
+			FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Property), ValuePtr);
+			TArray<TSharedPtr<FJsonValue>> Items;
+			Items.Reserve(Helper.Num());
+			for (int32 i = 0; i < Helper.Num(); ++i)
+			{
+				Items.Add(ReadValue(*Accessor.Inner, Helper.GetRawPtr(i), bOutSupported));
+			}
+			return MakeShared<FJsonValueArray>(Items);
+		}
+		// FColor, maps and sets are written from JSON but read as export text, the shape clients already parse
+		case EKind::Color:
+		case EKind::Map:
+		case EKind::Set:
+		case EKind::Struct:
+		case EKind::Other:
+			break;
+		}
+
+		// No direct JSON form; callers fall back to export text
+		bOutSupported = false;
+		return MakeShared<FJsonValueNull>();
+	}
+}
+
+FUnrealMCPPropertyPath& FUnrealMCPPropertyPath::Get()
+{
+	static FUnrealMCPPropertyPath Instance;
+	return Instance;
+}
+
+void FUnrealMCPPropertyPath::BindDelegates()
+{
+	if (bDelegatesBound)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Invalidate();
+	});
+	FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const TMap<UObject*, UObject*>&)
+	{
+		InvalidateGenerated();
+	});
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().AddLambda([this]()
+		{
+			InvalidateGenerated();
+		});
+	}
+	bDelegatesBound = true;
+}
+
+void FUnrealMCPPropertyPath::Invalidate()
+{
+	Cache.Reset();
+	ExportPlans[0].Reset();
+	ExportPlans[1].Reset();
+}
+
+void FUnrealMCPPropertyPath::InvalidateGenerated()
+{
+	auto RemoveGenerated = [](auto& Map)
+	{
+		for (auto It = Map.CreateIterator(); It; ++It)
+		{
+			const UStruct* Owner = It.Key().ResolveObjectPtr();
+			if (!Owner || !IsNativeStruct(Owner))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	};
+	RemoveGenerated(Cache);
+	RemoveGenerated(ExportPlans[0]);
+	RemoveGenerated(ExportPlans[1]);
+}
+
+TSharedPtr<FUnrealMCPPropertyPath::FCompiledPath> FUnrealMCPPropertyPath::FindOrCompile(const UStruct* Owner, const FString& Path, FString& OutError)
+{
+	BindDelegates();
+
+	TMap<FString, TSharedPtr<FCompiledPath>>& PerOwner = Cache.FindOrAdd(TObjectKey<UStruct>(Owner));
+	if (const TSharedPtr<FCompiledPath>* Found = PerOwner.Find(Path))
+	{
+		const FCompiledPath& Cached = **Found;
+		if (!Cached.bGenerated || (Cached.PropertyLink == Owner->PropertyLink && Cached.PropertiesSize == Owner->GetPropertiesSize()))
+		{
+			return *Found;
+		}
+	}
+
+	TArray<FString> Tokens;
+	if (!Tokenize(Path, Tokens))
+	{
+		OutError = FString::Printf(TEXT("Malformed property path: %s"), *Path);
+		return nullptr;
+	}
+
+	TSharedPtr<FCompiledPath> Compiled = MakeShared<FCompiledPath>();
+	Compiled->bGenerated = !IsNativeStruct(Owner);
+	Compiled->PropertyLink = Owner->PropertyLink;
+	Compiled->PropertiesSize = Owner->GetPropertiesSize();
+
+	const UStruct* Container = Owner;
+	for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); ++TokenIndex)
+	{
+		const FString& Token = Tokens[TokenIndex];
+
+		FString Name = Token;
+		FString IndexText;
+		bool bHasIndex = false;
+		int32 BracketPos = INDEX_NONE;
+		if (Token.FindChar(TEXT('['), BracketPos))
+		{
+			if (!Token.EndsWith(TEXT("]")))
+			{
+				OutError = FString::Printf(TEXT("Malformed index in '%s'"), *Token);
+				return nullptr;
+			}
+			Name = Token.Left(BracketPos);
+			IndexText = Token.Mid(BracketPos + 1, Token.Len() - BracketPos - 2).TrimStartAndEnd();
+			bHasIndex = true;
+		}
+
+		FSegment& Segment = Compiled->Segments.AddDefaulted_GetRef();
+		Segment.Property = FindFProperty<FProperty>(Container, *Name);
+		if (!Segment.Property)
+		{
+			OutError = FString::Printf(TEXT("Property not found: %s"), *FString::Join(TArrayView<const FString>(Tokens.GetData(), TokenIndex + 1), TEXT(".")));
+			return nullptr;
+		}
+		Segment.ValueProperty = Segment.Property;
+
+		if (bHasIndex)
+		{
+			const bool bQuoted = IndexText.Len() >= 2 && IndexText.StartsWith(TEXT("\"")) && IndexText.EndsWith(TEXT("\""));
+			const FString KeyText = bQuoted ? IndexText.Mid(1, IndexText.Len() - 2) : IndexText;
+
+			if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Segment.Property))
+			{
+				if (bQuoted || !KeyText.IsNumeric())
+				{
+					OutError = FString::Printf(TEXT("Array index must be a number: %s"), *Token);
+					return nullptr;
+				}
+				Segment.IndexKind = EIndexKind::Array;
+				Segment.ArrayIndex = FCString::Atoi(*KeyText);
+				Segment.ValueProperty = ArrayProp->Inner;
+			}
+			else if (const FMapProperty* MapProp = CastField<FMapProperty>(Segment.Property))
+			{
+				Segment.IndexKind = EIndexKind::Map;
+				Segment.MapKey = MakeShared<FMapKey>(MapProp->KeyProp);
+				const TUniquePtr<FAccessor> KeyAccessor = FAccessor::Make(MapProp->KeyProp);
+				if (!WriteValue(*KeyAccessor, Segment.MapKey->Data, MakeShared<FJsonValueString>(KeyText), OutError))
+				{
+					OutError = FString::Printf(TEXT("Invalid map key in '%s': %s"), *Token, *OutError);
+					return nullptr;
+				}
+				Segment.ValueProperty = MapProp->ValueProp;
+			}
+			else if (Segment.Property->GetArrayDim() > 1 && KeyText.IsNumeric())
+			{
+				Segment.StaticIndex = FCString::Atoi(*KeyText);
+				if (Segment.StaticIndex < 0 || Segment.StaticIndex >= Segment.Property->GetArrayDim())
+				{
+					OutError = FString::Printf(TEXT("Index out of range: %s"), *Token);
+					return nullptr;
+				}
+			}
+			else
+			{
+				OutError = FString::Printf(TEXT("Property '%s' cannot be indexed"), *Name);
+				return nullptr;
+			}
+		}
+
+		if (TokenIndex == Tokens.Num() - 1)
+		{
+			Compiled->Leaf = FAccessor::Make(Segment.ValueProperty);
+			break;
+		}
+
+		if (const FStructProperty* StructProp = CastField<FStructProperty>(Segment.ValueProperty))
+		{
+			Container = StructProp->Struct;
+		}
+		else if (CastField<FObjectPropertyBase>(Segment.ValueProperty) && !CastField<FSoftObjectProperty>(Segment.ValueProperty))
+		{
+			// The referenced object's class is only known at runtime; the rest compiles against it
+			Compiled->Continuation = FString::Join(TArrayView<const FString>(Tokens.GetData() + TokenIndex + 1, Tokens.Num() - TokenIndex - 1), TEXT("."));
+			break;
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("Cannot traverse into '%s' (%s)"), *Name, *Segment.ValueProperty->GetCPPType());
+			return nullptr;
+		}
+	}
+
+	PerOwner.Add(Path, Compiled);
+	return Compiled;
+}
+
+bool FUnrealMCPPropertyPath::Resolve(UObject* Object, const FString& Path, bool bForWrite, FResolved& Out, FString& OutError)
+{
+	check(IsInGameThread());
+
+	Out = FResolved();
+	if (!Object)
+	{
+		OutError = TEXT("Invalid object");
+		return false;
+	}
+
+	// Only the outermost insert is kept: removing it also discards anything inserted inside the new element
+	auto NoteInsert = [&Out](const FProperty* ContainerProperty, void* ContainerPtr, int32 Index)
+	{
+		if (!Out.InsertedContainer)
+		{
+			Out.InsertedInto = ContainerProperty;
+			Out.InsertedContainer = ContainerPtr;
+			Out.InsertedIndex = Index;
+		}
+	};
+	auto Fail = [&Out]()
+	{
+		UndoInsert(Out);
+		return false;
+	};
+
+	UObject* CurrentObject = Object;
+	FString CurrentPath = Path;
+
+	// Bounded so a reference cycle in a malformed path cannot spin forever
+	for (int32 Hop = 0; Hop < 16; ++Hop)
+	{
+		// Paths that only touch native properties are shared through the nearest native class, so every
+		// Blueprint class derived from it (e.g. hundreds of template duplicates) reuses one compiled entry
+		const UClass* Class = CurrentObject->GetClass();
+		TSharedPtr<FCompiledPath> Compiled;
+		if (!Class->HasAnyClassFlags(CLASS_Native))
+		{
+			const UClass* NativeClass = Class;
+			while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+			{
+				NativeClass = NativeClass->GetSuperClass();
+			}
+			FString NativeError;
+			Compiled = NativeClass ? FindOrCompile(NativeClass, CurrentPath, NativeError) : nullptr;
+		}
+		if (!Compiled)
+		{
+			Compiled = FindOrCompile(Class, CurrentPath, OutError);
+		}
+		if (!Compiled)
+		{
+			return Fail();
+		}
+
+		void* Container = CurrentObject;
+		void* ValuePtr = nullptr;
+		for (const FSegment& Segment : Compiled->Segments)
+		{
+			ValuePtr = Segment.Property->ContainerPtrToValuePtr<void>(Container, Segment.StaticIndex);
+
+			if (Segment.IndexKind == EIndexKind::Array)
+			{
+				FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Segment.Property), ValuePtr);
+				if (bForWrite && Segment.ArrayIndex == Helper.Num())
+				{
+					NoteInsert(Segment.Property, ValuePtr, Helper.AddValue());
+				}
+				if (!Helper.IsValidIndex(Segment.ArrayIndex))
+				{
+					OutError = FString::Printf(TEXT("Index %d out of range for %s (size %d)"), Segment.ArrayIndex, *Segment.Property->GetName(), Helper.Num());
+					return Fail();
+				}
+				ValuePtr = Helper.GetRawPtr(Segment.ArrayIndex);
+			}
+			else if (Segment.IndexKind == EIndexKind::Map)
+			{
+				FScriptMapHelper Helper(CastFieldChecked<FMapProperty>(Segment.Property), ValuePtr);
+				int32 Index = Helper.FindMapIndexWithKey(Segment.MapKey->Data);
+				if (Index == INDEX_NONE)
+				{
+					if (!bForWrite)
+					{
+						OutError = FString::Printf(TEXT("Key not found in %s"), *Segment.Property->GetName());
+						return Fail();
+					}
+					Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					Segment.MapKey->KeyProperty->CopySingleValue(Helper.GetKeyPtr(Index), Segment.MapKey->Data);
+					Helper.Rehash();
+					NoteInsert(Segment.Property, ValuePtr, Index);
+				}
+				ValuePtr = Helper.GetValuePtr(Index);
+			}
+
+			Container = ValuePtr;
+		}
+
+		const FSegment& Last = Compiled->Segments.Last();
+		if (Compiled->Leaf)
+		{
+			Out.Property = Last.ValueProperty;
+			Out.ValuePtr = ValuePtr;
+			Out.Owner = CurrentObject;
+			Out.Accessor = Compiled->Leaf.Get();
+			return true;
+		}
+
+		UObject* Next = CastFieldChecked<FObjectPropertyBase>(Last.ValueProperty)->GetObjectPropertyValue(ValuePtr);
+		if (!Next)
+		{
+			OutError = FString::Printf(TEXT("'%s' is null on %s"), *Last.Property->GetName(), *CurrentObject->GetName());
+			return Fail();
+		}
+		if (bForWrite)
+		{
+			Next->Modify();
+		}
+		CurrentObject = Next;
+		CurrentPath = Compiled->Continuation;
+	}
+
+	OutError = FString::Printf(TEXT("Property path too deep: %s"), *Path);
+	return Fail();
+}
+
+void FUnrealMCPPropertyPath::UndoInsert(FResolved& Resolved)
+{
+	if (!Resolved.InsertedContainer)
+	{
+		return;
+	}
+
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Resolved.InsertedInto))
+	{
+		FScriptArrayHelper Helper(ArrayProp, Resolved.InsertedContainer);
+		Helper.RemoveValues(Resolved.InsertedIndex, 1);
+	}
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(Resolved.InsertedInto))
+	{
+		FScriptMapHelper Helper(MapProp, Resolved.InsertedContainer);
+		Helper.RemoveAt(Resolved.InsertedIndex);
+	}
+
+	Resolved.InsertedInto = nullptr;
+	Resolved.InsertedContainer = nullptr;
+	Resolved.InsertedIndex = INDEX_NONE;
+	Resolved.ValuePtr = nullptr;
+}
+
+bool FUnrealMCPPropertyPath::Write(const FResolved& Resolved, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+	if (!Resolved.Accessor || !Resolved.ValuePtr)
+	{
+		OutError = TEXT("Unresolved property");
+		return false;
+	}
+	return WriteValue(*Resolved.Accessor, Resolved.ValuePtr, Value, OutError);
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPPropertyPath::Read(const FResolved& Resolved, bool& bOutSupported)
+{
+	bOutSupported = true;
+	if (!Resolved.Accessor || !Resolved.ValuePtr)
+	{
+		bOutSupported = false;
+		return MakeShared<FJsonValueNull>();
+	}
+	return ReadValue(*Resolved.Accessor, Resolved.ValuePtr, bOutSupported);
+}
+
+bool FUnrealMCPPropertyPath::SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+	FResolved Resolved;
+	if (!Resolve(Object, Path, true, Resolved, OutError))
+	{
+		return false;
+	}
+	if (!Write(Resolved, Value, OutError))
+	{
+		// A rejected value must not leave a default element or map entry behind
+		UndoInsert(Resolved);
+		return false;
+	}
+	return true;
+}
+
+const FUnrealMCPPropertyPath::FExportPlan& FUnrealMCPPropertyPath::FindOrBuildExportPlan(const UClass* Class, bool bOnlyEditable)
+{
+	BindDelegates();
+
+	TSharedPtr<FExportPlan>& Plan = ExportPlans[bOnlyEditable ? 1 : 0].FindOrAdd(TObjectKey<UStruct>(Class));
+	if (Plan.IsValid() && Plan->PropertyLink == Class->PropertyLink && Plan->PropertiesSize == Class->GetPropertiesSize())
+	{
+		return *Plan;
+	}
+
+	Plan = MakeShared<FExportPlan>();
+	Plan->PropertyLink = Class->PropertyLink;
+	Plan->PropertiesSize = Class->GetPropertiesSize();
+
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated) ||
+			(bOnlyEditable && !Property->HasAnyPropertyFlags(CPF_Edit)))
+		{
+			continue;
+		}
+
+		FExportPlan::FEntry& Entry = Plan->Entries.AddDefaulted_GetRef();
+		Entry.Property = Property;
+		Entry.OwnerClass = Property->GetOwnerClass();
+		Entry.Offset = Property->GetOffset_ForInternal();
+		Entry.Name = Property->GetName();
+		Entry.Accessor = FAccessor::Make(Property);
+	}
+	return *Plan;
+}
+
+namespace UnrealMcpPropertyPath
+{
+	static bool IdenticalValues(const FProperty* Property, const void* A, const void* B)
+	{
+		for (int32 Index = 0; Index < Property->GetArrayDim(); ++Index)
+		{
+			const int32 ElementOffset = Index * Property->GetElementSize();
+			if (!Property->Identical(static_cast<const uint8*>(A) + ElementOffset, static_cast<const uint8*>(B) + ElementOffset, PPF_DeepCompareInstances))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void FUnrealMCPPropertyPath::ExportAll(UObject* Object, bool bOnlyEditable, const TSharedPtr<FJsonObject>& OutProps, UObject* Baseline)
+{
+	check(IsInGameThread());
+
+	if (!Object || !OutProps.IsValid())
+	{
+		return;
+	}
+
+	const FExportPlan& Plan = FindOrBuildExportPlan(Object->GetClass(), bOnlyEditable);
+	uint8* Base = reinterpret_cast<uint8*>(Object);
+	const uint8* BaselineBase = reinterpret_cast<const uint8*>(Baseline);
+	for (const FExportPlan::FEntry& Entry : Plan.Entries)
+	{
+		void* ValuePtr = Base + Entry.Offset;
+		// Properties the baseline's class does not have always count as changed
+		if (Baseline && Baseline->IsA(Entry.OwnerClass) && IdenticalValues(Entry.Property, ValuePtr, BaselineBase + Entry.Offset))
+		{
+			continue;
+		}
+
+		bool bSupported = true;
+		TSharedPtr<FJsonValue> Value = ReadValue(*Entry.Accessor, ValuePtr, bSupported);
+		if (!bSupported)
+		{
+			FString ExportText;
+			Entry.Property->ExportTextItem_Direct(ExportText, ValuePtr, nullptr, Object, PPF_None);
+			TSharedPtr<FJsonObject> Fallback = MakeShared<FJsonObject>();
+			Fallback->SetStringField(TEXT("format"), TEXT("export_text"));
+			Fallback->SetStringField(TEXT("export_text"), ExportText);
+			Fallback->SetStringField(TEXT("cpp_type"), Entry.Property->GetCPPType());
+			Value = MakeShared<FJsonValueObject>(Fallback);
+		}
+		OutProps->SetField(Entry.Name, Value);
+	}
+}
+
+bool FUnrealMCPPropertyPath::IsIdentical(UObject* Object, UObject* Baseline, const FString& Path)
+{
+	FResolved A;
+	FResolved B;
+	FString Error;
+	return Object && Baseline &&
+		Resolve(Object, Path, false, A, Error) &&
+		Resolve(Baseline, Path, false, B, Error) &&
+		A.Property == B.Property &&
+		A.Property->Identical(A.ValuePtr, B.ValuePtr, PPF_DeepCompareInstances);
+}
+
+uint32 FUnrealMCPPropertyPath::HashState(UObject* Object, bool bOnlyEditable)
+{
+	check(IsInGameThread());
+
+	uint32 Hash = 0;
+	if (!Object)
+	{
+		return Hash;
+	}
+
+	const FExportPlan& Plan = FindOrBuildExportPlan(Object->GetClass(), bOnlyEditable);
+	const uint8* Base = reinterpret_cast<const uint8*>(Object);
+	FString ExportText;
+	for (const FExportPlan::FEntry& Entry : Plan.Entries)
+	{
+		const void* ValuePtr = Base + Entry.Offset;
+		if (Entry.Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			Hash = FCrc::MemCrc32(ValuePtr, Entry.Property->GetSize(), Hash);
+		}
+		else
+		{
+			ExportText.Reset();
+			Entry.Property->ExportTextItem_Direct(ExportText, ValuePtr, nullptr, Object, PPF_None);
+			Hash = FCrc::StrCrc32(*ExportText, Hash);
+		}
+	}
+	return Hash;
+}
@@ -0,0 +1,234 @@
+#include "Commands/UnrealMCPSaveQueue.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+FUnrealMCPSaveQueue::FCaptureScope::FCaptureScope(bool bDeferSaves)
+	: bDefer(bDeferSaves)
+{
+	FUnrealMCPSaveQueue& Queue = FUnrealMCPSaveQueue::Get();
+	Queue.BindDelegates();
+	++Queue.CaptureDepth;
+	if (bDefer)
+	{
+		++Queue.DeferDepth;
+	}
+}
+
+FUnrealMCPSaveQueue::FCaptureScope::~FCaptureScope()
+{
+	FUnrealMCPSaveQueue& Queue = FUnrealMCPSaveQueue::Get();
+	--Queue.CaptureDepth;
+	if (bDefer)
+	{
+		--Queue.DeferDepth;
+	}
+}
+
+FUnrealMCPSaveQueue& FUnrealMCPSaveQueue::Get()
+{
+	static FUnrealMCPSaveQueue Instance;
+	return Instance;
+}
+
+void FUnrealMCPSaveQueue::BindDelegates()
+{
+	if (!bDelegatesBound)
+	{
+		UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FUnrealMCPSaveQueue::OnPackageMarkedDirty);
+		bDelegatesBound = true;
+	}
+}
+
+void FUnrealMCPSaveQueue::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	// Only packages dirtied while a command runs; edits made by the user are left to the editor
+	if (CaptureDepth > 0)
+	{
+		Track(Package);
+	}
+}
+
+void FUnrealMCPSaveQueue::Track(UPackage* Package)
+{
+	check(IsInGameThread());
+	if (!Package || Package->HasAnyFlags(RF_Transient) || Package == GetTransientPackage())
+	{
+		return;
+	}
+
+	bool bAlreadyTracked = false;
+	PackageNames.Add(Package->GetFName(), &bAlreadyTracked);
+	if (!bAlreadyTracked)
+	{
+		Packages.Add(Package);
+	}
+}
+
+bool FUnrealMCPSaveQueue::SaveOrDefer(UObject* Asset)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+	if (IsDeferring())
+	{
+		Track(Asset->GetPackage());
+		return true;
+	}
+	return UEditorAssetLibrary::SaveLoadedAsset(Asset, false);
+}
+
+void FUnrealMCPSaveQueue::SaveConfigOrDefer(UObject* ConfigObject)
+{
+	if (!ConfigObject)
+	{
+		return;
+	}
+	if (IsDeferring())
+	{
+		Configs.AddUnique(ConfigObject);
+		return;
+	}
+	ConfigObject->SaveConfig();
+}
+
+TArray<UPackage*> FUnrealMCPSaveQueue::GetDirtyPackages()
+{
+	TArray<UPackage*> Dirty;
+	for (int32 Index = Packages.Num() - 1; Index >= 0; --Index)
+	{
+		UPackage* Package = Packages[Index].Get();
+		if (!Package || !Package->IsDirty())
+		{
+			// Saved elsewhere (or unloaded) since it was tracked
+			if (Package)
+			{
+				PackageNames.Remove(Package->GetFName());
+			}
+			Packages.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+		Dirty.Add(Package);
+	}
+	return Dirty;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPSaveQueue::SaveDirty(const TArray<FString>& PackageFilter)
+{
+	check(IsInGameThread());
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<UPackage*> Dirty = GetDirtyPackages();
+	Dirty.Sort([](const UPackage& A, const UPackage& B)
+	{
+		return A.GetName() < B.GetName();
+	});
+
+	TArray<TSharedPtr<FJsonValue>> Items;
+	int32 SavedCount = 0;
+	int32 FailedCount = 0;
+	int32 SkippedCount = 0;
+	TArray<UPackage*> Saved;
+
+	for (UPackage* Package : Dirty)
+	{
+		const FString PackageName = Package->GetName();
+		if (PackageFilter.Num() > 0 && !PackageFilter.Contains(PackageName))
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+		Item->SetStringField(TEXT("package"), PackageName);
+
+		FString Error;
+		FString Filename;
+		if (Package->ContainsMap())
+		{
+			// Levels go through the editor's world save (sublevels, external actors); not done behind its back
+			Error = TEXT("Map packages are not saved by save_dirty; save the level from the editor");
+		}
+		else if (!FUnrealMCPCommonUtils::IsWritePathAllowed(PackageName, Error))
+		{
+			Error = FString::Printf(TEXT("Write path not allowed: %s"), *Error);
+		}
+		else if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName, Filename, FPackageName::GetAssetPackageExtension()))
+		{
+			Error = TEXT("Not a mounted content package");
+		}
+
+		if (!Error.IsEmpty())
+		{
+			Item->SetBoolField(TEXT("saved"), false);
+			Item->SetBoolField(TEXT("skipped"), true);
+			Item->SetStringField(TEXT("reason"), Error);
+			Items.Add(MakeShared<FJsonValueObject>(Item));
+			++SkippedCount;
+			continue;
+		}
+
+		// Serialize now, write the file in the background; all writes are flushed once below
+		const double PackageStart = FPlatformTime::Seconds();
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+		SaveArgs.Error = GWarn;
+		const FSavePackageResultStruct Result = GEditor->Save(Package, Package->FindAssetInPackage(), *Filename, SaveArgs);
+		const bool bSaved = Result.IsSuccessful();
+
+		Item->SetBoolField(TEXT("saved"), bSaved);
+		Item->SetNumberField(TEXT("ms"), (FPlatformTime::Seconds() - PackageStart) * 1000.0);
+		if (bSaved)
+		{
+			Saved.Add(Package);
+			++SavedCount;
+		}
+		else
+		{
+			Item->SetStringField(TEXT("error"), TEXT("SavePackage failed (file read-only or checked in?)"));
+			++FailedCount;
+		}
+		Items.Add(MakeShared<FJsonValueObject>(Item));
+	}
+
+	const double FlushStart = FPlatformTime::Seconds();
+	UPackage::WaitForAsyncFileWrites();
+	const double FlushMs = (FPlatformTime::Seconds() - FlushStart) * 1000.0;
+
+	for (UPackage* Package : Saved)
+	{
+		PackageNames.Remove(Package->GetFName());
+	}
+	Packages.RemoveAll([&Saved](const TWeakObjectPtr<UPackage>& Entry)
+	{
+		return !Entry.IsValid() || Saved.Contains(Entry.Get());
+	});
+
+	TArray<TSharedPtr<FJsonValue>> ConfigItems;
+	for (const TWeakObjectPtr<UObject>& Config : Configs)
+	{
+		if (UObject* ConfigObject = Config.Get())
+		{
+			ConfigObject->SaveConfig();
+			ConfigItems.Add(MakeShared<FJsonValueString>(ConfigObject->GetClass()->GetName()));
+		}
+	}
+	Configs.Reset();
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetArrayField(TEXT("packages"), Items);
+	ResultObj->SetNumberField(TEXT("saved"), SavedCount);
+	ResultObj->SetNumberField(TEXT("failed"), FailedCount);
+	ResultObj->SetNumberField(TEXT("skipped"), SkippedCount);
+	ResultObj->SetArrayField(TEXT("configs"), ConfigItems);
+	ResultObj->SetNumberField(TEXT("flush_ms"), FlushMs);
+	ResultObj->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCP: saved %d packages (%d failed, %d skipped) in %.1f ms"),
+		SavedCount, FailedCount, SkippedCount, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return ResultObj;
+}
@@ -1,5 +1,11 @@
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPSaveQueue.h"
+#include "Commands/UnrealMCPClassIndex.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPPropertyPath.h"
+#include "Commands/UnrealMCPWidgetIndex.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -25,7 +31,404 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "K2Node_Event.h"
-#include "ScopedTransaction.h"
+#include "K2Node_ComponentBoundEvent.h"
+
+namespace UnrealMcpWidgetTree
+{
+	struct FPendingEvent
+	{
+		FName WidgetName;
+		FName EventName;
+	};
+
+	struct FBuildContext
+	{
+		UWidgetBlueprint* Blueprint = nullptr;
+		TArray<FPendingEvent> Events;
+		TArray<TSharedPtr<FJsonValue>> Widgets;
+		TArray<TSharedPtr<FJsonValue>> Errors;
+		int32 BindingCount = 0;
+	};
+
+	static void AddError(FBuildContext& Ctx, const FString& Widget, const FString& Message)
+	{
+		TSharedPtr<FJsonObject> Err = MakeShared<FJsonObject>();
+		Err->SetStringField(TEXT("widget"), Widget);
+		Err->SetStringField(TEXT("error"), Message);
+		Ctx.Errors.Add(MakeShared<FJsonValueObject>(Err));
+	}
+
+	static bool TryGetVector2D(const TSharedPtr<FJsonObject>& Obj, const FString& Field, FVector2D& Out)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Arr = nullptr;
+		if (Obj->TryGetArrayField(Field, Arr) && Arr->Num() >= 2)
+		{
+			Out = FVector2D((*Arr)[0]->AsNumber(), (*Arr)[1]->AsNumber());
+			return true;
+		}
+		return false;
+	}
+
+	/** Apply {path: value} pairs to Object; failures are reported per path and do not stop the build. */
+	static void ApplyProperties(FBuildContext& Ctx, UObject* Object, const FString& WidgetName, const TSharedPtr<FJsonObject>* Properties)
+	{
+		if (!Properties || !Properties->IsValid())
+		{
+			return;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+		{
+			FString Err;
+			if (!FUnrealMCPPropertyPath::Get().SetValue(Object, Pair.Key, Pair.Value, Err))
+			{
+				AddError(Ctx, WidgetName, FString::Printf(TEXT("%s.%s: %s"), *Object->GetClass()->GetName(), *Pair.Key, *Err));
+			}
+		}
+	}
+
+	/** Property binding ("Text" -> "GetScoreText"): recorded on the Widget Blueprint the way the designer does. */
+	static void AddPropertyBinding(FBuildContext& Ctx, UWidget* Widget, const FString& PropertyName, const FString& FunctionName)
+	{
+		const FString DelegateName = PropertyName.EndsWith(TEXT("Delegate")) ? PropertyName : PropertyName + TEXT("Delegate");
+		const FDelegateProperty* DelegateProperty = FindFProperty<FDelegateProperty>(Widget->GetClass(), *DelegateName);
+		if (!DelegateProperty)
+		{
+			AddError(Ctx, Widget->GetName(), FString::Printf(TEXT("Property '%s' is not bindable on %s"), *PropertyName, *Widget->GetClass()->GetName()));
+			return;
+		}
+
+		FDelegateEditorBinding Binding;
+		Binding.ObjectName = Widget->GetName();
+		Binding.PropertyName = DelegateProperty->GetFName();
+		Binding.FunctionName = FName(*FunctionName);
+		Binding.Kind = EBindingKind::Function;
+		for (UEdGraph* Graph : Ctx.Blueprint->FunctionGraphs)
+		{
+			if (Graph && Graph->GetFName() == Binding.FunctionName)
+			{
+				Binding.MemberGuid = Graph->GraphGuid;
+				break;
+			}
+		}
+
+		// One binding per (widget, property); a rebuild replaces it
+		Ctx.Blueprint->Bindings.Remove(Binding);
+		Ctx.Blueprint->Bindings.Add(Binding);
+		++Ctx.BindingCount;
+	}
+
+	/** Widget class for a node's 'type', or nullptr with OutError set. */
+	static UClass* ResolveWidgetClass(UWidgetBlueprint* Blueprint, const TSharedPtr<FJsonObject>& Node, FString& OutError)
+	{
+		FString Type;
+		if (!Node->TryGetStringField(TEXT("type"), Type) || Type.IsEmpty())
+		{
+			OutError = TEXT("Missing 'type'");
+			return nullptr;
+		}
+
+		TArray<FString> ClassCandidates;
+		UClass* WidgetClass = FUnrealMCPClassIndex::Get().FindClass(Type, UWidget::StaticClass(), &ClassCandidates);
+		if (!WidgetClass)
+		{
+			OutError = ClassCandidates.Num() > 1
+				? FString::Printf(TEXT("Widget type '%s' is ambiguous: %s"), *Type, *FString::Join(ClassCandidates, TEXT(", ")))
+				: FString::Printf(TEXT("Unknown widget type '%s'"), *Type);
+			return nullptr;
+		}
+		if (WidgetClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+		{
+			OutError = FString::Printf(TEXT("Widget type '%s' is abstract or deprecated"), *WidgetClass->GetName());
+			return nullptr;
+		}
+		if (Blueprint->GeneratedClass && WidgetClass->IsChildOf(Blueprint->GeneratedClass))
+		{
+			OutError = TEXT("A Widget Blueprint cannot contain itself");
+			return nullptr;
+		}
+		return WidgetClass;
+	}
+
+	/** False with OutError when Name can't be used for a new widget. Objects in Replaced are about to be moved out. */
+	static bool CheckWidgetName(UWidgetTree* WidgetTree, const FString& Name, const TArray<UWidget*>& Replaced, FString& OutError)
+	{
+		if (Name.IsEmpty())
+		{
+			return true;
+		}
+		FText Reason;
+		if (!FName::IsValidXName(Name, INVALID_OBJECTNAME_CHARACTERS, &Reason))
+		{
+			OutError = FString::Printf(TEXT("Invalid widget name: %s"), *Reason.ToString());
+			return false;
+		}
+		// Any object under the tree holds the name, including detached widgets; ConstructWidget would collide
+		UObject* Existing = FindObjectFast<UObject>(WidgetTree, FName(*Name));
+		if (Existing && !Replaced.Contains(Cast<UWidget>(Existing)))
+		{
+			OutError = TEXT("A widget with this name already exists");
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Construct one node and its subtree under Parent (nullptr for the root). Errors on a node skip that
+	 * node's subtree and are reported; siblings are still built.
+	 */
+	static UWidget* BuildNode(FBuildContext& Ctx, const TSharedPtr<FJsonObject>& Node, UPanelWidget* Parent)
+	{
+		UWidgetTree* WidgetTree = Ctx.Blueprint->WidgetTree;
+
+		FString Name;
+		Node->TryGetStringField(TEXT("name"), Name);
+
+		FString Err;
+		UClass* WidgetClass = ResolveWidgetClass(Ctx.Blueprint, Node, Err);
+		if (!WidgetClass || !CheckWidgetName(WidgetTree, Name, TArray<UWidget*>(), Err))
+		{
+			AddError(Ctx, Name, Err);
+			return nullptr;
+		}
+
+		UWidget* Widget = WidgetTree->ConstructWidget<UWidget>(WidgetClass, Name.IsEmpty() ? NAME_None : FName(*Name));
+		if (!Widget)
+		{
+			AddError(Ctx, Name, FString::Printf(TEXT("Failed to construct %s"), *WidgetClass->GetName()));
+			return nullptr;
+		}
+		Widget->SetFlags(RF_Transactional);
+		const FString WidgetName = Widget->GetName();
+
+		bool bIsVariable = false;
+		if (Node->TryGetBoolField(TEXT("is_variable"), bIsVariable))
+		{
+			Widget->bIsVariable = bIsVariable;
+		}
+
+		const TSharedPtr<FJsonObject>* Properties = nullptr;
+		Node->TryGetObjectField(TEXT("properties"), Properties);
+		ApplyProperties(Ctx, Widget, WidgetName, Properties);
+
+		if (Parent)
+		{
+			UPanelSlot* Slot = Parent->AddChild(Widget);
+			if (!Slot)
+			{
+				AddError(Ctx, WidgetName, FString::Printf(TEXT("'%s' cannot take another child"), *Parent->GetName()));
+				Widget->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors);
+				return nullptr;
+			}
+			Slot->SetFlags(RF_Transactional);
+
+			if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(Slot))
+			{
+				FVector2D Vec;
+				if (TryGetVector2D(Node, TEXT("position"), Vec))
+				{
+					CanvasSlot->SetPosition(Vec);
+				}
+				if (TryGetVector2D(Node, TEXT("size"), Vec))
+				{
+					CanvasSlot->SetSize(Vec);
+				}
+			}
+
+			const TSharedPtr<FJsonObject>* SlotProperties = nullptr;
+			Node->TryGetObjectField(TEXT("slot"), SlotProperties);
+			ApplyProperties(Ctx, Slot, WidgetName, SlotProperties);
+		}
+
+		// Bound events need the widget as a member variable of the generated class
+		const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+		if (Node->TryGetArrayField(TEXT("events"), Events))
+		{
+			for (const TSharedPtr<FJsonValue>& EventValue : *Events)
+			{
+				const FName EventName(*EventValue->AsString());
+				if (!FindFProperty<FMulticastDelegateProperty>(WidgetClass, EventName))
+				{
+					AddError(Ctx, WidgetName, FString::Printf(TEXT("%s has no event '%s'"), *WidgetClass->GetName(), *EventName.ToString()));
+					continue;
+				}
+				Widget->bIsVariable = true;
+				Ctx.Events.Add({ Widget->GetFName(), EventName });
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* Bindings = nullptr;
+		if (Node->TryGetObjectField(TEXT("bindings"), Bindings))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Bindings)->Values)
+			{
+				AddPropertyBinding(Ctx, Widget, Pair.Key, Pair.Value->AsString());
+			}
+		}
+
+		TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+		Item->SetStringField(TEXT("name"), WidgetName);
+		Item->SetStringField(TEXT("type"), WidgetClass->GetName());
+		Item->SetStringField(TEXT("parent"), Parent ? Parent->GetName() : FString());
+		Ctx.Widgets.Add(MakeShared<FJsonValueObject>(Item));
+
+		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+		if (Node->TryGetArrayField(TEXT("children"), Children) && Children->Num() > 0)
+		{
+			UPanelWidget* Panel = Cast<UPanelWidget>(Widget);
+			if (!Panel)
+			{
+				AddError(Ctx, WidgetName, FString::Printf(TEXT("%s is not a panel; %d children skipped"), *WidgetClass->GetName(), Children->Num()));
+				return Widget;
+			}
+			for (const TSharedPtr<FJsonValue>& ChildValue : *Children)
+			{
+				const TSharedPtr<FJsonObject>* Child = nullptr;
+				if (ChildValue->TryGetObject(Child))
+				{
+					BuildNode(Ctx, *Child, Panel);
+				}
+			}
+		}
+		return Widget;
+	}
+
+	/**
+	 * Add a component-bound event node for a widget variable's delegate. Spawned directly rather than through
+	 * CreateNewBoundEventForClass, which also opens the graph editor on the new node.
+	 */
+	static UK2Node_ComponentBoundEvent* SpawnBoundEvent(UEdGraph* EventGraph, FObjectProperty* WidgetProperty, FMulticastDelegateProperty* DelegateProperty, int32 NodeY)
+	{
+		UK2Node_ComponentBoundEvent* EventNode = NewObject<UK2Node_ComponentBoundEvent>(EventGraph);
+		EventNode->InitializeComponentBoundEventParams(WidgetProperty, DelegateProperty);
+		EventNode->CreateNewGuid();
+		EventNode->NodePosX = 0;
+		EventNode->NodePosY = NodeY;
+		EventGraph->AddNode(EventNode, false, false);
+		EventNode->PostPlacedNewNode();
+		EventNode->AllocateDefaultPins();
+		return EventNode;
+	}
+
+	static int32 NextFreeNodeY(const UEdGraph* EventGraph)
+	{
+		int32 NodeY = 0;
+		for (const UEdGraphNode* Node : EventGraph->Nodes)
+		{
+			NodeY = FMath::Max(NodeY, Node->NodePosY + 200);
+		}
+		return NodeY;
+	}
+
+	/** Spawn bound event nodes for every requested (widget, event) after one skeleton refresh. */
+	static int32 AddBoundEvents(FBuildContext& Ctx)
+	{
+		if (Ctx.Events.Num() == 0)
+		{
+			return 0;
+		}
+
+		UWidgetBlueprint* Blueprint = Ctx.Blueprint;
+		// Widget variables become skeleton class properties; one refresh covers every new widget
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+
+		UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+		if (!EventGraph || !Blueprint->SkeletonGeneratedClass)
+		{
+			AddError(Ctx, FString(), TEXT("Widget Blueprint has no event graph; events not bound"));
+			return 0;
+		}
+		EventGraph->Modify();
+
+		int32 NodeY = NextFreeNodeY(EventGraph);
+		int32 Added = 0;
+		for (const FPendingEvent& Pending : Ctx.Events)
+		{
+			FObjectProperty* WidgetProperty = FindFProperty<FObjectProperty>(Blueprint->SkeletonGeneratedClass, Pending.WidgetName);
+			UClass* WidgetClass = WidgetProperty ? WidgetProperty->PropertyClass.Get() : nullptr;
+			FMulticastDelegateProperty* DelegateProperty = WidgetClass ? FindFProperty<FMulticastDelegateProperty>(WidgetClass, Pending.EventName) : nullptr;
+			if (!DelegateProperty)
+			{
+				AddError(Ctx, Pending.WidgetName.ToString(), FString::Printf(TEXT("Could not bind '%s'"), *Pending.EventName.ToString()));
+				continue;
+			}
+			if (FUnrealMCPWidgetIndex::Get().FindBoundEvent(Blueprint, Pending.WidgetName, Pending.EventName))
+			{
+				continue;
+			}
+
+			SpawnBoundEvent(EventGraph, WidgetProperty, DelegateProperty, NodeY);
+			NodeY += 200;
+			++Added;
+		}
+		return Added;
+	}
+
+	static TSharedPtr<FJsonObject> ExportWidget(UWidget* Widget, bool bIncludeProperties,
+		const TMultiMap<FName, FName>& EventsByWidget, const TMultiMap<FString, const FDelegateEditorBinding*>& BindingsByWidget)
+	{
+		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+		Obj->SetStringField(TEXT("name"), Widget->GetName());
+		Obj->SetStringField(TEXT("type"), Widget->GetClass()->GetName());
+		Obj->SetStringField(TEXT("class_path"), Widget->GetClass()->GetPathName());
+		Obj->SetBoolField(TEXT("is_variable"), Widget->bIsVariable);
+
+		if (bIncludeProperties)
+		{
+			// Only what differs from the class defaults, in the same form build_widget_tree accepts
+			TSharedPtr<FJsonObject> Props = MakeShared<FJsonObject>();
+			FUnrealMCPPropertyPath::Get().ExportAll(Widget, true, Props, Widget->GetArchetype());
+			Obj->SetObjectField(TEXT("properties"), Props);
+
+			if (UPanelSlot* Slot = Widget->Slot)
+			{
+				TSharedPtr<FJsonObject> SlotProps = MakeShared<FJsonObject>();
+				FUnrealMCPPropertyPath::Get().ExportAll(Slot, true, SlotProps, Slot->GetArchetype());
+				Obj->SetStringField(TEXT("slot_type"), Slot->GetClass()->GetName());
+				Obj->SetObjectField(TEXT("slot"), SlotProps);
+			}
+		}
+
+		TArray<FName> Events;
+		EventsByWidget.MultiFind(Widget->GetFName(), Events);
+		if (Events.Num() > 0)
+		{
+			TArray<TSharedPtr<FJsonValue>> EventValues;
+			for (const FName& EventName : Events)
+			{
+				EventValues.Add(MakeShared<FJsonValueString>(EventName.ToString()));
+			}
+			Obj->SetArrayField(TEXT("events"), EventValues);
+		}
+
+		TArray<const FDelegateEditorBinding*> Bindings;
+		BindingsByWidget.MultiFind(Widget->GetName(), Bindings);
+		if (Bindings.Num() > 0)
+		{
+			TSharedPtr<FJsonObject> BindingsObj = MakeShared<FJsonObject>();
+			for (const FDelegateEditorBinding* Binding : Bindings)
+			{
+				FString PropertyName = Binding->PropertyName.ToString();
+				PropertyName.RemoveFromEnd(TEXT("Delegate"));
+				BindingsObj->SetStringField(PropertyName, Binding->FunctionName.ToString());
+			}
+			Obj->SetObjectField(TEXT("bindings"), BindingsObj);
+		}
+
+		if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+		{
+			TArray<TSharedPtr<FJsonValue>> Children;
+			for (int32 i = 0; i < Panel->GetChildrenCount(); ++i)
+			{
+				if (UWidget* Child = Panel->GetChildAt(i))
+				{
+					Children.Add(MakeShared<FJsonValueObject>(ExportWidget(Child, bIncludeProperties, EventsByWidget, BindingsByWidget)));
+				}
+			}
+			Obj->SetArrayField(TEXT("children"), Children);
+		}
+		return Obj;
+	}
+}
 
 FUnrealMCPUMGCommands::FUnrealMCPUMGCommands()
 {
@@ -57,6 +460,14 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCommand(const FString& Comm
 	{
 		return HandleSetTextBlockBinding(Params);
 	}
+	else if (CommandName == TEXT("build_widget_tree"))
+	{
+		return HandleBuildWidgetTree(Params);
+	}
+	else if (CommandName == TEXT("get_widget_tree"))
+	{
+		return HandleGetWidgetTree(Params);
+	}
 
 	return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown UMG command: %s"), *CommandName));
 }
@@ -125,7 +536,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCreateUMGWidgetBlueprint(co
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Create UMG Widget Blueprint")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Create UMG Widget Blueprint")));
 	Package->SetFlags(RF_Transactional);
 	Package->Modify();
 
@@ -239,7 +650,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddTextBlockToWidget(const
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Add TextBlock to Widget")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Add TextBlock to Widget")));
 	WidgetBlueprint->Modify();
 	if (WidgetBlueprint->WidgetTree)
 	{
@@ -438,7 +849,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 	}
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Bind Widget Event")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Bind Widget Event")));
 	WidgetBlueprint->Modify();
 	if (WidgetBlueprint->WidgetTree)
 	{
@@ -454,20 +865,8 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
 	WidgetBlueprint->MarkPackageDirty();
 
-	// NOTE: BlueprintPath may be empty when the caller resolves by name only.
-	// Prefer saving via the resolved asset path.
-	{
-		FString SaveObjectPath;
-		FString SaveErr;
-		if (!ResolvedPath.IsEmpty() && FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(ResolvedPath, SaveObjectPath, SaveErr))
-		{
-			UEditorAssetLibrary::SaveAsset(SaveObjectPath, false);
-		}
-		else if (!BlueprintPath.IsEmpty())
-		{
-			UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
-		}
-	}
+	// Saved now, or with the rest of the request under "save": "deferred"
+	FUnrealMCPSaveQueue::Get().SaveOrDefer(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("widget_name"), WidgetName);
@@ -539,66 +938,47 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 	}
 
 	// Find the widget in the blueprint
-	UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(*WidgetName);
+	UWidget* Widget = FUnrealMCPWidgetIndex::Get().FindWidget(WidgetBlueprint, FName(*WidgetName));
 	if (!Widget)
 	{
 		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to find widget: %s"), *WidgetName));
 		return Response;
 	}
 
-	// Create the event node (e.g., OnClicked for buttons)
-	UK2Node_Event* EventNode = nullptr;
-	
-	// Find existing nodes first
-	TArray<UK2Node_Event*> AllEventNodes;
-	FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_Event>(WidgetBlueprint, AllEventNodes);
-	
-	for (UK2Node_Event* Node : AllEventNodes)
+	FMulticastDelegateProperty* DelegateProperty = FindFProperty<FMulticastDelegateProperty>(Widget->GetClass(), FName(*EventName));
+	if (!DelegateProperty)
 	{
-		if (Node->CustomFunctionName == FName(*EventName) && Node->EventReference.GetMemberParentClass() == Widget->GetClass())
-		{
-			EventNode = Node;
-			break;
-		}
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("%s has no event '%s'"), *Widget->GetClass()->GetName(), *EventName));
+		return Response;
+	}
+
+	// Transaction + Modify for stable Undo/Redo
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Bind Widget Event")));
+	WidgetBlueprint->Modify();
+	if (WidgetBlueprint->WidgetTree)
+	{
+		WidgetBlueprint->WidgetTree->Modify();
 	}
 
-	// If no existing node, create a new one
+	// Reuse the existing bound event (e.g. OnClicked for buttons) if there is one
+	UK2Node_ComponentBoundEvent* EventNode = FUnrealMCPWidgetIndex::Get().FindBoundEvent(WidgetBlueprint, Widget->GetFName(), DelegateProperty->GetFName());
 	if (!EventNode)
 	{
-		// Calculate position - place it below existing nodes
-		float MaxHeight = 0.0f;
-		for (UEdGraphNode* Node : EventGraph->Nodes)
+		// Bound events reference the widget's member variable on the skeleton class
+		FObjectProperty* WidgetProperty = WidgetBlueprint->SkeletonGeneratedClass
+			? FindFProperty<FObjectProperty>(WidgetBlueprint->SkeletonGeneratedClass, Widget->GetFName())
+			: nullptr;
+		if (!WidgetProperty)
 		{
-			MaxHeight = FMath::Max(MaxHeight, Node->NodePosY);
+			Widget->Modify();
+			Widget->bIsVariable = true;
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+			WidgetProperty = FindFProperty<FObjectProperty>(WidgetBlueprint->SkeletonGeneratedClass, Widget->GetFName());
 		}
-		
-		const FVector2D NodePos(200, MaxHeight + 200);
-
-		// Call CreateNewBoundEventForClass, which returns void, so we can't capture the return value directly
-		// We'll need to find the node after creating it
-		FKismetEditorUtilities::CreateNewBoundEventForClass(
-			Widget->GetClass(),
-			FName(*EventName),
-			WidgetBlueprint,
-			nullptr  // We don't need a specific property binding
-		);
-
-		// Now find the newly created node
-		TArray<UK2Node_Event*> UpdatedEventNodes;
-		FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_Event>(WidgetBlueprint, UpdatedEventNodes);
-		
-		for (UK2Node_Event* Node : UpdatedEventNodes)
+		if (WidgetProperty)
 		{
-			if (Node->CustomFunctionName == FName(*EventName) && Node->EventReference.GetMemberParentClass() == Widget->GetClass())
-			{
-				EventNode = Node;
-				
-				// Set position of the node
-				EventNode->NodePosX = NodePos.X;
-				EventNode->NodePosY = NodePos.Y;
-				
-				break;
-			}
+			EventGraph->Modify();
+			EventNode = UnrealMcpWidgetTree::SpawnBoundEvent(EventGraph, WidgetProperty, DelegateProperty, UnrealMcpWidgetTree::NextFreeNodeY(EventGraph));
 		}
 	}
 
@@ -608,14 +988,6 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 		return Response;
 	}
 
-	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Bind Widget Event")));
-	WidgetBlueprint->Modify();
-	if (WidgetBlueprint->WidgetTree)
-	{
-		WidgetBlueprint->WidgetTree->Modify();
-	}
-
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
@@ -625,21 +997,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
 	WidgetBlueprint->MarkPackageDirty();
 
-	{
-		FString SaveObjectPath;
-		FString SaveErr;
-		if (!ResolvedPath.IsEmpty() && FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(ResolvedPath, SaveObjectPath, SaveErr))
-		{
-			UEditorAssetLibrary::SaveAsset(SaveObjectPath, false);
-		}
-		else if (!BlueprintPath.IsEmpty())
-		{
-			UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
-		}
-	}
+	FUnrealMCPSaveQueue::Get().SaveOrDefer(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("event_name"), EventName);
+	Response->SetStringField(TEXT("node_id"), EventNode->NodeGuid.ToString());
 	Response->SetStringField(TEXT("resolved_asset_path"), ResolvedPath);
 	{
 		FString ObjectPath;
@@ -700,7 +1062,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 
 
 	// Transaction + Modify for stable Undo/Redo
-	const FScopedTransaction Transaction(FText::FromString(TEXT("UnrealMCP: Set TextBlock Binding")));
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Set TextBlock Binding")));
 	WidgetBlueprint->Modify();
 	if (WidgetBlueprint->WidgetTree)
 	{
@@ -715,7 +1077,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 	);
 
 	// Find the TextBlock widget
-	UTextBlock* TextBlock = Cast<UTextBlock>(WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName)));
+	UTextBlock* TextBlock = Cast<UTextBlock>(FUnrealMCPWidgetIndex::Get().FindWidget(WidgetBlueprint, FName(*WidgetName)));
 	if (!TextBlock)
 	{
 		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to find TextBlock widget: %s"), *WidgetName));
@@ -774,18 +1136,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
 	WidgetBlueprint->MarkPackageDirty();
 
-	{
-		FString SaveObjectPath;
-		FString SaveErr;
-		if (!ResolvedPath.IsEmpty() && FUnrealMCPCommonUtils::MakeObjectPathFromAssetPath(ResolvedPath, SaveObjectPath, SaveErr))
-		{
-			UEditorAssetLibrary::SaveAsset(SaveObjectPath, false);
-		}
-		else if (!BlueprintPath.IsEmpty())
-		{
-			UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
-		}
-	}
+	FUnrealMCPSaveQueue::Get().SaveOrDefer(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("binding_name"), BindingName);
@@ -799,4 +1150,274 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 		}
 	}
 	return Response;
-} 
\ No newline at end of file
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBuildWidgetTree(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintName;
+	FString BlueprintPath;
+	Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
+	Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath);
+	if (BlueprintName.IsEmpty() && BlueprintPath.IsEmpty())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' or 'blueprint_path' parameter"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+	if (!Params->TryGetArrayField(TEXT("widgets"), Nodes) || Nodes->Num() == 0)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+			TEXT("Missing 'widgets' parameter"),
+			TEXT("ERR_BAD_REQUEST"),
+			TEXT("widgets: [{type, name, is_variable, properties: {path: value}, slot: {path: value}, position, size, events: [..], bindings: {Property: Function}, children: [..]}]"));
+	}
+
+	FString ResolvedPath;
+	TArray<FString> Candidates;
+	UWidgetBlueprint* WidgetBlueprint = FUnrealMCPCommonUtils::ResolveWidgetBlueprintFromNameOrPath(BlueprintName, BlueprintPath, ResolvedPath, Candidates);
+	if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+	{
+		FString Details;
+		if (Candidates.Num() > 1)
+		{
+			Details = TEXT("Multiple widget blueprints matched by name. Please pass blueprint_path. Candidates:\n");
+			for (const FString& C : Candidates)
+			{
+				Details += TEXT("- ") + C + TEXT("\n");
+			}
+		}
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(FString::Printf(TEXT("Widget Blueprint '%s' not found or ambiguous"), *BlueprintName), TEXT("ERR_ASSET_NOT_FOUND"), Details);
+	}
+	UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+
+	bool bReplace = false;
+	Params->TryGetBoolField(TEXT("replace"), bReplace);
+
+	FString ParentName;
+	Params->TryGetStringField(TEXT("parent"), ParentName);
+
+	// Validate against the tree as it will be once 'replace' has cleared it, before anything is removed
+	if (bReplace && !ParentName.IsEmpty())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+			TEXT("'parent' cannot be combined with replace: true"),
+			TEXT("ERR_BAD_REQUEST"),
+			TEXT("replace rebuilds the whole tree from a single root widget"));
+	}
+
+	UPanelWidget* Parent = nullptr;
+	if (!ParentName.IsEmpty())
+	{
+		Parent = Cast<UPanelWidget>(FUnrealMCPWidgetIndex::Get().FindWidget(WidgetBlueprint, FName(*ParentName)));
+		if (!Parent)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+				FString::Printf(TEXT("Parent panel '%s' not found"), *ParentName),
+				TEXT("ERR_BAD_REQUEST"),
+				TEXT("parent must name an existing panel widget (CanvasPanel, VerticalBox, Overlay, ...)"));
+		}
+	}
+	else if (!bReplace && WidgetTree->RootWidget)
+	{
+		Parent = Cast<UPanelWidget>(WidgetTree->RootWidget);
+		if (!Parent)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+				TEXT("Root widget is not a panel"),
+				TEXT("ERR_BAD_REQUEST"),
+				TEXT("Pass parent, or replace: true to rebuild the tree"));
+		}
+	}
+	else if (Nodes->Num() != 1)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+			bReplace ? TEXT("replace: true needs exactly one root widget in 'widgets'") : TEXT("The tree has no root; 'widgets' must contain exactly one root widget"),
+			TEXT("ERR_BAD_REQUEST"),
+			TEXT(""));
+	}
+
+	// The root must build once the old tree is gone, so check its type and name while it is still there
+	TArray<UWidget*> Existing;
+	if (bReplace)
+	{
+		WidgetTree->GetAllWidgets(Existing);
+		const TSharedPtr<FJsonObject>* RootNode = nullptr;
+		FString RootName;
+		FString RootErr;
+		if (!(*Nodes)[0]->TryGetObject(RootNode))
+		{
+			RootErr = TEXT("Widget entries must be objects");
+		}
+		else
+		{
+			(*RootNode)->TryGetStringField(TEXT("name"), RootName);
+			if (ResolveWidgetClass(WidgetBlueprint, *RootNode, RootErr))
+			{
+				CheckWidgetName(WidgetTree, RootName, Existing, RootErr);
+			}
+		}
+		if (!RootErr.IsEmpty())
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+				TEXT("Invalid root widget; the existing tree was left unchanged"),
+				TEXT("ERR_BAD_REQUEST"),
+				RootName.IsEmpty() ? RootErr : FString::Printf(TEXT("%s: %s"), *RootName, *RootErr));
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// One transaction for the whole tree; undo removes it in one step
+	const FUnrealMCPBatchTransaction::FEditScope Transaction(FText::FromString(TEXT("UnrealMCP: Build Widget Tree")));
+	WidgetBlueprint->Modify();
+	WidgetTree->SetFlags(RF_Transactional);
+	WidgetTree->Modify();
+
+	int32 Removed = 0;
+	UWidget* OldRoot = WidgetTree->RootWidget;
+	const TArray<FDelegateEditorBinding> OldBindings = WidgetBlueprint->Bindings;
+	TArray<FName> OldNames;
+	if (bReplace)
+	{
+		for (UWidget* Widget : Existing)
+		{
+			OldNames.Add(Widget->GetFName());
+			// Free the name for the rebuild; bound event nodes stay and are reused by name
+			WidgetBlueprint->Bindings.RemoveAll([Widget](const FDelegateEditorBinding& Binding)
+			{
+				return Binding.ObjectName == Widget->GetName();
+			});
+			Widget->Modify();
+			Widget->Rename(*MakeUniqueObjectName(GetTransientPackage(), Widget->GetClass()).ToString(), GetTransientPackage(), REN_DontCreateRedirectors);
+		}
+		WidgetTree->RootWidget = nullptr;
+		Removed = Existing.Num();
+	}
+
+	UnrealMcpWidgetTree::FBuildContext Ctx;
+	Ctx.Blueprint = WidgetBlueprint;
+	for (const TSharedPtr<FJsonValue>& NodeValue : *Nodes)
+	{
+		const TSharedPtr<FJsonObject>* Node = nullptr;
+		if (!NodeValue->TryGetObject(Node))
+		{
+			UnrealMcpWidgetTree::AddError(Ctx, FString(), TEXT("Widget entries must be objects"));
+			continue;
+		}
+		UWidget* Widget = UnrealMcpWidgetTree::BuildNode(Ctx, *Node, Parent);
+		if (Widget && !Parent)
+		{
+			WidgetTree->RootWidget = Widget;
+		}
+	}
+
+	if (bReplace && !WidgetTree->RootWidget)
+	{
+		// Root still failed to construct; put the old tree back rather than leave the Widget Blueprint empty
+		for (int32 Index = 0; Index < Existing.Num(); ++Index)
+		{
+			Existing[Index]->Rename(*OldNames[Index].ToString(), WidgetTree, REN_DontCreateRedirectors);
+		}
+		WidgetTree->RootWidget = OldRoot;
+		WidgetBlueprint->Bindings = OldBindings;
+		FString Details;
+		for (const TSharedPtr<FJsonValue>& Error : Ctx.Errors)
+		{
+			const TSharedPtr<FJsonObject> ErrorObj = Error->AsObject();
+			Details += FString::Printf(TEXT("%s: %s\n"), *ErrorObj->GetStringField(TEXT("widget")), *ErrorObj->GetStringField(TEXT("error")));
+		}
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(
+			TEXT("Root widget failed to build; the existing tree was restored"),
+			TEXT("ERR_BAD_REQUEST"),
+			Details);
+	}
+
+	const int32 EventsAdded = UnrealMcpWidgetTree::AddBoundEvents(Ctx);
+
+	// Compiled once by the bridge at the end of the request (or batch)
+	FUnrealMCPCompileQueue::Get().MarkDirty(WidgetBlueprint, FUnrealMCPCompileQueue::ECompileLevel::Full);
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetArrayField(TEXT("widgets"), Ctx.Widgets);
+	ResultObj->SetNumberField(TEXT("created"), Ctx.Widgets.Num());
+	ResultObj->SetNumberField(TEXT("removed"), Removed);
+	ResultObj->SetNumberField(TEXT("events_bound"), EventsAdded);
+	ResultObj->SetNumberField(TEXT("bindings"), Ctx.BindingCount);
+	ResultObj->SetArrayField(TEXT("errors"), Ctx.Errors);
+	ResultObj->SetNumberField(TEXT("duration_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+	return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleGetWidgetTree(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintName;
+	FString BlueprintPath;
+	Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
+	Params->TryGetStringField(TEXT("blueprint_path"), BlueprintPath);
+	if (BlueprintName.IsEmpty() && BlueprintPath.IsEmpty())
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' or 'blueprint_path' parameter"));
+	}
+
+	FString ResolvedPath;
+	TArray<FString> Candidates;
+	UWidgetBlueprint* WidgetBlueprint = FUnrealMCPCommonUtils::ResolveWidgetBlueprintFromNameOrPath(BlueprintName, BlueprintPath, ResolvedPath, Candidates);
+	if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+	{
+		FString Details;
+		if (Candidates.Num() > 1)
+		{
+			Details = TEXT("Multiple widget blueprints matched by name. Please pass blueprint_path. Candidates:\n");
+			for (const FString& C : Candidates)
+			{
+				Details += TEXT("- ") + C + TEXT("\n");
+			}
+		}
+		return FUnrealMCPCommonUtils::CreateErrorResponseEx(FString::Printf(TEXT("Widget Blueprint '%s' not found or ambiguous"), *BlueprintName), TEXT("ERR_ASSET_NOT_FOUND"), Details);
+	}
+
+	bool bIncludeProperties = true;
+	Params->TryGetBoolField(TEXT("include_properties"), bIncludeProperties);
+
+	UWidget* Root = WidgetBlueprint->WidgetTree->RootWidget;
+	FString RootName;
+	if (Params->TryGetStringField(TEXT("root"), RootName) && !RootName.IsEmpty())
+	{
+		Root = FUnrealMCPWidgetIndex::Get().FindWidget(WidgetBlueprint, FName(*RootName));
+		if (!Root)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponseEx(FString::Printf(TEXT("Widget '%s' not found"), *RootName), TEXT("ERR_BAD_REQUEST"), TEXT(""));
+		}
+	}
+
+	// Bound events and property bindings are gathered once, not per widget
+	TMultiMap<FName, FName> EventsByWidget;
+	TArray<UK2Node_ComponentBoundEvent*> BoundEvents;
+	FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_ComponentBoundEvent>(WidgetBlueprint, BoundEvents);
+	for (const UK2Node_ComponentBoundEvent* EventNode : BoundEvents)
+	{
+		EventsByWidget.Add(EventNode->ComponentPropertyName, EventNode->DelegatePropertyName);
+	}
+	TMultiMap<FString, const FDelegateEditorBinding*> BindingsByWidget;
+	for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+	{
+		BindingsByWidget.Add(Binding.ObjectName, &Binding);
+	}
+
+	TArray<UWidget*> AllWidgets;
+	WidgetBlueprint->WidgetTree->GetAllWidgets(AllWidgets);
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	if (Root)
+	{
+		ResultObj->SetObjectField(TEXT("root"), UnrealMcpWidgetTree::ExportWidget(Root, bIncludeProperties, EventsByWidget, BindingsByWidget));
+	}
+	else
+	{
+		ResultObj->SetField(TEXT("root"), MakeShared<FJsonValueNull>());
+	}
+	ResultObj->SetNumberField(TEXT("widget_count"), AllWidgets.Num());
+	FUnrealMCPCommonUtils::AddResolvedAssetFields(ResultObj, ResolvedPath);
+	return ResultObj;
+}
@@ -0,0 +1,202 @@
+#include "Commands/UnrealMCPWidgetIndex.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelWidget.h"
+#include "EdGraph/EdGraph.h"
+#include "K2Node_ComponentBoundEvent.h"
+
+namespace UnrealMcpWidgetIndex
+{
+	/** Widget still belongs to the Blueprint's tree: right outer and reachable from the root or a named slot. */
+	static bool IsInTree(const UWidgetTree* WidgetTree, const UWidget* Widget)
+	{
+		if (!IsValid(Widget) || Widget->GetOuter() != WidgetTree)
+		{
+			return false;
+		}
+		const UWidget* Top = Widget;
+		while (const UPanelWidget* Parent = Top->GetParent())
+		{
+			Top = Parent;
+		}
+		if (Top == WidgetTree->RootWidget)
+		{
+			return true;
+		}
+		for (const TPair<FName, TObjectPtr<UWidget>>& Binding : WidgetTree->NamedSlotBindings)
+		{
+			if (Binding.Value == Top)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static bool IsLiveEvent(const UK2Node_ComponentBoundEvent* Node, FName WidgetName, FName EventName)
+	{
+		return IsValid(Node) && Node->GetGraph() &&
+			Node->ComponentPropertyName == WidgetName && Node->DelegatePropertyName == EventName;
+	}
+}
+
+FUnrealMCPWidgetIndex& FUnrealMCPWidgetIndex::Get()
+{
+	static FUnrealMCPWidgetIndex Instance;
+	return Instance;
+}
+
+FUnrealMCPWidgetIndex::FEntry& FUnrealMCPWidgetIndex::FindOrAddEntry(UWidgetBlueprint* Blueprint)
+{
+	FEntry& Entry = Entries.FindOrAdd(TObjectKey<UWidgetBlueprint>(Blueprint));
+	if (!Entry.Blueprint.IsValid())
+	{
+		Entry.Blueprint = Blueprint;
+		Entry.bDirty = true;
+		Entry.BlueprintChangedHandle = Blueprint->OnChanged().AddRaw(this, &FUnrealMCPWidgetIndex::OnBlueprintChanged);
+	}
+	return Entry;
+}
+
+void FUnrealMCPWidgetIndex::Unbind(FEntry& Entry)
+{
+	for (const FGraphBinding& Binding : Entry.Graphs)
+	{
+		if (UEdGraph* Graph = Binding.Graph.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(Binding.Handle);
+		}
+	}
+	Entry.Graphs.Reset();
+}
+
+void FUnrealMCPWidgetIndex::Rebuild(FEntry& Entry)
+{
+	Unbind(Entry);
+	Entry.BoundEvents.Reset();
+	Entry.bDirty = false;
+
+	UWidgetBlueprint* Blueprint = Entry.Blueprint.Get();
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	// Bound events only live in Ubergraph pages
+	const TObjectKey<UWidgetBlueprint> BlueprintKey(Blueprint);
+	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (UK2Node_ComponentBoundEvent* EventNode = Cast<UK2Node_ComponentBoundEvent>(Node))
+			{
+				Entry.BoundEvents.Add(TPair<FName, FName>(EventNode->ComponentPropertyName, EventNode->DelegatePropertyName), EventNode);
+			}
+		}
+
+		FGraphBinding& Binding = Entry.Graphs.AddDefaulted_GetRef();
+		Binding.Graph = Graph;
+		Binding.Handle = Graph->AddOnGraphChangedHandler(
+			FOnGraphChanged::FDelegate::CreateRaw(this, &FUnrealMCPWidgetIndex::OnGraphChanged, BlueprintKey));
+	}
+}
+
+void FUnrealMCPWidgetIndex::OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UWidgetBlueprint> BlueprintKey)
+{
+	FEntry* Entry = Entries.Find(BlueprintKey);
+	if (!Entry || Entry->bDirty)
+	{
+		return;
+	}
+
+	if (Action.Action & GRAPHACTION_AddNode)
+	{
+		for (const UEdGraphNode* Node : Action.Nodes)
+		{
+			if (const UK2Node_ComponentBoundEvent* EventNode = Cast<UK2Node_ComponentBoundEvent>(Node))
+			{
+				Entry->BoundEvents.Add(TPair<FName, FName>(EventNode->ComponentPropertyName, EventNode->DelegatePropertyName),
+					const_cast<UK2Node_ComponentBoundEvent*>(EventNode));
+			}
+		}
+	}
+	else if (Action.Action & GRAPHACTION_RemoveNode)
+	{
+		for (const UEdGraphNode* Node : Action.Nodes)
+		{
+			if (const UK2Node_ComponentBoundEvent* EventNode = Cast<UK2Node_ComponentBoundEvent>(Node))
+			{
+				Entry->BoundEvents.Remove(TPair<FName, FName>(EventNode->ComponentPropertyName, EventNode->DelegatePropertyName));
+			}
+		}
+	}
+	else
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FUnrealMCPWidgetIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Entries.Find(TObjectKey<UWidgetBlueprint>(Cast<UWidgetBlueprint>(Blueprint))))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+void FUnrealMCPWidgetIndex::Invalidate(UWidgetBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Entries.Find(TObjectKey<UWidgetBlueprint>(Blueprint)))
+	{
+		Entry->bDirty = true;
+	}
+}
+
+UWidget* FUnrealMCPWidgetIndex::FindWidget(UWidgetBlueprint* Blueprint, FName WidgetName)
+{
+	check(IsInGameThread());
+	if (!Blueprint || !Blueprint->WidgetTree || WidgetName.IsNone())
+	{
+		return nullptr;
+	}
+	// Removed widgets are moved out of the tree's outer, but may linger detached; check reachability too
+	UWidget* Widget = FindObjectFast<UWidget>(Blueprint->WidgetTree, WidgetName);
+	return UnrealMcpWidgetIndex::IsInTree(Blueprint->WidgetTree, Widget) ? Widget : nullptr;
+}
+
+UK2Node_ComponentBoundEvent* FUnrealMCPWidgetIndex::FindBoundEvent(UWidgetBlueprint* Blueprint, FName WidgetName, FName EventName)
+{
+	check(IsInGameThread());
+	if (!Blueprint || WidgetName.IsNone() || EventName.IsNone())
+	{
+		return nullptr;
+	}
+
+	FEntry& Entry = FindOrAddEntry(Blueprint);
+	if (Entry.bDirty)
+	{
+		Rebuild(Entry);
+	}
+
+	const TPair<FName, FName> Key(WidgetName, EventName);
+	const TWeakObjectPtr<UK2Node_ComponentBoundEvent>* Found = Entry.BoundEvents.Find(Key);
+	UK2Node_ComponentBoundEvent* Node = Found ? Found->Get() : nullptr;
+	if (UnrealMcpWidgetIndex::IsLiveEvent(Node, WidgetName, EventName))
+	{
+		return Node;
+	}
+	if (!Found)
+	{
+		// Every Ubergraph page is bound, so a clean index that has no entry really has no node
+		return nullptr;
+	}
+
+	Rebuild(Entry);
+	Found = Entry.BoundEvents.Find(Key);
+	Node = Found ? Found->Get() : nullptr;
+	return UnrealMcpWidgetIndex::IsLiveEvent(Node, WidgetName, EventName) ? Node : nullptr;
+}
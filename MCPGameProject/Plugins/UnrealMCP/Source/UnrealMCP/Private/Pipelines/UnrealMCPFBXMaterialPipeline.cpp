@@ -24,6 +24,120 @@
 #include "Factories/MaterialInstanceConstantFactoryNew.h"
 #include "EditorAssetLibrary.h"
 #include "UObject/SavePackage.h"
+#include "FileHelpers.h"
+
+void FUnrealMCPTextureParameterMatcher::Insert(TArray<FTrieNode>& Trie, const FString& Key, int32 ParameterIndex)
+{
+	if (Trie.Num() == 0)
+	{
+		Trie.AddDefaulted();
+	}
+
+	int32 NodeIndex = 0;
+	for (const TCHAR Char : Key)
+	{
+		const int32* Child = Trie[NodeIndex].Children.Find(Char);
+		if (Child)
+		{
+			NodeIndex = *Child;
+		}
+		else
+		{
+			const int32 NewIndex = Trie.AddDefaulted();
+			Trie[NodeIndex].Children.Add(Char, NewIndex);
+			NodeIndex = NewIndex;
+		}
+	}
+	Trie[NodeIndex].ParameterIndex = ParameterIndex;
+}
+
+void FUnrealMCPTextureParameterMatcher::Build(const TMap<FString, FString>& Mapping)
+{
+	SuffixTrie.Reset();
+	TokenTrie.Reset();
+	ParameterNames.Reset();
+
+	for (const TPair<FString, FString>& Pair : Mapping)
+	{
+		if (Pair.Key.IsEmpty() || Pair.Value.IsEmpty())
+		{
+			continue;
+		}
+
+		const int32 ParameterIndex = ParameterNames.Add(FName(*Pair.Value));
+		const FString Key = Pair.Key.ToLower();
+		if (Key.StartsWith(TEXT("_")))
+		{
+			Insert(SuffixTrie, Key.Reverse(), ParameterIndex);
+		}
+		else
+		{
+			Insert(TokenTrie, Key, ParameterIndex);
+		}
+	}
+}
+
+bool FUnrealMCPTextureParameterMatcher::Match(const FString& TextureName, FName& OutParameterName) const
+{
+	const FString Name = TextureName.ToLower();
+
+	// Suffix rules: walk the name backwards, keep the deepest (longest) terminal node.
+	if (SuffixTrie.Num() > 0)
+	{
+		int32 NodeIndex = 0;
+		int32 Best = INDEX_NONE;
+		for (int32 CharIndex = Name.Len() - 1; CharIndex >= 0; --CharIndex)
+		{
+			const int32* Child = SuffixTrie[NodeIndex].Children.Find(Name[CharIndex]);
+			if (!Child)
+			{
+				break;
+			}
+			NodeIndex = *Child;
+			if (SuffixTrie[NodeIndex].ParameterIndex != INDEX_NONE)
+			{
+				Best = SuffixTrie[NodeIndex].ParameterIndex;
+			}
+		}
+		if (Best != INDEX_NONE)
+		{
+			OutParameterName = ParameterNames[Best];
+			return true;
+		}
+	}
+
+	// Token rules: the type token is usually last (T_Rock_Normal), so scan tokens right to left.
+	if (TokenTrie.Num() > 0)
+	{
+		TArray<FString> Tokens;
+		Name.ParseIntoArray(Tokens, TEXT("_"), true);
+		for (int32 TokenIndex = Tokens.Num() - 1; TokenIndex >= 0; --TokenIndex)
+		{
+			int32 NodeIndex = 0;
+			int32 Best = INDEX_NONE;
+			for (const TCHAR Char : Tokens[TokenIndex])
+			{
+				const int32* Child = TokenTrie[NodeIndex].Children.Find(Char);
+				if (!Child)
+				{
+					break;
+				}
+				NodeIndex = *Child;
+				if (TokenTrie[NodeIndex].ParameterIndex != INDEX_NONE)
+				{
+					Best = TokenTrie[NodeIndex].ParameterIndex;
+				}
+			}
+			if (Best != INDEX_NONE)
+			{
+				OutParameterName = ParameterNames[Best];
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
 
 UUnrealMCPFBXMaterialPipeline::UUnrealMCPFBXMaterialPipeline()
 {
@@ -73,6 +187,10 @@ void UUnrealMCPFBXMaterialPipeline::ExecutePipeline(
 	// Clear caches for new import
 	CreatedMaterialInstances.Empty();
 	ImportedTextures.Empty();
+	PendingMaterials.Empty();
+	PendingFactoryNodeUids.Empty();
+	bBindingPassDone = false;
+	TextureMatcher.Build(TextureParameterMapping);
 
 	// Call parent implementation first
 	Super::ExecutePipeline(InBaseNodeContainer, InSourceDatas, ContentBasePath);
@@ -92,17 +210,19 @@ void UUnrealMCPFBXMaterialPipeline::ExecutePipeline(
 					
 					// Enable material import
 					MaterialFactoryNode->SetEnabled(true);
+					PendingFactoryNodeUids.Add(NodeUid);
 				}
 			}
 		);
 
-		// Cache texture factory nodes for later use
+		// Track texture factory nodes so the binding pass waits for every texture, whatever the import order
 		InBaseNodeContainer->IterateNodesOfType<UInterchangeTextureFactoryNode>(
 			[this](const FString& NodeUid, UInterchangeTextureFactoryNode* TextureFactoryNode)
 			{
-				if (TextureFactoryNode)
+				if (TextureFactoryNode && TextureFactoryNode->IsEnabled())
 				{
 					UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Found texture factory node: %s"), *TextureFactoryNode->GetDisplayLabel());
+					PendingFactoryNodeUids.Add(NodeUid);
 				}
 			}
 		);
@@ -126,57 +246,217 @@ void UUnrealMCPFBXMaterialPipeline::ExecutePostImportPipeline(
 	UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: ExecutePostImportPipeline for asset: %s (Class: %s)"),
 		*CreatedAsset->GetName(), *CreatedAsset->GetClass()->GetName());
 
-	// Handle imported textures - cache them for material instance configuration
+	// Only collect results here. Textures can arrive after the materials that use them, so binding
+	// waits until every expected texture/material factory node has posted.
 	if (UTexture* ImportedTexture = Cast<UTexture>(CreatedAsset))
 	{
 		FString TextureName = ImportedTexture->GetName();
 		ImportedTextures.Add(TextureName, ImportedTexture);
 		UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Cached imported texture: %s"), *TextureName);
 	}
-
-	// Handle imported materials - create material instances
-	if (UMaterialInterface* ImportedMaterial = Cast<UMaterialInterface>(CreatedAsset))
+	else if (UMaterialInterface* ImportedMaterial = Cast<UMaterialInterface>(CreatedAsset))
 	{
 		if (bAutoCreateMaterialInstances)
 		{
-			// Determine package path for material instance
-			FString MaterialPath = ImportedMaterial->GetPathName();
-			FString PackagePath = FPaths::GetPath(MaterialPath);
-			
-			if (!MaterialInstanceSubFolder.IsEmpty())
-			{
-				PackagePath = FPaths::Combine(PackagePath, MaterialInstanceSubFolder);
-			}
+			PendingMaterials.AddUnique(ImportedMaterial);
+		}
+	}
 
-			// Create material instance name
-			FString InstanceName = FString::Printf(TEXT("MI_%s"), *ImportedMaterial->GetName());
+	PendingFactoryNodeUids.Remove(NodeKey);
+	LastPostImportTime = FPlatformTime::Seconds();
 
-			// Create material instance
-			UMaterialInstanceConstant* NewInstance = CreateMaterialInstanceFromMaterial(
-				ImportedMaterial,
-				InstanceName,
-				PackagePath
-			);
+	if (PendingFactoryNodeUids.Num() == 0)
+	{
+		RunDeferredBindingPass();
+	}
+	else
+	{
+		ScheduleBindingPassFallback();
+	}
+}
 
-			if (NewInstance)
-			{
-				CreatedMaterialInstances.Add(ImportedMaterial->GetName(), NewInstance);
-				UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Created material instance: %s"), *NewInstance->GetPathName());
+void UUnrealMCPFBXMaterialPipeline::ScheduleBindingPassFallback()
+{
+	if (BindingFallbackHandle.IsValid() || bBindingPassDone)
+	{
+		return;
+	}
 
-				// Configure textures if enabled
-				if (bAutoAssignTextures && ImportedTextures.Num() > 0)
-				{
-					ConfigureMaterialInstanceTextures(NewInstance, ImportedTextures);
-				}
+	// If a factory node never posts (import error, filtered asset), run the pass once post-import goes quiet.
+	static constexpr float IdleSeconds = 1.0f;
+	BindingFallbackHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+	{
+		if (bBindingPassDone)
+		{
+			BindingFallbackHandle.Reset();
+			return false;
+		}
+		if (FPlatformTime::Seconds() - LastPostImportTime < IdleSeconds)
+		{
+			return true;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("UnrealMCPFBXMaterialPipeline: %d expected factory node(s) never completed; binding with what was imported"),
+			PendingFactoryNodeUids.Num());
+		BindingFallbackHandle.Reset();
+		RunDeferredBindingPass();
+		return false;
+	}), IdleSeconds);
+}
+
+void UUnrealMCPFBXMaterialPipeline::RunDeferredBindingPass()
+{
+	if (bBindingPassDone)
+	{
+		return;
+	}
+	bBindingPassDone = true;
+
+	if (BindingFallbackHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(BindingFallbackHandle);
+		BindingFallbackHandle.Reset();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Binding pass for %d material(s), %d texture(s)"),
+		PendingMaterials.Num(), ImportedTextures.Num());
+
+	struct FPendingInstance
+	{
+		UMaterialInterface* Material = nullptr;
+		FString InstanceName;
+		FString PackagePath;
+	};
+
+	TArray<FPendingInstance> Work;
+	TSet<FName> PackagePaths;
+	for (const TWeakObjectPtr<UMaterialInterface>& MaterialPtr : PendingMaterials)
+	{
+		UMaterialInterface* ImportedMaterial = MaterialPtr.Get();
+		if (!ImportedMaterial)
+		{
+			continue;
+		}
+
+		// Determine package path for material instance
+		FPendingInstance& Item = Work.AddDefaulted_GetRef();
+		Item.Material = ImportedMaterial;
+		Item.PackagePath = FPaths::GetPath(ImportedMaterial->GetPathName());
+		if (!MaterialInstanceSubFolder.IsEmpty())
+		{
+			Item.PackagePath = FPaths::Combine(Item.PackagePath, MaterialInstanceSubFolder);
+		}
+		Item.InstanceName = FString::Printf(TEXT("MI_%s"), *ImportedMaterial->GetName());
+		PackagePaths.Add(FName(*Item.PackagePath));
+	}
+	PendingMaterials.Empty();
+
+	if (Work.Num() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// One registry query for every target folder replaces a DoesAssetExist + LoadAsset pair per material.
+	TMap<FName, FAssetData> ExistingInstances;
+	{
+		FARFilter Filter;
+		Filter.PackagePaths = PackagePaths.Array();
+		Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+
+		TArray<FAssetData> Assets;
+		IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+		for (FAssetData& Asset : Assets)
+		{
+			ExistingInstances.Add(Asset.PackageName, MoveTemp(Asset));
+		}
+	}
+	const double LookupTime = FPlatformTime::Seconds();
+
+	UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+	TArray<UMaterialInstanceConstant*> NewInstances;
+	int32 ReusedCount = 0;
+
+	for (const FPendingInstance& Item : Work)
+	{
+		const FName PackageName(*FPaths::Combine(Item.PackagePath, Item.InstanceName));
+		const bool bExisted = ExistingInstances.Contains(PackageName);
+
+		UMaterialInstanceConstant* NewInstance = CreateMaterialInstanceInternal(
+			Item.Material,
+			Item.InstanceName,
+			Item.PackagePath,
+			&ExistingInstances,
+			Factory,
+			false
+		);
+
+		if (!NewInstance)
+		{
+			continue;
+		}
+
+		CreatedMaterialInstances.Add(Item.Material->GetName(), NewInstance);
+		if (bExisted)
+		{
+			++ReusedCount;
+		}
+		else
+		{
+			NewInstances.Add(NewInstance);
+		}
+
+		// Configure textures if enabled
+		if (bAutoAssignTextures && ImportedTextures.Num() > 0)
+		{
+			ConfigureMaterialInstanceTextures(NewInstance, ImportedTextures);
+		}
+	}
+
+	// Notify asset registry once per pass rather than interleaved with creation
+	for (UMaterialInstanceConstant* NewInstance : NewInstances)
+	{
+		FAssetRegistryModule::AssetCreated(NewInstance);
+	}
+	const double CreateTime = FPlatformTime::Seconds();
+
+	if (bSaveCreatedInstances && CreatedMaterialInstances.Num() > 0)
+	{
+		TArray<UPackage*> Packages;
+		for (const TPair<FString, UMaterialInstanceConstant*>& Pair : CreatedMaterialInstances)
+		{
+			if (Pair.Value)
+			{
+				Packages.AddUnique(Pair.Value->GetOutermost());
 			}
 		}
+		UEditorLoadingAndSavingUtils::SavePackages(Packages, true);
 	}
+	const double EndTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: %d instance(s) (%d created, %d reused) in %.2f ms, %.3f ms/material "
+		"(lookup %.2f ms, create+bind %.2f ms, save %.2f ms)"),
+		NewInstances.Num() + ReusedCount, NewInstances.Num(), ReusedCount,
+		(EndTime - StartTime) * 1000.0, (CreateTime - StartTime) * 1000.0 / Work.Num(),
+		(LookupTime - StartTime) * 1000.0, (CreateTime - LookupTime) * 1000.0, (EndTime - CreateTime) * 1000.0);
 }
 
 UMaterialInstanceConstant* UUnrealMCPFBXMaterialPipeline::CreateMaterialInstanceFromMaterial(
 	UMaterialInterface* SourceMaterial,
 	const FString& InstanceName,
 	const FString& PackagePath)
+{
+	return CreateMaterialInstanceInternal(SourceMaterial, InstanceName, PackagePath, nullptr, nullptr, true);
+}
+
+UMaterialInstanceConstant* UUnrealMCPFBXMaterialPipeline::CreateMaterialInstanceInternal(
+	UMaterialInterface* SourceMaterial,
+	const FString& InstanceName,
+	const FString& PackagePath,
+	const TMap<FName, FAssetData>* ExistingInstances,
+	UMaterialInstanceConstantFactoryNew* Factory,
+	bool bNotifyRegistry)
 {
 	if (!SourceMaterial)
 	{
@@ -196,7 +476,15 @@ UMaterialInstanceConstant* UUnrealMCPFBXMaterialPipeline::CreateMaterialInstance
 	FString FullPath = FPaths::Combine(PackagePath, InstanceName);
 	
 	// Check if already exists
-	if (UEditorAssetLibrary::DoesAssetExist(FullPath))
+	if (ExistingInstances)
+	{
+		if (const FAssetData* Existing = ExistingInstances->Find(FName(*FullPath)))
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("UnrealMCPFBXMaterialPipeline: Material instance already exists: %s"), *FullPath);
+			return Cast<UMaterialInstanceConstant>(Existing->GetAsset());
+		}
+	}
+	else if (UEditorAssetLibrary::DoesAssetExist(FullPath))
 	{
 		UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Material instance already exists: %s"), *FullPath);
 		return Cast<UMaterialInstanceConstant>(UEditorAssetLibrary::LoadAsset(FullPath));
@@ -211,7 +499,10 @@ UMaterialInstanceConstant* UUnrealMCPFBXMaterialPipeline::CreateMaterialInstance
 	}
 
 	// Create material instance using factory
-	UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+	if (!Factory)
+	{
+		Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+	}
 	Factory->InitialParent = ParentMat;
 
 	UMaterialInstanceConstant* NewInstance = Cast<UMaterialInstanceConstant>(
@@ -230,8 +521,11 @@ UMaterialInstanceConstant* UUnrealMCPFBXMaterialPipeline::CreateMaterialInstance
 		// Mark package dirty
 		Package->MarkPackageDirty();
 
-		// Notify asset registry
-		FAssetRegistryModule::AssetCreated(NewInstance);
+		// Notify asset registry (batch callers notify once at the end of the pass)
+		if (bNotifyRegistry)
+		{
+			FAssetRegistryModule::AssetCreated(NewInstance);
+		}
 
 		UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Successfully created material instance: %s"), *FullPath);
 	}
@@ -254,38 +548,76 @@ void UUnrealMCPFBXMaterialPipeline::ConfigureMaterialInstanceTextures(
 
 	UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Configuring textures for material instance: %s"), *MaterialInstance->GetName());
 
-	// Iterate through texture map and try to assign to material parameters
+	// Called from Blueprint too, outside an import; compile the matcher on demand.
+	if (TextureMatcher.IsEmpty())
+	{
+		TextureMatcher.Build(TextureParameterMapping);
+	}
+
+	// Resolve the instance's texture parameters once instead of probing per texture.
+	TArray<FMaterialParameterInfo> ParameterInfos;
+	TArray<FGuid> ParameterIds;
+	MaterialInstance->GetAllTextureParameterInfo(ParameterInfos, ParameterIds);
+	TSet<FName> AvailableParameters;
+	for (const FMaterialParameterInfo& Info : ParameterInfos)
+	{
+		AvailableParameters.Add(Info.Name);
+	}
+
+	// Several textures can map to one parameter (a pack shared by many materials). Prefer the texture whose
+	// name shares the longest stem with the material, e.g. T_Rock_N for MI_M_Rock.
+	auto StemScore = [](const FString& A, const FString& B) -> int32
+	{
+		const int32 MaxLen = FMath::Min(A.Len(), B.Len());
+		int32 Score = 0;
+		while (Score < MaxLen && FChar::ToLower(A[Score]) == FChar::ToLower(B[Score]))
+		{
+			++Score;
+		}
+		return Score;
+	};
+	FString MaterialStem = MaterialInstance->GetName();
+	for (const TCHAR* Prefix : { TEXT("MI_"), TEXT("M_") })
+	{
+		MaterialStem.RemoveFromStart(Prefix, ESearchCase::IgnoreCase);
+	}
+
+	TMap<FName, TPair<UTexture*, int32>> Assignments;
 	for (const auto& TexturePair : TextureMap)
 	{
-		const FString& TextureName = TexturePair.Key;
 		UTexture* Texture = TexturePair.Value;
-
-		if (!Texture)
+		FName ParameterName;
+		if (!Texture || !TextureMatcher.Match(TexturePair.Key, ParameterName) || !AvailableParameters.Contains(ParameterName))
 		{
 			continue;
 		}
 
-		// Try to find matching parameter name based on texture name
-		for (const auto& Mapping : TextureParameterMapping)
+		FString TextureStem = TexturePair.Key;
+		TextureStem.RemoveFromStart(TEXT("T_"), ESearchCase::IgnoreCase);
+		const int32 Score = StemScore(TextureStem, MaterialStem);
+
+		TPair<UTexture*, int32>* Existing = Assignments.Find(ParameterName);
+		if (!Existing || Score > Existing->Value)
 		{
-			if (TextureName.Contains(Mapping.Key, ESearchCase::IgnoreCase))
-			{
-				FName ParameterName(*Mapping.Value);
-				
-				// Check if the material has this parameter
-				UTexture* ExistingTexture = nullptr;
-				if (MaterialInstance->GetTextureParameterValue(ParameterName, ExistingTexture))
-				{
-					// Set the texture parameter
-					MaterialInstance->SetTextureParameterValueEditorOnly(ParameterName, Texture);
-					UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Set texture parameter %s = %s"),
-						*Mapping.Value, *TextureName);
-					break;
-				}
-			}
+			Assignments.Add(ParameterName, TPair<UTexture*, int32>(Texture, Score));
 		}
 	}
 
+	if (Assignments.Num() == 0)
+	{
+		return;
+	}
+
+	// Apply every parameter inside one edit so the instance updates and recompiles once.
+	MaterialInstance->PreEditChange(nullptr);
+	for (const TPair<FName, TPair<UTexture*, int32>>& Assignment : Assignments)
+	{
+		MaterialInstance->SetTextureParameterValueEditorOnly(Assignment.Key, Assignment.Value.Key);
+		UE_LOG(LogTemp, Log, TEXT("UnrealMCPFBXMaterialPipeline: Set texture parameter %s = %s"),
+			*Assignment.Key.ToString(), *Assignment.Value.Key->GetName());
+	}
+	MaterialInstance->PostEditChange();
+
 	// Mark as modified
 	MaterialInstance->MarkPackageDirty();
 }
@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// UnrealMCP Texture Suffix Classification Pipeline Implementation
+
+#include "Pipelines/UnrealMCPTextureSuffixPipeline.h"
+
+// Interchange Core headers
+#include "Nodes/InterchangeBaseNodeContainer.h"
+#include "InterchangeSourceData.h"
+
+// Interchange Factory Nodes
+#include "InterchangeMaterialFactoryNode.h"
+#include "InterchangeTextureFactoryNode.h"
+
+// Interchange Nodes (from InterchangeNodes module)
+#include "InterchangeShaderGraphNode.h"
+
+UUnrealMCPTextureSuffixPipeline::UUnrealMCPTextureSuffixPipeline()
+{
+	bWireMaterialParameters = true;
+	bOverrideExistingParameters = false;
+
+	StemPrefixes = { TEXT("T_"), TEXT("TX_"), TEXT("MI_"), TEXT("M_"), TEXT("MAT_") };
+
+	InitializeDefaultRules();
+}
+
+void UUnrealMCPTextureSuffixPipeline::InitializeDefaultRules()
+{
+	auto AddRule = [this](const TCHAR* Suffix, TextureCompressionSettings Compression, bool bSRGB, const TCHAR* PackedChannels, const TCHAR* Parameter)
+	{
+		FUnrealMCPTextureSuffixRule& Rule = SuffixRules.AddDefaulted_GetRef();
+		Rule.Suffix = Suffix;
+		Rule.Compression = Compression;
+		Rule.bSRGB = bSRGB;
+		Rule.PackedChannels = PackedChannels;
+		Rule.MaterialParameter = Parameter;
+	};
+
+	// Parameter names match UUnrealMCPFBXMaterialPipeline's default TextureParameterMapping
+	AddRule(TEXT("_D"), TC_Default, true, TEXT(""), TEXT("BaseColorTexture"));
+	AddRule(TEXT("_BC"), TC_Default, true, TEXT(""), TEXT("BaseColorTexture"));
+	AddRule(TEXT("_BaseColor"), TC_Default, true, TEXT(""), TEXT("BaseColorTexture"));
+	AddRule(TEXT("_N"), TC_Normalmap, false, TEXT(""), TEXT("NormalTexture"));
+	AddRule(TEXT("_Normal"), TC_Normalmap, false, TEXT(""), TEXT("NormalTexture"));
+	AddRule(TEXT("_R"), TC_Grayscale, false, TEXT(""), TEXT("RoughnessTexture"));
+	AddRule(TEXT("_M"), TC_Grayscale, false, TEXT(""), TEXT("MetallicTexture"));
+	AddRule(TEXT("_AO"), TC_Grayscale, false, TEXT(""), TEXT("AmbientOcclusionTexture"));
+	AddRule(TEXT("_E"), TC_Default, true, TEXT(""), TEXT("EmissiveTexture"));
+	AddRule(TEXT("_H"), TC_Grayscale, false, TEXT(""), TEXT("HeightTexture"));
+	AddRule(TEXT("_ORM"), TC_Masks, false, TEXT("ORM"), TEXT("PackedTexture"));
+	AddRule(TEXT("_NRA"), TC_Masks, false, TEXT("NRA"), TEXT("PackedTexture"));
+}
+
+int32 UUnrealMCPTextureSuffixPipeline::ClassifyTextureName(const FString& TextureName) const
+{
+	// Rule counts are small; a linear scan keeping the longest suffix is cheaper than building a lookup per import
+	int32 BestIndex = INDEX_NONE;
+	int32 BestLength = 0;
+	for (int32 RuleIndex = 0; RuleIndex < SuffixRules.Num(); ++RuleIndex)
+	{
+		const FString& Suffix = SuffixRules[RuleIndex].Suffix;
+		if (Suffix.Len() > BestLength && TextureName.EndsWith(Suffix, ESearchCase::IgnoreCase))
+		{
+			BestIndex = RuleIndex;
+			BestLength = Suffix.Len();
+		}
+	}
+	return BestIndex;
+}
+
+FString UUnrealMCPTextureSuffixPipeline::GetNameStem(const FString& Name, int32 RuleIndex) const
+{
+	FString Stem = Name;
+	if (SuffixRules.IsValidIndex(RuleIndex))
+	{
+		Stem.LeftChopInline(SuffixRules[RuleIndex].Suffix.Len());
+	}
+	for (const FString& Prefix : StemPrefixes)
+	{
+		if (Stem.RemoveFromStart(Prefix, ESearchCase::IgnoreCase))
+		{
+			break;
+		}
+	}
+	return Stem.ToLower();
+}
+
+bool UUnrealMCPTextureSuffixPipeline::ApplyTextureRule(UInterchangeTextureFactoryNode* TextureNode, const FUnrealMCPTextureSuffixRule& Rule) const
+{
+	if (!TextureNode)
+	{
+		return false;
+	}
+
+	// Channel-packed data is never color; force linear regardless of the rule's sRGB flag
+	const bool bPacked = !Rule.PackedChannels.IsEmpty();
+	const bool bSRGB = bPacked ? false : Rule.bSRGB;
+	const uint8 Compression = static_cast<uint8>(bPacked && Rule.Compression == TC_Default ? TC_Masks : Rule.Compression.GetValue());
+
+	const bool bSetSRGB = TextureNode->SetCustomSRGB(bSRGB);
+	const bool bSetCompression = TextureNode->SetCustomCompressionSettings(Compression);
+	return bSetSRGB || bSetCompression;
+}
+
+void UUnrealMCPTextureSuffixPipeline::ExecutePipeline(
+	UInterchangeBaseNodeContainer* InBaseNodeContainer,
+	const TArray<UInterchangeSourceData*>& InSourceDatas,
+	const FString& ContentBasePath)
+{
+	Super::ExecutePipeline(InBaseNodeContainer, InSourceDatas, ContentBasePath);
+
+	if (!InBaseNodeContainer || SuffixRules.Num() == 0)
+	{
+		return;
+	}
+
+	struct FClassifiedTexture
+	{
+		FString FactoryUid;
+		int32 RuleIndex = INDEX_NONE;
+	};
+
+	// Stem -> classified textures sharing it (T_Rock_N, T_Rock_ORM -> "rock")
+	TMap<FString, TArray<FClassifiedTexture>> TexturesByStem;
+	int32 ClassifiedCount = 0;
+	int32 TextureCount = 0;
+
+	InBaseNodeContainer->IterateNodesOfType<UInterchangeTextureFactoryNode>(
+		[this, &TexturesByStem, &ClassifiedCount, &TextureCount](const FString& NodeUid, UInterchangeTextureFactoryNode* TextureFactoryNode)
+		{
+			if (!TextureFactoryNode || !TextureFactoryNode->IsEnabled())
+			{
+				return;
+			}
+			++TextureCount;
+
+			const FString TextureName = TextureFactoryNode->GetAssetName().IsEmpty() ? TextureFactoryNode->GetDisplayLabel() : TextureFactoryNode->GetAssetName();
+			const int32 RuleIndex = ClassifyTextureName(TextureName);
+			if (RuleIndex == INDEX_NONE)
+			{
+				return;
+			}
+
+			ApplyTextureRule(TextureFactoryNode, SuffixRules[RuleIndex]);
+			++ClassifiedCount;
+
+			TexturesByStem.FindOrAdd(GetNameStem(TextureName, RuleIndex)).Add({ NodeUid, RuleIndex });
+		}
+	);
+
+	int32 WiredCount = 0;
+	if (bWireMaterialParameters && TexturesByStem.Num() > 0)
+	{
+		InBaseNodeContainer->IterateNodesOfType<UInterchangeMaterialInstanceFactoryNode>(
+			[this, &TexturesByStem, &WiredCount](const FString& NodeUid, UInterchangeMaterialInstanceFactoryNode* InstanceFactoryNode)
+			{
+				if (!InstanceFactoryNode || !InstanceFactoryNode->IsEnabled())
+				{
+					return;
+				}
+
+				const FString MaterialName = InstanceFactoryNode->GetAssetName().IsEmpty() ? InstanceFactoryNode->GetDisplayLabel() : InstanceFactoryNode->GetAssetName();
+				const TArray<FClassifiedTexture>* Textures = TexturesByStem.Find(GetNameStem(MaterialName, INDEX_NONE));
+				if (!Textures)
+				{
+					return;
+				}
+
+				for (const FClassifiedTexture& Texture : *Textures)
+				{
+					const FString& Parameter = SuffixRules[Texture.RuleIndex].MaterialParameter;
+					if (Parameter.IsEmpty())
+					{
+						continue;
+					}
+
+					// Same input key the generic material pipeline writes for texture parameters
+					const FString InputKey = UInterchangeShaderPortsAPI::MakeInputValueKey(Parameter);
+					if (!bOverrideExistingParameters && InstanceFactoryNode->HasAttribute(UE::Interchange::FAttributeKey(InputKey)))
+					{
+						continue;
+					}
+
+					InstanceFactoryNode->AddStringAttribute(InputKey, Texture.FactoryUid);
+					InstanceFactoryNode->AddFactoryDependencyUid(Texture.FactoryUid);
+					++WiredCount;
+				}
+			}
+		);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealMCPTextureSuffixPipeline: Classified %d/%d texture(s), wired %d material parameter(s)"),
+		ClassifiedCount, TextureCount, WiredCount);
+}
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// UnrealMCP Texture Suffix Classification Tests
+
+#include "Pipelines/UnrealMCPTextureSuffixPipeline.h"
+#include "InterchangeMaterialFactoryNode.h"
+#include "InterchangeShaderGraphNode.h"
+#include "InterchangeTexture2DFactoryNode.h"
+#include "Misc/AutomationTest.h"
+#include "Nodes/InterchangeBaseNodeContainer.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealMCPTextureSuffixClassifyTest, "UnrealMCP.Pipelines.TextureSuffix.Classify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealMCPTextureSuffixClassifyTest::RunTest(const FString& Parameters)
+{
+	UUnrealMCPTextureSuffixPipeline* Pipeline = NewObject<UUnrealMCPTextureSuffixPipeline>(GetTransientPackage());
+
+	// Suffix of the matched rule, or empty when the name is unclassified
+	auto MatchedSuffix = [Pipeline](const FString& TextureName) -> FString
+	{
+		const int32 RuleIndex = Pipeline->ClassifyTextureName(TextureName);
+		return Pipeline->SuffixRules.IsValidIndex(RuleIndex) ? Pipeline->SuffixRules[RuleIndex].Suffix : FString();
+	};
+
+	// Default rules
+	TestEqual(TEXT("_D is base color"), MatchedSuffix(TEXT("T_Rock_D")), FString(TEXT("_D")));
+	TestEqual(TEXT("_N is a normal map"), MatchedSuffix(TEXT("T_Rock_N")), FString(TEXT("_N")));
+	TestEqual(TEXT("_ORM is packed"), MatchedSuffix(TEXT("T_Rock_ORM")), FString(TEXT("_ORM")));
+	TestEqual(TEXT("_Normal is a normal map"), MatchedSuffix(TEXT("T_Rock_Normal")), FString(TEXT("_Normal")));
+	TestEqual(TEXT("Matching ignores case"), MatchedSuffix(TEXT("t_rock_n")), FString(TEXT("_N")));
+
+	// Ambiguous: several rules match, the longest suffix wins regardless of rule order
+
+	FUnrealMCPTextureSuffixRule& DetailRule = Pipeline->SuffixRules.InsertDefaulted_GetRef(0);
+	DetailRule.Suffix = TEXT("_Detail_N");
+	DetailRule.Compression = TC_Normalmap;
+	DetailRule.bSRGB = false;
+	DetailRule.MaterialParameter = TEXT("DetailNormalTexture");
+	TestEqual(TEXT("Longer custom rule wins over _N"), MatchedSuffix(TEXT("T_Rock_Detail_N")), FString(TEXT("_Detail_N")));
+	TestEqual(TEXT("_N still matches without the longer suffix"), MatchedSuffix(TEXT("T_Rock_N")), FString(TEXT("_N")));
+
+	// Unknown: no rule ends the name
+	TestEqual(TEXT("Unknown suffix"), Pipeline->ClassifyTextureName(TEXT("T_Rock_X")), INDEX_NONE);
+	TestEqual(TEXT("Suffix without separator"), Pipeline->ClassifyTextureName(TEXT("T_RockN")), INDEX_NONE);
+	TestEqual(TEXT("Suffix in the middle of the name"), Pipeline->ClassifyTextureName(TEXT("T_Rock_N_Old")), INDEX_NONE);
+	TestEqual(TEXT("Empty name"), Pipeline->ClassifyTextureName(FString()), INDEX_NONE);
+
+	// Stems pair textures with material instances (T_Rock_N <-> MI_Rock)
+	const int32 NormalIndex = Pipeline->ClassifyTextureName(TEXT("T_Rock_N"));
+	TestEqual(TEXT("Texture stem"), Pipeline->GetNameStem(TEXT("T_Rock_N"), NormalIndex), FString(TEXT("rock")));
+	TestEqual(TEXT("Material stem"), Pipeline->GetNameStem(TEXT("MI_Rock"), INDEX_NONE), FString(TEXT("rock")));
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealMCPTextureSuffixExecuteTest, "UnrealMCP.Pipelines.TextureSuffix.Execute",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealMCPTextureSuffixExecuteTest::RunTest(const FString& Parameters)
+{
+	UUnrealMCPTextureSuffixPipeline* Pipeline = NewObject<UUnrealMCPTextureSuffixPipeline>(GetTransientPackage());
+	UInterchangeBaseNodeContainer* Container = NewObject<UInterchangeBaseNodeContainer>(GetTransientPackage());
+
+	auto AddTexture = [Container](const FString& Name) -> UInterchangeTexture2DFactoryNode*
+	{
+		UInterchangeTexture2DFactoryNode* Node = NewObject<UInterchangeTexture2DFactoryNode>(Container);
+		Node->InitializeNode(TEXT("Factory_") + Name, Name, EInterchangeNodeContainerType::FactoryData);
+		Container->AddNode(Node);
+		return Node;
+	};
+
+	// A packed rule that asks for sRGB and default compression must still come out linear and TC_Masks
+	const int32 PackedIndex = Pipeline->ClassifyTextureName(TEXT("T_Rock_ORM"));
+	if (!TestTrue(TEXT("Default rules include _ORM"), Pipeline->SuffixRules.IsValidIndex(PackedIndex)))
+	{
+		return false;
+	}
+	Pipeline->SuffixRules[PackedIndex].bSRGB = true;
+	Pipeline->SuffixRules[PackedIndex].Compression = TC_Default;
+
+	UInterchangeTexture2DFactoryNode* BaseColor = AddTexture(TEXT("T_Rock_D"));
+	UInterchangeTexture2DFactoryNode* Normal = AddTexture(TEXT("T_Rock_N"));
+	UInterchangeTexture2DFactoryNode* Packed = AddTexture(TEXT("T_Rock_ORM"));
+	UInterchangeTexture2DFactoryNode* Unknown = AddTexture(TEXT("T_Rock_X"));
+
+	UInterchangeMaterialInstanceFactoryNode* Material = NewObject<UInterchangeMaterialInstanceFactoryNode>(Container);
+	Material->InitializeNode(TEXT("Factory_MI_Rock"), TEXT("MI_Rock"), EInterchangeNodeContainerType::FactoryData);
+	Container->AddNode(Material);
+
+	// Another pipeline already wired the normal parameter
+	const FString NormalKey = UInterchangeShaderPortsAPI::MakeInputValueKey(TEXT("NormalTexture"));
+	Material->AddStringAttribute(NormalKey, TEXT("Factory_Other"));
+
+	Pipeline->ExecutePipeline(Container, TArray<UInterchangeSourceData*>(), FString());
+
+	// Texture settings
+	bool bSRGB = false;
+	uint8 Compression = 0;
+	TestTrue(TEXT("Base color sRGB set"), BaseColor->GetCustomSRGB(bSRGB) && bSRGB);
+	TestTrue(TEXT("Base color compression set"), BaseColor->GetCustomCompressionSettings(Compression) && Compression == TC_Default);
+	TestTrue(TEXT("Normal sRGB set"), Normal->GetCustomSRGB(bSRGB) && !bSRGB);
+	TestTrue(TEXT("Normal compression set"), Normal->GetCustomCompressionSettings(Compression) && Compression == TC_Normalmap);
+	TestTrue(TEXT("Packed forced linear"), Packed->GetCustomSRGB(bSRGB) && !bSRGB);
+	TestTrue(TEXT("Packed forced to TC_Masks"), Packed->GetCustomCompressionSettings(Compression) && Compression == TC_Masks);
+	TestFalse(TEXT("Unclassified texture left alone"), Unknown->GetCustomSRGB(bSRGB));
+
+	// Material parameter wiring
+	auto WiredTo = [Material](const TCHAR* Parameter) -> FString
+	{
+		FString Uid;
+		Material->GetStringAttribute(UInterchangeShaderPortsAPI::MakeInputValueKey(Parameter), Uid);
+		return Uid;
+	};
+	TestEqual(TEXT("Base color wired"), WiredTo(TEXT("BaseColorTexture")), FString(TEXT("Factory_T_Rock_D")));
+	TestEqual(TEXT("Packed texture wired"), WiredTo(TEXT("PackedTexture")), FString(TEXT("Factory_T_Rock_ORM")));
+	TestEqual(TEXT("Existing parameter kept"), WiredTo(TEXT("NormalTexture")), FString(TEXT("Factory_Other")));
+
+	TArray<FString> Dependencies;
+	Material->GetFactoryDependencies(Dependencies);
+	TestTrue(TEXT("Wired texture is a factory dependency"), Dependencies.Contains(TEXT("Factory_T_Rock_D")));
+	TestFalse(TEXT("Skipped texture is not a dependency"), Dependencies.Contains(TEXT("Factory_T_Rock_N")));
+
+	// bOverrideExistingParameters replaces what another pipeline wired
+	Pipeline->bOverrideExistingParameters = true;
+	Pipeline->ExecutePipeline(Container, TArray<UInterchangeSourceData*>(), FString());
+	TestEqual(TEXT("Existing parameter overridden"), WiredTo(TEXT("NormalTexture")), FString(TEXT("Factory_T_Rock_N")));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
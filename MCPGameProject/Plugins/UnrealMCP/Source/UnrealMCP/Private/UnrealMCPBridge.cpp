@@ -60,6 +60,11 @@
 #include "Commands/UnrealMCPCommonUtils.h"
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPInterchangeCommands.h"
+#include "Commands/UnrealMCPImportCache.h"
+#include "Commands/UnrealMCPCompileQueue.h"
+#include "Commands/UnrealMCPSaveQueue.h"
+#include "Commands/UnrealMCPGraphSearchIndex.h"
+#include "Commands/UnrealMCPBatchTransaction.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -101,6 +106,9 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    // Keep the graph search index current from Blueprint saves even before the first search
+    FUnrealMCPGraphSearchIndex::Get().Start();
+
     // Start the server automatically
     StartServer();
 }
@@ -110,6 +118,7 @@ void UUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     StopServer();
+    FUnrealMCPGraphSearchIndex::Get().Shutdown();
 }
 
 // Start the MCP server
@@ -258,6 +267,8 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
         UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
     }
 
+    // Hash import source files here (server thread) so the game thread only sees memoized content hashes.
+    FUnrealMCPImportCache::Get().PrehashForCommand(CommandType, Params);
 
     // Create a promise to wait for the result
     TPromise<FString> Promise;
@@ -266,6 +277,18 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
     // Queue execution on Game Thread
     AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, McpRequestId, McpTraceId, McpToken, Promise = MoveTemp(Promise)]() mutable
     {
+        // Pin tables built by FindPin live for this request only
+        FUnrealMCPCommonUtils::FPinLookupScope PinLookupScope;
+
+        // Packages dirtied by this request are tracked for save_dirty; "save": "deferred" saves them all at the end
+        FString SaveMode;
+        if (Params.IsValid())
+        {
+            Params->TryGetStringField(TEXT("save"), SaveMode);
+        }
+        const bool bDeferSaves = SaveMode == TEXT("deferred");
+        FUnrealMCPSaveQueue::FCaptureScope SaveCapture(bDeferSaves);
+
         TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
 
         auto SetStructuredError = [&](const FString& Code, const FString& Message, const FString& Details)
@@ -303,6 +326,47 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 return Obj;
             }
 
+            if (InCommandType == TEXT("save_dirty"))
+            {
+                TArray<FString> PackageFilter;
+                const TArray<TSharedPtr<FJsonValue>>* PackagesJson = nullptr;
+                if (InParams.IsValid() && InParams->TryGetArrayField(TEXT("packages"), PackagesJson))
+                {
+                    for (const TSharedPtr<FJsonValue>& V : *PackagesJson)
+                    {
+                        PackageFilter.Add(V->AsString());
+                    }
+                }
+
+                bool bListOnly = false;
+                if (InParams.IsValid())
+                {
+                    InParams->TryGetBoolField(TEXT("list_only"), bListOnly);
+                }
+                if (bListOnly)
+                {
+                    TArray<TSharedPtr<FJsonValue>> Names;
+                    for (UPackage* Package : FUnrealMCPSaveQueue::Get().GetDirtyPackages())
+                    {
+                        Names.Add(MakeShared<FJsonValueString>(Package->GetName()));
+                    }
+                    TSharedPtr<FJsonObject> Obj = MakeShareable(new FJsonObject);
+                    Obj->SetArrayField(TEXT("dirty"), Names);
+                    Obj->SetNumberField(TEXT("count"), Names.Num());
+                    return Obj;
+                }
+                return FUnrealMCPSaveQueue::Get().SaveDirty(PackageFilter);
+            }
+
+            if (InCommandType == TEXT("flush_compiles"))
+            {
+                TArray<TSharedPtr<FJsonValue>> Flushed = FUnrealMCPCompileQueue::Get().Flush();
+                TSharedPtr<FJsonObject> Obj = MakeShareable(new FJsonObject);
+                Obj->SetNumberField(TEXT("compiled"), Flushed.Num());
+                Obj->SetArrayField(TEXT("compiles"), Flushed);
+                return Obj;
+            }
+
             // Editor Commands (including actor manipulation)
             if (InCommandType == TEXT("get_actors_in_level") ||
                 InCommandType == TEXT("find_actors_by_name") ||
@@ -312,6 +376,7 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 InCommandType == TEXT("set_actor_transform") ||
                 InCommandType == TEXT("get_actor_properties") ||
                 InCommandType == TEXT("set_actor_property") ||
+                InCommandType == TEXT("get_objects_properties") ||
                 InCommandType == TEXT("spawn_blueprint_actor") ||
                 InCommandType == TEXT("focus_viewport") ||
                 InCommandType == TEXT("take_screenshot"))
@@ -321,10 +386,14 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
 
             // Blueprint Commands
             if (InCommandType == TEXT("create_blueprint") ||
+                InCommandType == TEXT("create_blueprints_from_template") ||
                 InCommandType == TEXT("add_component_to_blueprint") ||
                 InCommandType == TEXT("set_component_property") ||
+                InCommandType == TEXT("set_component_properties") ||
                 InCommandType == TEXT("set_physics_properties") ||
                 InCommandType == TEXT("compile_blueprint") ||
+                InCommandType == TEXT("compile_blueprints") ||
+                InCommandType == TEXT("get_compile_blueprints_status") ||
                 InCommandType == TEXT("set_blueprint_property") ||
                 InCommandType == TEXT("set_static_mesh_properties") ||
                 InCommandType == TEXT("set_pawn_properties") ||
@@ -341,6 +410,8 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 InCommandType == TEXT("add_blueprint_get_self_component_reference") ||
                 InCommandType == TEXT("add_blueprint_self_reference") ||
                 InCommandType == TEXT("find_blueprint_nodes") ||
+                InCommandType == TEXT("apply_blueprint_graph_patch") ||
+                InCommandType == TEXT("search_blueprint_functions") ||
                 InCommandType == TEXT("add_blueprint_event_node") ||
                 InCommandType == TEXT("add_blueprint_input_action_node") ||
                 InCommandType == TEXT("add_blueprint_function_node") ||
@@ -348,13 +419,16 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 InCommandType == TEXT("add_blueprint_variable") ||
                 // Construction Script operations
                 InCommandType == TEXT("get_construction_script_graph") ||
-                InCommandType == TEXT("add_construction_script_node"))
+                InCommandType == TEXT("add_construction_script_node") ||
+                InCommandType == TEXT("export_blueprint_graph") ||
+                InCommandType == TEXT("search_blueprint_graphs"))
             {
                 return BlueprintNodeCommands->HandleCommand(InCommandType, InParams);
             }
 
             // Project Commands
-            if (InCommandType == TEXT("create_input_mapping"))
+            if (InCommandType == TEXT("create_input_mapping") ||
+                InCommandType == TEXT("create_input_mappings"))
             {
                 return ProjectCommands->HandleCommand(InCommandType, InParams);
             }
@@ -365,6 +439,8 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 InCommandType == TEXT("add_button_to_widget") ||
                 InCommandType == TEXT("bind_widget_event") ||
                 InCommandType == TEXT("set_text_block_binding") ||
+                InCommandType == TEXT("build_widget_tree") ||
+                InCommandType == TEXT("get_widget_tree") ||
                 InCommandType == TEXT("add_widget_to_viewport"))
             {
                 return UMGCommands->HandleCommand(InCommandType, InParams);
@@ -377,6 +453,7 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 InCommandType == TEXT("get_interchange_assets") ||
                 InCommandType == TEXT("reimport_asset") ||
                 InCommandType == TEXT("get_interchange_info") ||
+                InCommandType == TEXT("scan_import_sources") ||
                 InCommandType == TEXT("create_interchange_pipeline_blueprint") ||
                 InCommandType == TEXT("get_interchange_pipelines") ||
                 InCommandType == TEXT("configure_interchange_pipeline") ||
@@ -397,6 +474,22 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                 TEXT(""));
         };
 
+        // Blueprint compiles requested by edit handlers are coalesced and reported here.
+        bool bDeferCompile = false;
+        if (Params.IsValid())
+        {
+            Params->TryGetBoolField(TEXT("defer_compile"), bDeferCompile);
+        }
+        TArray<TSharedPtr<FJsonValue>> CompileResults;
+        auto FlushCompilesBefore = [&](const FString& InCommandType)
+        {
+            // Anything that is not a deferrable edit may observe the generated class, so compile pending edits first.
+            if (InCommandType != TEXT("flush_compiles") && !FUnrealMCPCompileQueue::IsDeferrableCommand(InCommandType))
+            {
+                CompileResults.Append(FUnrealMCPCompileQueue::Get().Flush());
+            }
+        };
+
         auto ExtractError = [&](const TSharedPtr<FJsonObject>& ResultObj, FString& OutMsg, FString& OutCode, FString& OutDetails)
         {
             OutMsg = ResultObj.IsValid() && ResultObj->HasField(TEXT("error")) ? ResultObj->GetStringField(TEXT("error")) : TEXT("Unknown error");
@@ -448,6 +541,14 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                     InType.StartsWith(TEXT("spawn_")) ||
                     InType.StartsWith(TEXT("import_")) ||
                     InType.StartsWith(TEXT("reimport_")) ||
+                    InType.StartsWith(TEXT("apply_")) ||
+                    InType.StartsWith(TEXT("save_")) ||
+                    InType.StartsWith(TEXT("build_")) ||
+                    InType.StartsWith(TEXT("bind_")) ||
+                    InType.StartsWith(TEXT("connect_")) ||
+                    InType.StartsWith(TEXT("configure_")) ||
+                    InType.StartsWith(TEXT("compile_")) ||
+                    (InType == TEXT("flush_compiles")) ||
                     (InType == TEXT("batch"));
             };
             if (bReadOnly && IsWriteCommand(CommandType))
@@ -470,17 +571,36 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                     bStopOnError = Params->GetBoolField(TEXT("stop_on_error"));
                 }
 
+                // "single": one undo transaction for the whole batch, with Modify and Blueprint-modified
+                // notifications coalesced per object; "per_command" (default) leaves each handler on its own.
+                FString TransactionMode = TEXT("per_command");
+                if (Params.IsValid())
+                {
+                    Params->TryGetStringField(TEXT("transaction"), TransactionMode);
+                }
+                const bool bSingleTransaction = TransactionMode == TEXT("single");
+
                 const TArray<TSharedPtr<FJsonValue>>* CommandsArray = nullptr;
                 if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), CommandsArray) || !CommandsArray)
                 {
                     SetStructuredError(TEXT("ERR_BAD_REQUEST"), TEXT("Missing 'commands' array"), TEXT("batch expects params.commands: [{type, params}]"));
                 }
+                else if (!bSingleTransaction && TransactionMode != TEXT("per_command"))
+                {
+                    SetStructuredError(TEXT("ERR_BAD_REQUEST"), FString::Printf(TEXT("Unknown transaction mode: %s"), *TransactionMode), TEXT("transaction: \"single\" | \"per_command\""));
+                }
                 else
                 {
                     TArray<TSharedPtr<FJsonValue>> Items;
                     int32 OkCount = 0;
                     int32 ErrCount = 0;
 
+                    TOptional<FUnrealMCPBatchTransaction::FScope> BatchTransaction;
+                    if (bSingleTransaction)
+                    {
+                        BatchTransaction.Emplace(FText::Format(FText::FromString(TEXT("UnrealMCP: Batch ({0} commands)")), CommandsArray->Num()));
+                    }
+
                     for (int32 Index = 0; Index < CommandsArray->Num(); ++Index)
                     {
                         const TSharedPtr<FJsonValue>& V = (*CommandsArray)[Index];
@@ -510,6 +630,7 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                             }
                         }
 
+                        FlushCompilesBefore(SubType);
                         TSharedPtr<FJsonObject> SubResult = Dispatch(SubType, SubParams);
                         bool bSubSuccess = true;
                         if (SubResult.IsValid() && SubResult->HasField(TEXT("success")))
@@ -553,11 +674,19 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                         Items.Add(MakeShareable(new FJsonValueObject(Item)));
                     }
 
+                    // Closing the scope runs the coalesced Blueprint notifications and commits the undo step
+                    BatchTransaction.Reset();
+
                     TSharedPtr<FJsonObject> Summary = MakeShareable(new FJsonObject);
                     Summary->SetNumberField(TEXT("total"), CommandsArray->Num());
                     Summary->SetNumberField(TEXT("ok"), OkCount);
                     Summary->SetNumberField(TEXT("error"), ErrCount);
                     Summary->SetBoolField(TEXT("stop_on_error"), bStopOnError);
+                    Summary->SetStringField(TEXT("transaction"), TransactionMode);
+                    if (bSingleTransaction)
+                    {
+                        Summary->SetObjectField(TEXT("coalesced"), FUnrealMCPBatchTransaction::Get().GetStats());
+                    }
 
                     TSharedPtr<FJsonObject> BatchResult = MakeShareable(new FJsonObject);
                     BatchResult->SetArrayField(TEXT("items"), Items);
@@ -579,6 +708,10 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             }
             else
             {
+                if (!bDeferCompile)
+                {
+                    FlushCompilesBefore(CommandType);
+                }
                 TSharedPtr<FJsonObject> ResultJson = Dispatch(CommandType, Params);
 
                 bool bSuccess = true;
@@ -609,6 +742,36 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
             SetStructuredError(TEXT("ERR_EXCEPTION"), UTF8_TO_TCHAR(e.what()), TEXT("std::exception"));
         }
 
+        // One compile per edited Blueprint for the whole request/batch unless the caller deferred it.
+        if (!bDeferCompile)
+        {
+            CompileResults.Append(FUnrealMCPCompileQueue::Get().Flush());
+        }
+        if (CompileResults.Num() > 0)
+        {
+            ResponseJson->SetArrayField(TEXT("compiles"), CompileResults);
+        }
+        if (FUnrealMCPCompileQueue::Get().NumPending() > 0)
+        {
+            ResponseJson->SetNumberField(TEXT("pending_compiles"), FUnrealMCPCompileQueue::Get().NumPending());
+        }
+
+        // Compiles the idle tick ran between requests; their errors would otherwise only reach the log.
+        TArray<TSharedPtr<FJsonValue>> IdleCompiles = FUnrealMCPCompileQueue::Get().TakeIdleFlushResults();
+        if (IdleCompiles.Num() > 0)
+        {
+            ResponseJson->SetArrayField(TEXT("idle_compiles"), IdleCompiles);
+        }
+
+        // Deferred saves run after the compiles above so compiled classes are written too.
+        if (bDeferSaves)
+        {
+            ResponseJson->SetObjectField(TEXT("saves"), FUnrealMCPSaveQueue::Get().SaveDirty());
+        }
+
+        // Persist import cache records once per request (a batch may record thousands).
+        FUnrealMCPImportCache::Get().Flush();
+
         FString ResultString;
         TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
         FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
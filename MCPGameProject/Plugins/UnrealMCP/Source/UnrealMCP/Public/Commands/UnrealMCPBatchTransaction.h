@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class FScopedTransaction;
+
+/**
+ * One undo transaction for a whole batch ("transaction": "single" on the batch command).
+ *
+ * While a scope is open, handlers' FEditScopes open nothing, so the batch is a single undo step. Edits routed through Modify are recorded once per object, and MarkBlueprintModified only
+ * dirties the package; the full FBlueprintEditorUtils::MarkBlueprintAsModified (status, cached
+ * dependencies, search data) runs once per Blueprint when the scope closes, or before queued compiles run.
+ * Outside a scope both calls go straight through.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPBatchTransaction
+{
+public:
+	struct UNREALMCP_API FScope
+	{
+		explicit FScope(const FText& Description);
+		~FScope();
+
+	private:
+		bool bOwner;
+	};
+
+	/**
+	 * A handler's own undo transaction. Outside a batch this is an FScopedTransaction; inside one nothing is
+	 * opened and Cancel() does nothing, since cancelling would throw away the whole batch. A handler that
+	 * fails inside a batch must revert its own edits.
+	 */
+	struct UNREALMCP_API FEditScope
+	{
+		explicit FEditScope(const FText& Description);
+		~FEditScope();
+
+		/** Drop this handler's transaction. No-op inside a batch. */
+		void Cancel();
+
+	private:
+		TUniquePtr<FScopedTransaction> Transaction;
+	};
+
+	static FUnrealMCPBatchTransaction& Get();
+
+	~FUnrealMCPBatchTransaction();
+
+	bool IsActive() const { return Transaction.IsValid(); }
+
+	/** Object->Modify(), skipped when this batch already recorded the object. */
+	void Modify(UObject* Object);
+
+	/** FBlueprintEditorUtils::MarkBlueprintAsModified now, or once per Blueprint when the batch closes. */
+	void MarkBlueprintModified(UBlueprint* Blueprint);
+
+	/** Run deferred Blueprint notifications now. */
+	void FlushModified();
+
+	/** Counters for the current (or last) batch scope. */
+	TSharedPtr<FJsonObject> GetStats() const;
+
+private:
+	FUnrealMCPBatchTransaction() = default;
+
+	void Begin(const FText& Description);
+	void End();
+
+	TUniquePtr<FScopedTransaction> Transaction;
+	TSet<TObjectKey<UObject>> Modified;
+	TArray<TWeakObjectPtr<UBlueprint>> PendingBlueprints;
+	TSet<TObjectKey<UBlueprint>> PendingBlueprintKeys;
+
+	int32 NumModifies = 0;
+	int32 NumModifiesSkipped = 0;
+	int32 NumBlueprintMarks = 0;
+	int32 NumBlueprintsNotified = 0;
+};
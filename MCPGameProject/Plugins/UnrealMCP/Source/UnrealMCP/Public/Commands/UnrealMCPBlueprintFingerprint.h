@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+
+/**
+ * Structural fingerprint of a Blueprint: a stable xxHash64 over its parent class, member variables,
+ * SCS nodes, graphs, nodes, pins, links and CDO values that differ from the parent.
+ *
+ * Node positions and other cosmetic state are excluded, so moving a node does not invalidate a compile.
+ * The fingerprint of the last successful compile is remembered per Blueprint; compile commands skip
+ * the compile (and save) when it still matches, unless the caller passes force.
+ *
+ * ComputeGraph fingerprints a single graph for export caching: it includes node positions and comments but
+ * not node titles, which are slow to render.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPBlueprintFingerprint
+{
+public:
+	static FUnrealMCPBlueprintFingerprint& Get();
+
+	/** Hash the Blueprint's current structure. Hex string, 16 chars. */
+	static FString Compute(const UBlueprint* Blueprint);
+
+	/** Hash one graph's nodes, pins, links and layout. Hex string, 16 chars. */
+	static FString ComputeGraph(const UEdGraph* Graph);
+
+	/** True when Fingerprint matches the last successful compile and the Blueprint is still up to date. */
+	bool IsCompileUpToDate(const UBlueprint* Blueprint, const FString& Fingerprint) const;
+
+	/** Remember Fingerprint after a compile; failed compiles (BS_Error) are forgotten. */
+	void RecordCompile(const UBlueprint* Blueprint, const FString& Fingerprint);
+
+private:
+	FUnrealMCPBlueprintFingerprint() = default;
+
+	TMap<FString, FString> LastCompiled;
+};
@@ -24,10 +24,22 @@ private:
     TSharedPtr<FJsonObject> HandleAddBlueprintInputActionNode(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintSelfReference(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindBlueprintNodes(const TSharedPtr<FJsonObject>& Params);
+
+    // Declarative multi-node/multi-link edit applied in one transaction
+    TSharedPtr<FJsonObject> HandleApplyBlueprintGraphPatch(const TSharedPtr<FJsonObject>& Params);
+
+    // Callable-function autocomplete backed by FUnrealMCPFunctionIndex
+    TSharedPtr<FJsonObject> HandleSearchBlueprintFunctions(const TSharedPtr<FJsonObject>& Params);
     
     // Construction Script graph operations
     TSharedPtr<FJsonObject> HandleGetConstructionScriptGraph(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddConstructionScriptNode(const TSharedPtr<FJsonObject>& Params);
+
+    // Every graph as columnar node/pin/edge tables, paged by graph and fingerprinted for client caching
+    TSharedPtr<FJsonObject> HandleExportBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Project-wide function/variable/event/node-class search backed by FUnrealMCPGraphSearchIndex
+    TSharedPtr<FJsonObject> HandleSearchBlueprintGraphs(const TSharedPtr<FJsonObject>& Params);
     
     // Helper to find Construction Script graph
     UEdGraph* FindConstructionScriptGraph(UBlueprint* Blueprint) const;
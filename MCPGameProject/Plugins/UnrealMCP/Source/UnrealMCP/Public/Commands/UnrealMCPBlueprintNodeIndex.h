@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * Cached NodeGuid -> node index per Blueprint, covering every graph (Ubergraph pages, functions,
+ * macros, construction script, delegate signatures).
+ *
+ * Built on first lookup and kept current from the graphs' OnGraphChanged delegates (node adds and
+ * removes update in place) and the Blueprint's OnChanged (full rebuild on next lookup). A lookup
+ * that misses or hits a stale entry rebuilds once, so the index never returns a wrong node.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPBlueprintNodeIndex
+{
+public:
+	static FUnrealMCPBlueprintNodeIndex& Get();
+
+	/** Find a node by GUID in any graph of the Blueprint. */
+	UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+	/** Parse a node id string and find it; nullptr for malformed ids. */
+	UEdGraphNode* FindNode(UBlueprint* Blueprint, const FString& NodeId);
+
+	/** Drop the cached index for a Blueprint; rebuilt on next lookup. */
+	void Invalidate(UBlueprint* Blueprint);
+
+private:
+	FUnrealMCPBlueprintNodeIndex() = default;
+
+	struct FGraphBinding
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		FDelegateHandle Handle;
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+		TArray<FGraphBinding> Graphs;
+		FDelegateHandle BlueprintChangedHandle;
+		bool bDirty = true;
+	};
+
+	FEntry& FindOrAddEntry(UBlueprint* Blueprint);
+	void Rebuild(FEntry& Entry);
+	void Unbind(FEntry& Entry);
+	void OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UBlueprint> BlueprintKey);
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<TObjectKey<UBlueprint>, FEntry> Entries;
+};
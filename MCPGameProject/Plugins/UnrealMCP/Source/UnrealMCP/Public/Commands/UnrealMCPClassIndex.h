@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+
+struct FAssetData;
+
+/**
+ * Class lookup by name for the command handlers (parent classes, component types, call targets).
+ *
+ * Native classes are indexed by short name, by name with their U/A prefix, and by /Script/Module.Class path.
+ * Blueprint classes come from the asset registry's GeneratedClassPath tag and are indexed by asset name (with
+ * and without _C), package path and object path, so they resolve without loading every Blueprint; the class is
+ * loaded when a lookup returns it. Several classes may share a name; lookups report all of them instead of
+ * guessing.
+ *
+ * Built on first use. Module loads index only the classes not seen yet, asset registry events keep the
+ * Blueprint entries current, and hot reload drops everything. Names that resolved to nothing are remembered
+ * until the index grows, so repeated misses do not go back to LoadObject.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPClassIndex
+{
+public:
+	static FUnrealMCPClassIndex& Get();
+
+	/**
+	 * Resolve a class by name or path (case-insensitive). With BaseClass, only subclasses of it match.
+	 * Returns nullptr when nothing matches or when the name is ambiguous; OutCandidates receives the path
+	 * of every matching class either way.
+	 */
+	UClass* FindClass(const FString& Name, const UClass* BaseClass = nullptr, TArray<FString>* OutCandidates = nullptr);
+
+	/** Drop everything; rebuilt on next lookup. */
+	void Invalidate();
+
+private:
+	struct FEntry
+	{
+		/** Always set for native classes; for Blueprint classes once loaded. */
+		TWeakObjectPtr<UClass> Class;
+		FSoftClassPath Path;
+		/** Blueprint classes: nearest native ancestor, so BaseClass checks need not load the Blueprint. */
+		FTopLevelAssetPath NativeParent;
+		FName PackageName;
+		TArray<FString, TInlineAllocator<6>> Keys;
+		bool bBlueprint = false;
+	};
+
+	FUnrealMCPClassIndex() = default;
+
+	void EnsureBuilt();
+	void IndexNewClasses();
+	void IndexClass(UClass* Class);
+	void IndexBlueprintAsset(const FAssetData& AssetData);
+	void RemoveBlueprintPackage(FName PackageName);
+	int32 AddEntry(FEntry&& Entry);
+	UClass* LoadEntry(FEntry& Entry);
+	bool MatchesBase(FEntry& Entry, const UClass* BaseClass);
+
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void OnReloadComplete(EReloadCompleteReason Reason);
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TArray<FEntry> Entries;
+	TMultiMap<FString, int32> ByKey;
+	TSet<TObjectKey<UClass>> IndexedClasses;
+	TMap<FName, int32> BlueprintsByPackage;
+	TSet<FString> Misses;
+
+	bool bBuilt = false;
+	bool bNeedsScan = false;
+	bool bDelegatesBound = false;
+};
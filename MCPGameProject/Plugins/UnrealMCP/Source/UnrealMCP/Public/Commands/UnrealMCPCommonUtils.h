@@ -79,6 +79,16 @@ public:
     static bool ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode* SourceNode, const FString& SourcePinName, 
                                 UEdGraphNode* TargetNode, const FString& TargetPinName);
     static UEdGraphPin* FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction = EGPD_MAX);
+
+    /**
+     * While alive, FindPin keeps a per-node pin table (name, lowercase name, pin GUID, display name) so repeated
+     * lookups on the same node are hash hits. The bridge opens one per request; nested scopes share the outer table.
+     */
+    struct UNREALMCP_API FPinLookupScope
+    {
+        FPinLookupScope();
+        ~FPinLookupScope();
+    };
     static UK2Node_Event* FindExistingEventNode(UEdGraph* Graph, const FString& EventName);
 
     // Property utilities
@@ -97,10 +107,17 @@ public:
     // Export properties to JSON object
     // - If PropertyNames is empty, exports all reflected properties (excluding transient).
     // - If bOnlyEditable is true, exports only properties that are editable in editor (EditAnywhere/EditDefaultsOnly/etc.).
+    // - If Baseline is set (usually Object->GetArchetype()), properties identical to the baseline are omitted.
     static bool ExportObjectProperties(UObject* Object,
                                       const TArray<FString>& PropertyNames,
                                       TSharedPtr<FJsonObject>& OutProps,
                                       FString& OutErrorMessage,
-                                      bool bOnlyEditable = true);
+                                      bool bOnlyEditable = true,
+                                      UObject* Baseline = nullptr);
+
+    // Delta export shared by the property getters: when Params has non_default_only, writes the properties that
+    // differ from Object's archetype into ResultObj ("properties", "baseline"); include_hash adds "state_hash".
+    // Returns true when non_default_only was requested.
+    static bool AddNonDefaultProperties(UObject* Object, const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonObject>& ResultObj);
 };
  
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+
+class UBlueprint;
+
+/**
+ * Coalesces Blueprint compiles across edits.
+ *
+ * Edit handlers call MarkDirty instead of compiling. The bridge flushes once at the end of each
+ * request (or batch), so N edits to one Blueprint cost one compile. Requests sent with
+ * "defer_compile": true leave their Blueprints pending until a later non-deferred request,
+ * an explicit flush_compiles, or an idle tick. Idle-tick results are held until the next
+ * response reports them as "idle_compiles".
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPCompileQueue
+{
+public:
+	enum class ECompileLevel : uint8
+	{
+		/** Graph changed; refresh the skeleton class (what MarkBlueprintAsStructurallyModified did per edit). */
+		Skeleton,
+		/** Components/defaults changed; full compile with diagnostics. */
+		Full
+	};
+
+	static FUnrealMCPCompileQueue& Get();
+
+	/** Record an edit. The Blueprint is marked modified now and compiled at the next flush. */
+	void MarkDirty(UBlueprint* Blueprint, ECompileLevel Level = ECompileLevel::Full);
+
+	/** Drop a pending compile (the caller compiled the Blueprint itself). */
+	void Remove(UBlueprint* Blueprint);
+
+	int32 NumPending() const { return Pending.Num(); }
+
+	/** Compile every pending Blueprint once. Returns one result object per Blueprint. */
+	TArray<TSharedPtr<FJsonValue>> Flush();
+
+	/** Results of compiles run by the idle tick since the last call (oldest dropped past a small cap). */
+	TArray<TSharedPtr<FJsonValue>> TakeIdleFlushResults();
+
+	/** Edit commands whose compile may be deferred to the end of a batch; anything else flushes first. */
+	static bool IsDeferrableCommand(const FString& CommandType);
+
+	/**
+	 * Compile many Blueprints through FBlueprintCompilationManager, ChunkSize at a time, so each chunk
+	 * shares reinstancing and dependency ordering. Chunks run one per editor tick; returns a job id
+	 * for GetBatchCompileStatus. Blueprints whose fingerprint matches their last compile are skipped unless bForce.
+	 */
+	FString StartBatchCompile(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce = false);
+
+	/** Same as StartBatchCompile but runs every chunk now and returns the final status. */
+	TSharedPtr<FJsonObject> RunBatchCompile(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce = false);
+
+	/** Progress and per-Blueprint results of a batch compile job, or nullptr for an unknown id. */
+	TSharedPtr<FJsonObject> GetBatchCompileStatus(const FString& JobId) const;
+
+private:
+	FUnrealMCPCompileQueue() = default;
+
+	struct FPendingCompile
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		ECompileLevel Level = ECompileLevel::Skeleton;
+		int32 EditCount = 0;
+	};
+
+	struct FBatchCompileJob
+	{
+		FString Id;
+		TArray<TWeakObjectPtr<UBlueprint>> Blueprints;
+		int32 ChunkSize = 16;
+		int32 NextIndex = 0;
+		bool bForce = false;
+		TArray<TSharedPtr<FJsonValue>> Items;
+		TArray<TSharedPtr<FJsonValue>> Chunks;
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+
+		bool IsDone() const { return NextIndex >= Blueprints.Num(); }
+	};
+
+	void ScheduleIdleFlush();
+	TSharedPtr<FBatchCompileJob> MakeBatchJob(const TArray<UBlueprint*>& Blueprints, int32 ChunkSize, bool bForce);
+	void CompileNextChunk(FBatchCompileJob& Job);
+	static TSharedPtr<FJsonObject> MakeBatchStatus(const FBatchCompileJob& Job);
+
+	TArray<FPendingCompile> Pending;
+	TArray<TSharedPtr<FJsonValue>> IdleFlushResults;
+	TArray<TSharedPtr<FBatchCompileJob>> BatchJobs;
+	FTSTicker::FDelegateHandle BatchTickHandle;
+	FTSTicker::FDelegateHandle IdleFlushHandle;
+	double LastMarkTime = 0.0;
+};
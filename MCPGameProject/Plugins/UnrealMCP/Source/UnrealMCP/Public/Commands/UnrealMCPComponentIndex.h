@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class USCS_Node;
+class USimpleConstructionScript;
+
+/**
+ * Per-Blueprint lookup of Simple Construction Script nodes by component variable name, for the component
+ * property commands.
+ *
+ * A Blueprint's SCS is indexed on first lookup and marked for rebuild by its OnChanged delegate (adding,
+ * removing or renaming components in the editor marks the Blueprint structurally modified). Nodes added from
+ * code without that notification change the SCS node count, which also forces a rebuild; a miss, or a hit whose
+ * node was renamed or destroyed, rebuilds once and retries.
+ *
+ * Also caches the sorted property list of native component classes used in "property not found" diagnostics.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPComponentIndex
+{
+public:
+	static FUnrealMCPComponentIndex& Get();
+
+	/** SCS node whose component variable is VariableName, or null. */
+	USCS_Node* FindNode(UBlueprint* Blueprint, FName VariableName);
+
+	/** Variable names of every component in the Blueprint's SCS, in SCS order. */
+	void GetNodeNames(UBlueprint* Blueprint, TArray<FName>& OutNames);
+
+	/** "Name (CppType)" for every property of Class, sorted by name. */
+	const TArray<FString>& GetPropertyDescriptions(const UClass* Class);
+
+	/** Drop the cached node index for a Blueprint; rebuilt on next lookup. */
+	void Invalidate(UBlueprint* Blueprint);
+
+private:
+	FUnrealMCPComponentIndex() = default;
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TWeakObjectPtr<USimpleConstructionScript> SCS;
+		TMap<FName, TWeakObjectPtr<USCS_Node>> Nodes;
+		TArray<FName> Order;
+		int32 NumNodes = 0;
+		FDelegateHandle BlueprintChangedHandle;
+		bool bDirty = true;
+	};
+
+	FEntry* FindOrBuildEntry(UBlueprint* Blueprint);
+	void Rebuild(FEntry& Entry);
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<TObjectKey<UBlueprint>, FEntry> Entries;
+	TMap<TObjectKey<UClass>, TArray<FString>> PropertyDescriptions;
+	/** Returned for non-native classes, whose layout can change on recompile. */
+	TArray<FString> Scratch;
+};
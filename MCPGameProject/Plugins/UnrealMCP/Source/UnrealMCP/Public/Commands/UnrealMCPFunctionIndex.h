@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+class UFunction;
+
+/**
+ * Index of Blueprint-callable functions on loaded native classes, for O(1) name resolution in the
+ * node handlers and prefix search for autocomplete.
+ *
+ * Keys are lowercase function names and lowercase display names. Blueprint-generated classes are not
+ * indexed; callers look those up on the Blueprint directly. "target" class names are resolved with
+ * FUnrealMCPClassIndex.
+ *
+ * Built on first use. Module loads add only the classes not yet indexed; hot reload drops the whole
+ * index.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPFunctionIndex
+{
+public:
+	struct FCandidate
+	{
+		TWeakObjectPtr<UFunction> Function;
+		TWeakObjectPtr<UClass> OwnerClass;
+		FString Name;
+		FString DisplayName;
+		FString Category;
+		bool bPure = false;
+		bool bStatic = false;
+	};
+
+	static FUnrealMCPFunctionIndex& Get();
+
+	/**
+	 * Resolve a callable function by name or display name (case-insensitive).
+	 * With TargetClass, only functions callable on that class (own or inherited) are considered.
+	 * OutCandidates receives every match so callers can report ambiguity.
+	 */
+	void FindFunctions(const FString& FunctionName, UClass* TargetClass, TArray<const FCandidate*>& OutCandidates);
+
+	/** Prefix (or substring) search over function and display names, sorted by name. */
+	void Search(const FString& Query, UClass* TargetClass, bool bContains, int32 MaxResults, TArray<const FCandidate*>& OutCandidates);
+
+	/** JSON description of a candidate for command responses. */
+	static TSharedPtr<FJsonObject> CandidateToJson(const FCandidate& Candidate);
+
+	/** Drop everything; rebuilt on next lookup. */
+	void Invalidate();
+
+private:
+	FUnrealMCPFunctionIndex() = default;
+
+	void EnsureBuilt();
+	void IndexNewClasses();
+	void IndexClass(UClass* Class);
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void OnReloadComplete(EReloadCompleteReason Reason);
+
+	TArray<FCandidate> Candidates;
+	TMultiMap<FString, int32> ByKey;
+	TSet<TObjectKey<UClass>> IndexedClasses;
+
+	/** Lowercase keys sorted for prefix search; rebuilt lazily after new classes are indexed. */
+	TArray<TPair<FString, int32>> SortedKeys;
+	bool bSortedKeysDirty = true;
+
+	bool bBuilt = false;
+	bool bNeedsScan = false;
+	bool bDelegatesBound = false;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/SoftObjectPath.h"
+
+class UBlueprint;
+class UPackage;
+struct FAssetData;
+
+/**
+ * Project-wide index of Blueprint graph facts for search_blueprint_graphs: one row per graph node with its
+ * class, its graph, and the function, variable, event or macro it references.
+ *
+ * Rows are extracted from loaded Blueprints and persisted per package in
+ * <Project>/Saved/UnrealMCP/GraphSearchIndex.json along with the package file's size and mtime. The first
+ * search compares every project Blueprint in the asset registry against those stamps and queues new or changed
+ * packages; the queue is crawled on the game thread in time-sliced ticks (each Blueprint is loaded once), so
+ * later sessions only revisit what changed. Saving a Blueprint re-extracts it from memory; asset registry
+ * removes and renames drop or requeue entries.
+ *
+ * Results reflect each Blueprint's last save. Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPGraphSearchIndex
+{
+public:
+	enum class EFactKind : uint8
+	{
+		Node,
+		Function,
+		Variable,
+		Event,
+		Macro
+	};
+
+	enum class EMatch : uint8
+	{
+		Exact,
+		Prefix,
+		Contains
+	};
+
+	struct FFact
+	{
+		FName Graph;
+		FName NodeClass;
+		FName Member;
+		/** Class that declares Member (function owner, variable scope, overridden event's class). */
+		FName Owner;
+		FGuid NodeGuid;
+		EFactKind Kind = EFactKind::Node;
+	};
+
+	struct FMatch
+	{
+		FName Package;
+		const FFact* Fact = nullptr;
+	};
+
+	struct FQuery
+	{
+		/** Kind to match Name against; unset matches members of any kind and node classes. */
+		TOptional<EFactKind> Kind;
+		FString Name;
+		FString Owner;
+		FString PathPrefix;
+		EMatch Match = EMatch::Exact;
+		/** 0 = no limit. */
+		int32 Limit = 100;
+	};
+
+	static FUnrealMCPGraphSearchIndex& Get();
+
+	/** "node", "function", "variable", "event", "macro"; ParseKind also takes "node_class" for Node. */
+	static const TCHAR* GetKindName(EFactKind Kind);
+	static bool ParseKind(const FString& Name, EFactKind& OutKind);
+
+	/** Listen for Blueprint saves and asset registry changes. Cheap; the index itself loads on first use. */
+	void Start();
+
+	/** Stop listening and write pending changes. */
+	void Shutdown();
+
+	/**
+	 * Matches for Query, at most Query.Limit of them (sorted by package); returns the total number of matches.
+	 * The first call also queues every new or changed Blueprint for the background crawl.
+	 */
+	int32 Search(const FQuery& Query, TArray<FMatch>& OutMatches);
+
+	/** Crawl everything still queued now, on this call. */
+	void FinishCrawl();
+
+	/** Forget every row and queue every project Blueprint again. */
+	void Rebuild();
+
+	int32 NumIndexed() const { return Packages.Num(); }
+	int32 NumPending() const { return PendingPackages.Num(); }
+
+	/** Write pending changes to disk. Cheap when nothing changed. */
+	void Flush();
+
+private:
+	struct FPackageEntry
+	{
+		int64 FileSize = -1;
+		FDateTime ModifiedTime;
+		/** Saved this session; the file stamp is read at the next flush, after async writes land. */
+		bool bStampPending = false;
+		TArray<FFact> Facts;
+	};
+
+	struct FRowRef
+	{
+		FName Package;
+		int32 Row = INDEX_NONE;
+	};
+
+	FUnrealMCPGraphSearchIndex() = default;
+
+	static void ExtractFacts(const UBlueprint* Blueprint, TArray<FFact>& OutFacts);
+	static bool GetPackageFilename(FName PackageName, FString& OutFilename);
+	static bool IsProjectPackage(FName PackageName);
+
+	void EnsureLoaded();
+	void EnsureScanned();
+	void Enqueue(const FSoftObjectPath& AssetPath);
+	void CrawlOne(const FSoftObjectPath& AssetPath);
+	void Remove(FName PackageName);
+	void MarkChanged();
+	void EnsureLookup();
+	void ScheduleTick();
+	bool Tick(float DeltaTime);
+	FString GetIndexFilePath() const;
+
+	void OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TMap<FName, FPackageEntry> Packages;
+	TMap<FName, TArray<FRowRef>> ByMember;
+	TMap<FName, TArray<FRowRef>> ByNodeClass;
+
+	TArray<FSoftObjectPath> Pending;
+	TSet<FName> PendingPackages;
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle PackageSavedHandle;
+	double LastChangeTime = 0.0;
+
+	bool bStarted = false;
+	bool bLoaded = false;
+	bool bScanned = false;
+	bool bLookupDirty = true;
+	bool bDiskDirty = false;
+};
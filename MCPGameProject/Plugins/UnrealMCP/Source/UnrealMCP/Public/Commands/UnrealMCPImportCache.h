@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Persistent content-hash cache for Interchange source files.
+ *
+ * Maps (absolute source path, destination asset) to the content hash, size, mtime and settings
+ * hash observed when that asset was last imported from that source. Keying by asset means two
+ * assets imported from one file are tracked independently. import_model / reimport_asset consult
+ * it to skip work when nothing changed.
+ *
+ * Content hashes are xxHash64 over streamed reads and are memoized per (size, mtime),
+ * so a touched-but-identical file is hashed once. The bridge pre-warms hashes on the
+ * server thread (PrehashForCommand) so game-thread handlers only see memoized results.
+ *
+ * Stored as JSON in <Project>/Saved/UnrealMCP/ImportCache.json. All methods are thread-safe.
+ */
+class UNREALMCP_API FUnrealMCPImportCache
+{
+public:
+	static FUnrealMCPImportCache& Get();
+
+	/** Hash the file contents, reusing the memoized hash when size and mtime are unchanged. */
+	bool GetContentHash(const FString& SourcePath, FString& OutHash);
+
+	/** Hash every source file referenced by a command (or batch of commands) in parallel. Must not be called on the game thread. */
+	void PrehashForCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	/** Stable hash of an import settings object (field order independent). */
+	static FString HashSettings(const TSharedPtr<FJsonObject>& Settings);
+
+	/**
+	 * Check whether AssetPath is up to date with SourcePath: the source is unchanged since AssetPath was last
+	 * recorded as imported from it, with the same SettingsHash. A record (or caller) without a settings hash
+	 * never matches.
+	 * OutReason is a short machine-friendly token (no_cache_record, settings_unknown, size_changed,
+	 * settings_changed, content_changed, source_missing, unchanged_stat, content_unchanged).
+	 */
+	bool IsUpToDate(const FString& SourcePath, const FString& AssetPath, const FString& SettingsHash, FString& OutReason);
+
+	/** Record that AssetPath was imported from SourcePath with SettingsHash (must not be empty). */
+	void RecordImport(const FString& SourcePath, const FString& AssetPath, const FString& SettingsHash);
+
+	/** Reverse lookup: the source file an asset was last imported from. */
+	bool FindSourceForAsset(const FString& AssetPath, FString& OutSourcePath);
+
+	/** Write pending changes to disk. Cheap when nothing changed. */
+	void Flush();
+
+private:
+	FUnrealMCPImportCache() = default;
+
+	struct FRecord
+	{
+		FString SourcePath;
+		FString AssetPath;
+		FString ContentHash;
+		int64 FileSize = -1;
+		FDateTime ModifiedTime;
+		FString SettingsHash;
+		FDateTime ImportTime;
+	};
+
+	struct FHashMemo
+	{
+		int64 FileSize = -1;
+		FDateTime ModifiedTime;
+		FString Hash;
+	};
+
+	static FString NormalizeSourcePath(const FString& SourcePath);
+	static FString NormalizeAssetPath(const FString& AssetPath);
+	static FString MakeRecordKey(const FString& FullSourcePath, const FString& NormalizedAssetPath);
+	static bool HashFileContents(const FString& FullPath, FString& OutHash);
+	void EnsureLoadedLocked();
+	FString GetCacheFilePath() const;
+	void CollectSourcePaths(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<FString>& OutPaths, int32 Depth);
+
+	FCriticalSection Lock;
+	/** Keyed by MakeRecordKey(source, asset). */
+	TMap<FString, FRecord> Records;
+	TMap<FString, FString> AssetToSource;
+	TMap<FString, FHashMemo> HashMemo;
+	bool bLoaded = false;
+	bool bDirty = false;
+};
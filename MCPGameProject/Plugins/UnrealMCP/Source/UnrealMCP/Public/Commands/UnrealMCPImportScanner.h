@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Summary of an Interchange source file gathered without importing it.
+ * Counts are best-effort; formats that are not parsed report only size and format.
+ */
+struct UNREALMCP_API FUnrealMCPImportScanResult
+{
+	FString FilePath;
+	FString Format;
+	int64 FileSize = 0;
+
+	/** True when the format-specific parser ran to completion. */
+	bool bParsed = false;
+	FString Error;
+
+	/** Container details (e.g. "binary 7400", "ascii", "glb 2.0"). */
+	FString FormatDetail;
+
+	int32 MeshCount = 0;
+	int32 MaterialCount = 0;
+	int32 TextureCount = 0;
+	int64 VertexCount = 0;
+	int64 EmbeddedTextureBytes = 0;
+	TArray<FString> ExternalFiles;
+	TArray<FString> MissingExternalFiles;
+
+	TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Header-level scanner for glTF/GLB, OBJ/MTL, FBX (binary and ASCII) and PLY.
+ * Reads only what it needs (GLB JSON chunk, FBX node headers, OBJ line stream) and never creates UObjects,
+ * so it is safe to run on worker threads.
+ */
+class UNREALMCP_API FUnrealMCPImportScanner
+{
+public:
+	/** Scan a single file. Thread-safe. */
+	static FUnrealMCPImportScanResult ScanFile(const FString& FilePath);
+
+	/** Scan many files in parallel (ParallelFor); results keep the input order. */
+	static TArray<FUnrealMCPImportScanResult> ScanFiles(const TArray<FString>& FilePaths);
+
+private:
+	static void ScanGltf(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanGlb(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanGltfJson(const FString& JsonText, const FString& BaseDir, FUnrealMCPImportScanResult& Result);
+	static void ScanObj(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanMtl(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanFbx(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanFbxAscii(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+	static void ScanPly(const FString& FilePath, FUnrealMCPImportScanResult& Result);
+};
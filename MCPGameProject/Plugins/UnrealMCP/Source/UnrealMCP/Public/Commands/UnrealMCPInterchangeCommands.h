@@ -25,6 +25,7 @@ private:
 	TSharedPtr<FJsonObject> HandleGetInterchangeAssets(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleReimportAsset(const TSharedPtr<FJsonObject>& Params);
 	TSharedPtr<FJsonObject> HandleGetInterchangeInfo(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleScanImportSources(const TSharedPtr<FJsonObject>& Params);
 	
 	// Interchange Pipeline Blueprint commands
 	TSharedPtr<FJsonObject> HandleCreateInterchangePipelineBlueprint(const TSharedPtr<FJsonObject>& Params);
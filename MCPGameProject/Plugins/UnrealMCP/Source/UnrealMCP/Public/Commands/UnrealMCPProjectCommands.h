@@ -17,4 +17,5 @@ public:
 private:
     // Specific project command handlers
     TSharedPtr<FJsonObject> HandleCreateInputMapping(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCreateInputMappings(const TSharedPtr<FJsonObject>& Params);
 }; 
\ No newline at end of file
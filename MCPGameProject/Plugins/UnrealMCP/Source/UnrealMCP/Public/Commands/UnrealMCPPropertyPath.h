@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Compiled property paths for the property commands.
+ *
+ * A path such as "Mesh.BodyInstance.MassScale", "Tags[3]", "Map[\"Key\"]" or "RelativeLocation" is parsed once
+ * per (owner class, path) into a chain of FProperty hops plus a typed leaf accessor, and cached. Object references
+ * in the middle of a path are followed at runtime and the remainder is compiled against the referenced object's
+ * class, so subclasses resolve correctly.
+ *
+ * Leaf accessors are picked by property type when the path is compiled (numerics, bool, string, name, text, enums,
+ * vectors, rotators, colors, transforms, object and soft references, arrays, maps, sets, other structs), so repeated
+ * sets on instances of the same class skip reflection lookups and type dispatch entirely. FColor, map and set values
+ * are written from JSON but read back as export text, the shape reads have always had.
+ *
+ * Whole-object exports use a per-class export plan instead: the filtered property list with offsets and accessors,
+ * built once per (class, editable-only) so exporting many objects of one class is a flat loop.
+ *
+ * Entries rooted at Blueprint-generated classes are revalidated against the class layout on every hit and dropped
+ * when any Blueprint compiles or objects are reinstanced; hot reload drops everything.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPPropertyPath
+{
+public:
+	struct FAccessor;
+	struct FCompiledPath;
+	struct FExportPlan;
+
+	/** A path resolved against one object. Valid until that object (or anything along the path) changes layout. */
+	struct FResolved
+	{
+		const FProperty* Property = nullptr;
+		void* ValuePtr = nullptr;
+		/** Object that owns the value; differs from the root when the path follows an object reference. */
+		UObject* Owner = nullptr;
+		const FAccessor* Accessor = nullptr;
+
+		/** Outermost array element or map entry added by a write resolve, removed again if the write fails. */
+		const FProperty* InsertedInto = nullptr;
+		void* InsertedContainer = nullptr;
+		int32 InsertedIndex = INDEX_NONE;
+	};
+
+	static FUnrealMCPPropertyPath& Get();
+
+	/**
+	 * Resolve Path on Object. With bForWrite, a missing map key is added and Tags[Num] appends an element;
+	 * the insert is recorded in Out and undone when resolving fails. Callers that write themselves and fail
+	 * should call UndoInsert.
+	 */
+	bool Resolve(UObject* Object, const FString& Path, bool bForWrite, FResolved& Out, FString& OutError);
+
+	/** Remove the element or entry a write resolve inserted, if any. */
+	static void UndoInsert(FResolved& Resolved);
+
+	/** Typed read/write of a resolved value. Read sets bOutSupported to false when there is no direct JSON form. */
+	static bool Write(const FResolved& Resolved, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+	static TSharedPtr<FJsonValue> Read(const FResolved& Resolved, bool& bOutSupported);
+
+	/** Resolve + Write; a failed write leaves containers as they were. */
+	bool SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
+	/**
+	 * Write every exportable property of Object into OutProps (transient and deprecated properties are skipped;
+	 * with bOnlyEditable, so is anything without CPF_Edit). Values without a direct JSON form are written as
+	 * {format: "export_text", export_text, cpp_type}.
+	 *
+	 * With a Baseline (normally Object->GetArchetype()), properties identical to the baseline's are skipped, so
+	 * only the values that differ are written. Instanced subobjects are compared by content.
+	 */
+	void ExportAll(UObject* Object, bool bOnlyEditable, const TSharedPtr<FJsonObject>& OutProps, UObject* Baseline = nullptr);
+
+	/** True when Path resolves on both objects to identical values. */
+	bool IsIdentical(UObject* Object, UObject* Baseline, const FString& Path);
+
+	/** CRC of every exportable property value of Object, for cheap "did anything change" checks. */
+	uint32 HashState(UObject* Object, bool bOnlyEditable);
+
+	/** Drop every compiled path and export plan. */
+	void Invalidate();
+
+private:
+	FUnrealMCPPropertyPath() = default;
+
+	TSharedPtr<FCompiledPath> FindOrCompile(const UStruct* Owner, const FString& Path, FString& OutError);
+	const FExportPlan& FindOrBuildExportPlan(const UClass* Class, bool bOnlyEditable);
+	void BindDelegates();
+	void InvalidateGenerated();
+
+	TMap<TObjectKey<UStruct>, TMap<FString, TSharedPtr<FCompiledPath>>> Cache;
+	/** Indexed by bOnlyEditable. */
+	TMap<TObjectKey<UStruct>, TSharedPtr<FExportPlan>> ExportPlans[2];
+	bool bDelegatesBound = false;
+};
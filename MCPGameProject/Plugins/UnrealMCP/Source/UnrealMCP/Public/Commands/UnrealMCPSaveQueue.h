@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UPackage;
+
+/**
+ * Tracks packages dirtied by MCP commands and saves them together.
+ *
+ * The bridge opens a capture scope per request; any package marked dirty inside it is remembered until
+ * it is saved. save_dirty (or "save": "deferred" on a request or batch) saves every tracked package in
+ * one pass: packages are serialized one after another with async file writes, and the writes are
+ * flushed once at the end. Handlers that used to save synchronously go through SaveOrDefer, which only
+ * queues the package when the current request deferred saving.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPSaveQueue
+{
+public:
+	/** Capture dirtied packages for one request; bDeferSaves routes SaveOrDefer into the queue. */
+	struct UNREALMCP_API FCaptureScope
+	{
+		explicit FCaptureScope(bool bDeferSaves);
+		~FCaptureScope();
+
+	private:
+		bool bDefer;
+	};
+
+	static FUnrealMCPSaveQueue& Get();
+
+	void Track(UPackage* Package);
+
+	/** True while a request that asked for "save": "deferred" is running. */
+	bool IsDeferring() const { return DeferDepth > 0; }
+
+	/** Save Asset's package now, or queue it when saves are deferred. Returns true when saved or queued. */
+	bool SaveOrDefer(UObject* Asset);
+
+	/** SaveConfig now, or once at the next SaveDirty when saves are deferred. */
+	void SaveConfigOrDefer(UObject* ConfigObject);
+
+	/** Tracked packages that are still dirty. */
+	TArray<UPackage*> GetDirtyPackages();
+
+	/**
+	 * Save every tracked package that is still dirty (only those named in PackageFilter, when non-empty)
+	 * plus deferred config objects. Returns per-package results and timings.
+	 */
+	TSharedPtr<FJsonObject> SaveDirty(const TArray<FString>& PackageFilter = TArray<FString>());
+
+private:
+	FUnrealMCPSaveQueue() = default;
+
+	void BindDelegates();
+	void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+
+	TArray<TWeakObjectPtr<UPackage>> Packages;
+	TSet<FName> PackageNames;
+	TArray<TWeakObjectPtr<UObject>> Configs;
+	int32 CaptureDepth = 0;
+	int32 DeferDepth = 0;
+	bool bDelegatesBound = false;
+};
@@ -79,4 +79,22 @@ private:
      * @return JSON response with the binding details
      */
     TSharedPtr<FJsonObject> HandleSetTextBlockBinding(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Build a widget hierarchy from nested JSON in one transaction with one compile
+     * @param Params - Must include:
+     *                "blueprint_name" or "blueprint_path" - Target Widget Blueprint
+     *                "widgets" - Nodes {type, name, properties, slot, events, bindings, children}
+     *                "parent" - Existing panel to build under (optional; default the root)
+     *                "replace" - Discard the existing tree first (optional)
+     * @return JSON response with created widgets and per-widget errors
+     */
+    TSharedPtr<FJsonObject> HandleBuildWidgetTree(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Export a Widget Blueprint's hierarchy in the form build_widget_tree accepts
+     * @param Params - Must include "blueprint_name" or "blueprint_path"; "root" and "include_properties" are optional
+     * @return JSON response with the nested tree
+     */
+    TSharedPtr<FJsonObject> HandleGetWidgetTree(const TSharedPtr<FJsonObject>& Params);
 }; 
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UWidget;
+class UWidgetBlueprint;
+class UK2Node_ComponentBoundEvent;
+struct FEdGraphEditAction;
+
+/**
+ * Constant-time lookups for Widget Blueprints: widget name -> UWidget in the WidgetTree, and
+ * (widget, event) -> component-bound event node in the event graphs.
+ *
+ * Widgets are outered to their WidgetTree, so a name is found through the object hash and then checked
+ * for membership in the tree (reachable from the root or a named slot) instead of walking every widget.
+ *
+ * Bound events are indexed per Blueprint on first lookup and kept current from the Ubergraph pages'
+ * OnGraphChanged delegates; Blueprint OnChanged marks the index for rebuild. A stale hit rebuilds once.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FUnrealMCPWidgetIndex
+{
+public:
+	static FUnrealMCPWidgetIndex& Get();
+
+	/** Widget by name anywhere in the Blueprint's WidgetTree (named slots included). */
+	UWidget* FindWidget(UWidgetBlueprint* Blueprint, FName WidgetName);
+
+	/** Component-bound event node for WidgetName's EventName delegate, if one exists. */
+	UK2Node_ComponentBoundEvent* FindBoundEvent(UWidgetBlueprint* Blueprint, FName WidgetName, FName EventName);
+
+	/** Drop the cached event index for a Blueprint; rebuilt on next lookup. */
+	void Invalidate(UWidgetBlueprint* Blueprint);
+
+private:
+	FUnrealMCPWidgetIndex() = default;
+
+	struct FGraphBinding
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		FDelegateHandle Handle;
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UWidgetBlueprint> Blueprint;
+		TMap<TPair<FName, FName>, TWeakObjectPtr<UK2Node_ComponentBoundEvent>> BoundEvents;
+		TArray<FGraphBinding> Graphs;
+		FDelegateHandle BlueprintChangedHandle;
+		bool bDirty = true;
+	};
+
+	FEntry& FindOrAddEntry(UWidgetBlueprint* Blueprint);
+	void Rebuild(FEntry& Entry);
+	void Unbind(FEntry& Entry);
+	void OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UWidgetBlueprint> BlueprintKey);
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<TObjectKey<UWidgetBlueprint>, FEntry> Entries;
+};
@@ -6,10 +6,41 @@
 #include "CoreMinimal.h"
 #include "InterchangePipelineBase.h"
 #include "InterchangeGenericMaterialPipeline.h"
+#include "Containers/Ticker.h"
+#include "AssetRegistry/AssetData.h"
 #include "UnrealMCPFBXMaterialPipeline.generated.h"
 
 class UMaterialInterface;
 class UMaterialInstanceConstant;
+class UTexture;
+class UMaterialInstanceConstantFactoryNew;
+
+/**
+ * Precompiled texture-name -> material parameter matcher built from a TextureParameterMapping.
+ *
+ * Keys starting with '_' are suffix rules matched against the end of the texture name (longest wins, so
+ * "_NRA" beats "_N"). Other keys are token rules matched as a prefix of any '_'-separated name token
+ * ("Normal" matches "T_Rock_NormalMap"). Both are tries, so a lookup is O(name length) regardless of rule count.
+ */
+struct UNREALMCP_API FUnrealMCPTextureParameterMatcher
+{
+	void Build(const TMap<FString, FString>& Mapping);
+	bool Match(const FString& TextureName, FName& OutParameterName) const;
+	bool IsEmpty() const { return ParameterNames.Num() == 0; }
+
+private:
+	struct FTrieNode
+	{
+		TMap<TCHAR, int32> Children;
+		int32 ParameterIndex = INDEX_NONE;
+	};
+
+	static void Insert(TArray<FTrieNode>& Trie, const FString& Key, int32 ParameterIndex);
+
+	TArray<FTrieNode> SuffixTrie;	// keys stored reversed
+	TArray<FTrieNode> TokenTrie;
+	TArray<FName> ParameterNames;
+};
 
 /**
  * Custom Interchange Pipeline for automatic FBX Material Instance setup.
@@ -59,12 +90,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Instance Settings")
 	TMap<FString, FString> TextureParameterMapping;
 
+	/** If true, save every material instance created by an import in one batch once binding is done */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material Instance Settings")
+	bool bSaveCreatedInstances = false;
+
 protected:
 	/** Create a material instance from the given material */
 	UFUNCTION(BlueprintCallable, Category = "Material Instance")
 	UMaterialInstanceConstant* CreateMaterialInstanceFromMaterial(UMaterialInterface* SourceMaterial, const FString& InstanceName, const FString& PackagePath);
 
-	/** Configure material instance parameters based on imported textures */
+	/** Configure material instance parameters based on imported textures (one edit/recompile per instance) */
 	UFUNCTION(BlueprintCallable, Category = "Material Instance")
 	void ConfigureMaterialInstanceTextures(UMaterialInstanceConstant* MaterialInstance, const TMap<FString, UTexture*>& TextureMap);
 
@@ -76,12 +111,38 @@ private:
 	/** Initialize default texture parameter mappings */
 	void InitializeDefaultTextureMappings();
 
+	/** Create instances for every imported material and bind all imported textures in one pass. */
+	void RunDeferredBindingPass();
+
+	/** Fallback for imports where some expected factory nodes never post (failed or skipped assets). */
+	void ScheduleBindingPassFallback();
+
+	/**
+	 * Shared creation path. Batch callers pass the instances resolved by one registry query (keyed by package name),
+	 * a reused factory, and bNotifyRegistry=false so AssetCreated can be sent once for the whole pass.
+	 */
+	UMaterialInstanceConstant* CreateMaterialInstanceInternal(UMaterialInterface* SourceMaterial, const FString& InstanceName, const FString& PackagePath,
+		const TMap<FName, FAssetData>* ExistingInstances, UMaterialInstanceConstantFactoryNew* Factory, bool bNotifyRegistry);
+
 	/** Cache for created material instances during import */
 	TMap<FString, UMaterialInstanceConstant*> CreatedMaterialInstances;
 
 	/** Cache for imported textures */
 	TMap<FString, UTexture*> ImportedTextures;
 
+	/** Materials imported in this run, waiting for the binding pass */
+	TArray<TWeakObjectPtr<UMaterialInterface>> PendingMaterials;
+
+	/** Texture/material factory node uids still expected to post-import before the binding pass runs */
+	TSet<FString> PendingFactoryNodeUids;
+
+	/** Compiled from TextureParameterMapping at the start of each import */
+	FUnrealMCPTextureParameterMatcher TextureMatcher;
+
+	FTSTicker::FDelegateHandle BindingFallbackHandle;
+	double LastPostImportTime = 0.0;
+	bool bBindingPassDone = false;
+
 	/** Content base path for current import operation */
 	FString CurrentContentBasePath;
 };
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// UnrealMCP Texture Suffix Classification Pipeline
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InterchangePipelineBase.h"
+#include "Engine/TextureDefines.h"
+#include "UnrealMCPTextureSuffixPipeline.generated.h"
+
+class UInterchangeTextureFactoryNode;
+
+/** One suffix classification rule (e.g. "_N" -> normal map, linear, TC_Normalmap, wired to "Normal"). */
+USTRUCT(BlueprintType)
+struct UNREALMCP_API FUnrealMCPTextureSuffixRule
+{
+	GENERATED_BODY()
+
+	/** Name suffix including the separator, e.g. "_N" or "_ORM". Matched case-insensitively; longest suffix wins. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	FString Suffix;
+
+	/** Compression applied to the texture factory node */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	TEnumAsByte<TextureCompressionSettings> Compression = TC_Default;
+
+	/** sRGB applied to the texture factory node (ignored for channel-packed textures, which are always linear) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	bool bSRGB = true;
+
+	/** Channel layout of a packed texture, e.g. "ORM" (R=Occlusion, G=Roughness, B=Metallic). Empty for unpacked textures. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	FString PackedChannels;
+
+	/** Material instance texture parameter this texture is wired to. Empty to skip wiring. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	FString MaterialParameter;
+};
+
+/**
+ * Native Interchange pipeline that classifies texture factory nodes by name suffix.
+ *
+ * Runs entirely in ExecutePipeline, before any asset is created:
+ * 1. Each texture factory node is matched against SuffixRules (longest suffix wins)
+ * 2. Compression and sRGB are written to the node, so textures are built once with the right settings
+ * 3. Material instance factory nodes with the same name stem get the texture wired to the rule's parameter
+ *
+ * Replaces the Blueprint-scripted suffix pipelines assembled through add_interchange_pipeline_node.
+ * Rules are editable per pipeline Blueprint via configure_interchange_pipeline (settings.SuffixRules).
+ */
+UCLASS(BlueprintType, Blueprintable, EditInlineNew, meta=(DisplayName="Texture Suffix Pipeline"))
+class UNREALMCP_API UUnrealMCPTextureSuffixPipeline : public UInterchangePipelineBase
+{
+	GENERATED_BODY()
+
+public:
+	UUnrealMCPTextureSuffixPipeline();
+
+	//~ Begin UInterchangePipelineBase Interface
+	virtual void ExecutePipeline(UInterchangeBaseNodeContainer* InBaseNodeContainer, const TArray<UInterchangeSourceData*>& InSourceDatas, const FString& ContentBasePath) override;
+	virtual bool CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask) override { return true; }
+	//~ End UInterchangePipelineBase Interface
+
+	/** Suffix rules, in any order */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	TArray<FUnrealMCPTextureSuffixRule> SuffixRules;
+
+	/** Name prefixes stripped before comparing texture and material stems (T_Rock_N <-> MI_Rock) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	TArray<FString> StemPrefixes;
+
+	/** If true, wire classified textures into material instance factory nodes with a matching stem */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	bool bWireMaterialParameters = true;
+
+	/** If true, overwrite parameters that another pipeline already wired */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Texture Suffix")
+	bool bOverrideExistingParameters = false;
+
+	/** Index into SuffixRules for the longest matching suffix, or INDEX_NONE. Exposed for callers that classify names without importing. */
+	int32 ClassifyTextureName(const FString& TextureName) const;
+
+	/** Lowercased name with StemPrefixes and the matched suffix removed. */
+	FString GetNameStem(const FString& Name, int32 RuleIndex) const;
+
+private:
+	/** Initialize default suffix rules */
+	void InitializeDefaultRules();
+
+	/** Apply a rule's texture settings; returns false when the node kept its settings. */
+	bool ApplyTextureRule(UInterchangeTextureFactoryNode* TextureNode, const FUnrealMCPTextureSuffixRule& Rule) const;
+};
@@ -52,6 +52,7 @@ public class UnrealMCP : ModuleRules
 			"BlueprintGraph",
 			"Projects",
 			"AssetRegistry",
+			"EnhancedInput",
 			// Interchange modules for Pipeline Blueprint creation
 			"InterchangeCore",
 			"InterchangeEngine",
@@ -47,6 +47,60 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def create_blueprints_from_template(
+        ctx: Context,
+        blueprints: List[Dict[str, Any]],
+        template_name: str = "",
+        template_path: str = "",
+        folder_path: str = "",
+        compile: bool = True,
+        chunk_size: int = 16
+    ) -> Dict[str, Any]:
+        """
+        Create many Blueprints by duplicating a template Blueprint.
+
+        Args:
+            blueprints: Variants, each {name, folder_path?, asset_path?, properties?, component_properties?}.
+                properties maps property paths on the class defaults to values;
+                component_properties maps component names to {property path: value}
+            template_name: Name of the template Blueprint
+            template_path: Canonical asset path of the template (disambiguates the name)
+            folder_path: Default destination folder for variants that do not give one
+            compile: Compile all created Blueprints as one chunked batch
+            chunk_size: Blueprints per compile chunk
+
+        Returns:
+            Dict with one item per variant, created/errors counts and the batch compile status
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "blueprints": blueprints,
+                "compile": compile,
+                "chunk_size": chunk_size
+            }
+            if template_name:
+                params["template_name"] = template_name
+            if template_path:
+                params["template_path"] = template_path
+            if folder_path:
+                params["folder_path"] = folder_path
+
+            response = unreal.send_command("create_blueprints_from_template", params)
+            return response or {}
+
+        except Exception as e:
+            error_msg = f"Error creating blueprints from template: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def add_component_to_blueprint(
         ctx: Context,
@@ -63,7 +117,7 @@ def register_blueprint_tools(mcp: FastMCP):
         
         Args:
             blueprint_name: Name of the target Blueprint
-            component_type: Type of component to add (use component class name without U prefix)
+            component_type: Component class name (with or without U prefix or Component suffix), Blueprint component name, or class path
             component_name: Name for the new component
             location: [X, Y, Z] coordinates for component's position
             rotation: [Pitch, Yaw, Roll] values for component's rotation
@@ -204,6 +258,47 @@ def register_blueprint_tools(mcp: FastMCP):
             error_msg = f"Error setting component property: {e}"
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_component_properties(
+        ctx: Context,
+        components: Dict[str, Dict[str, Any]],
+        blueprint_name: str = "",
+        blueprint_path: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Set many properties on many components of one Blueprint in a single undo transaction.
+
+        Args:
+            components: Component name -> {property path: value}, e.g.
+                {"Mesh": {"RelativeLocation": [0, 0, 50], "BodyInstance.MassScale": 2.0}}
+            blueprint_name: Name of the Blueprint
+            blueprint_path: Canonical asset path of the Blueprint (disambiguates the name)
+
+        Returns:
+            Dict with the properties set per component, set_count, and one entry per failed component or property
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {"components": components}
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprint_path:
+                params["blueprint_path"] = blueprint_path
+
+            response = unreal.send_command("set_component_properties", params)
+            return response or {}
+
+        except Exception as e:
+            error_msg = f"Error setting component properties: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
     
     @mcp.tool()
     def set_physics_properties(
@@ -253,9 +348,15 @@ def register_blueprint_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_blueprint(
         ctx: Context,
-        blueprint_name: str
+        blueprint_name: str,
+        force: bool = False
     ) -> Dict[str, Any]:
-        """Compile a Blueprint."""
+        """
+        Compile a Blueprint.
+
+        Skipped (skipped=True) when the Blueprint's structural fingerprint matches its last successful
+        compile; pass force=True to compile anyway. The returned fingerprint can be used to cache graph reads.
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -265,7 +366,8 @@ def register_blueprint_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
             
             params = {
-                "blueprint_name": blueprint_name
+                "blueprint_name": blueprint_name,
+                "force": force
             }
             
             logger.info(f"Compiling blueprint: {blueprint_name}")
@@ -283,6 +385,126 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def compile_blueprints(
+        ctx: Context,
+        blueprints: List[str] = None,
+        folder: str = "",
+        recursive: bool = True,
+        chunk_size: int = 16,
+        wait: bool = False,
+        force: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Compile many Blueprints through the editor's compilation manager.
+
+        Blueprints are compiled chunk_size at a time (one chunk per editor tick) so dependent
+        Blueprints share reinstancing and the editor stays responsive.
+
+        Args:
+            blueprints: Blueprint names or asset paths
+            folder: Compile every Blueprint under this content folder (e.g. "/Game/Blueprints")
+            recursive: Include subfolders of folder
+            chunk_size: Blueprints compiled per editor tick
+            wait: If True, compile everything before returning
+            force: If True, also compile Blueprints whose structural fingerprint is unchanged
+
+        Returns:
+            job_id and progress; poll get_compile_blueprints_status until state is "done".
+            Items carry the same diagnostics fields as compile_blueprint.
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "blueprints": blueprints or [],
+                "folder": folder,
+                "recursive": recursive,
+                "chunk_size": chunk_size,
+                "wait": wait,
+                "force": force
+            }
+
+            logger.info(f"Compiling blueprints: {params}")
+            response = unreal.send_command("compile_blueprints", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Compile blueprints response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error compiling blueprints: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_compile_blueprints_status(ctx: Context, job_id: str) -> Dict[str, Any]:
+        """Get progress and per-Blueprint results of a compile_blueprints job."""
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("get_compile_blueprints_status", {"job_id": job_id})
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error getting compile status: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def flush_compiles(ctx: Context) -> Dict[str, Any]:
+        """
+        Compile every Blueprint with pending deferred edits.
+
+        Edit commands (add_component_to_blueprint, add_blueprint_*_node, connect_blueprint_nodes, ...)
+        only mark their Blueprint; it is compiled once at the end of the request or batch. Requests sent
+        with "defer_compile": true leave it pending across requests until this call, the next
+        non-deferred request, or an idle timeout. Compiles run by the idle timeout are reported on
+        the next response as "idle_compiles".
+
+        Returns:
+            Per-Blueprint compile results (level, coalesced_edits, compile_success, diagnostics)
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("flush_compiles", {})
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Flush compiles response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error flushing compiles: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def set_blueprint_property(
         ctx: Context,
@@ -196,8 +196,20 @@ def register_editor_tools(mcp: FastMCP):
             return {}
     
     @mcp.tool()
-    def get_actor_properties(ctx: Context, name: str) -> Dict[str, Any]:
-        """Get all properties of an actor."""
+    def get_actor_properties(
+        ctx: Context,
+        name: str,
+        non_default_only: bool = False,
+        include_hash: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Get all properties of an actor.
+
+        Args:
+            name: Name of the actor
+            non_default_only: Also return the properties that differ from the actor's archetype
+            include_hash: Add state_hash, a CRC of the full property state
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -207,7 +219,9 @@ def register_editor_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
                 
             response = unreal.send_command("get_actor_properties", {
-                "name": name
+                "name": name,
+                "non_default_only": non_default_only,
+                "include_hash": include_hash
             })
             return response or {}
             
@@ -439,4 +453,87 @@ def register_editor_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def get_objects_properties(
+        ctx: Context,
+        objects: List[str],
+        properties: Optional[List[str]] = None,
+        only_editable: bool = True,
+        non_default_only: bool = False,
+        include_hash: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Export reflected properties of many objects in one call.
+
+        Args:
+            objects: Actor names/labels, object paths, or Blueprint asset paths (exports the class defaults)
+            properties: Optional property names or paths; all exportable properties when omitted
+            only_editable: Only export editor-visible properties
+            non_default_only: Only export values that differ from each object's archetype
+            include_hash: Add state_hash, a CRC of each object's full property state
+
+        Returns:
+            Dict with one entry per object (properties or error) and a not_found count
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "objects": objects,
+                "only_editable": only_editable,
+                "non_default_only": non_default_only,
+                "include_hash": include_hash
+            }
+            if properties:
+                params["properties"] = properties
+            response = unreal.send_command("get_objects_properties", params)
+            return response or {}
+
+        except Exception as e:
+            logger.error(f"Error getting object properties: {e}")
+            return {"success": False, "message": str(e)}
+
+    @mcp.tool()
+    def save_dirty(
+        ctx: Context,
+        packages: List[str] = None,
+        list_only: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Save every package dirtied by MCP commands in one pass.
+
+        Packages are serialized one after another with async file writes that are flushed once at the
+        end. Map packages are skipped. Send a request or batch with "save": "deferred" to have its
+        saves collected and done this way automatically.
+
+        Args:
+            packages: Optional long package names (/Game/...) to save; all tracked dirty packages when omitted
+            list_only: Only list the tracked dirty packages, do not save
+
+        Returns:
+            Dict with per-package results (saved, skipped/reason, ms) and totals
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {"list_only": list_only}
+            if packages:
+                params["packages"] = packages
+            response = unreal.send_command("save_dirty", params)
+            return response or {}
+
+        except Exception as e:
+            logger.error(f"Error saving dirty packages: {e}")
+            return {"success": False, "message": str(e)}
+
     logger.info("Editor tools registered successfully")
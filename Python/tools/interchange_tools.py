@@ -28,7 +28,8 @@ def register_interchange_tools(mcp: FastMCP):
         import_material: bool = True,
         import_texture: bool = True,
         import_skeleton: bool = True,
-        create_physics_asset: bool = False
+        create_physics_asset: bool = False,
+        force: bool = False
     ) -> Dict[str, Any]:
         """
         Import a 3D model file using Unreal Interchange system.
@@ -43,9 +44,13 @@ def register_interchange_tools(mcp: FastMCP):
             import_texture: Import textures (default: True)
             import_skeleton: Import skeleton for skeletal meshes (default: True)
             create_physics_asset: Create physics asset for skeletal meshes (default: False)
+            force: Ignore the import cache even if the source is unchanged (default: False)
             
         Returns:
-            Import configuration and validation result
+            Import configuration and validation result. The cache is keyed by
+            (file_path, expected_asset_path); when the source file and settings match
+            the last recorded import of that asset, "skipped" is true and "reason"
+            explains why.
         """
         from unreal_mcp_server import get_unreal_connection
         
@@ -62,7 +67,8 @@ def register_interchange_tools(mcp: FastMCP):
                 "import_material": import_material,
                 "import_texture": import_texture,
                 "import_skeleton": import_skeleton,
-                "create_physics_asset": create_physics_asset
+                "create_physics_asset": create_physics_asset,
+                "force": force
             }
             
             logger.info(f"Importing model with params: {params}")
@@ -252,16 +258,20 @@ def register_interchange_tools(mcp: FastMCP):
     @mcp.tool()
     def reimport_asset(
         ctx: Context,
-        asset_path: str
+        asset_path: str,
+        force: bool = False
     ) -> Dict[str, Any]:
         """
         Trigger reimport for an existing asset.
         
         Useful for updating assets after source file modifications.
         Supports StaticMesh, SkeletalMesh, Texture2D, and Material assets.
+        Reimport is skipped when every source file is byte-identical to the
+        last recorded import ("skipped": true, with a "reason").
         
         Args:
             asset_path: UE content path to the asset to reimport
+            force: Reimport even if the source file is unchanged (default: False)
             
         Returns:
             Reimport status and result
@@ -275,7 +285,8 @@ def register_interchange_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
             
             params = {
-                "asset_path": asset_path
+                "asset_path": asset_path,
+                "force": force
             }
             
             logger.info(f"Reimporting asset: {asset_path}")
@@ -334,6 +345,70 @@ def register_interchange_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def scan_import_sources(
+        ctx: Context,
+        file_paths: List[str] = None,
+        directory: str = "",
+        recursive: bool = True,
+        max_file_size_mb: float = 0,
+        max_vertices: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Inspect source model files without importing them.
+        
+        Parses glTF/GLB JSON, OBJ/MTL and FBX (binary and ASCII) headers on worker
+        threads and reports mesh/material/texture/vertex counts, embedded texture
+        sizes and referenced external files. No assets are created.
+        
+        Args:
+            file_paths: Absolute paths of source files to scan
+            directory: Optional directory to scan for supported formats
+            recursive: Recurse into subdirectories of directory (default: True)
+            max_file_size_mb: Flag files larger than this as oversized (0 = no limit)
+            max_vertices: Flag files with more vertices than this as oversized (0 = no limit)
+            
+        Returns:
+            Per-file scan results plus a summary with totals, oversized and unsupported files
+            
+        Example:
+            scan_import_sources(directory="D:/Sync/Characters", max_file_size_mb=200)
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "recursive": recursive
+            }
+            if file_paths:
+                params["file_paths"] = file_paths
+            if directory:
+                params["directory"] = directory
+            if max_file_size_mb:
+                params["max_file_size_mb"] = max_file_size_mb
+            if max_vertices:
+                params["max_vertices"] = max_vertices
+            
+            logger.info(f"Scanning import sources with params: {params}")
+            response = unreal.send_command("scan_import_sources", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Scan import sources response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error scanning import sources: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     logger.info("Interchange tools registered successfully")
     
     @mcp.tool()
@@ -359,6 +434,7 @@ def register_interchange_tools(mcp: FastMCP):
                          - GenericTexturePipeline (for texture-specific settings)
                          - PipelineBase (minimal base class)
                          - FBXMaterialPipeline (custom UnrealMCP pipeline for FBX material instance auto-setup)
+                         - TextureSuffixPipeline (native UnrealMCP pipeline: texture suffix -> compression/sRGB/material parameter)
             
         Returns:
             Created Pipeline Blueprint information including path and parent class
@@ -462,6 +538,9 @@ def register_interchange_tools(mcp: FastMCP):
             pipeline_path: UE content path to the Pipeline Blueprint
             settings: Dictionary of property names and values to set
                      Example: {"bImportMeshes": True, "bImportMaterials": False}
+                     Arrays, maps and structs are accepted too, e.g. for a TextureSuffixPipeline:
+                     {"SuffixRules": [{"Suffix": "_ORM", "Compression": "TC_Masks", "bSRGB": False,
+                                       "PackedChannels": "ORM", "MaterialParameter": "PackedTexture"}]}
             
         Returns:
             Configuration result with list of properties that were set
@@ -511,7 +590,8 @@ def register_interchange_tools(mcp: FastMCP):
     @mcp.tool()
     def get_interchange_pipeline_graph(
         ctx: Context,
-        pipeline_path: str
+        pipeline_path: str,
+        include_fingerprint: bool = False
     ) -> Dict[str, Any]:
         """
         Get the graph structure of an Interchange Pipeline Blueprint.
@@ -521,6 +601,7 @@ def register_interchange_tools(mcp: FastMCP):
         
         Args:
             pipeline_path: UE content path to the Pipeline Blueprint
+            include_fingerprint: Also return the pipeline's structural fingerprint (walks every graph)
             
         Returns:
             Graph structure including nodes, overridable functions, and connections
@@ -539,6 +620,8 @@ def register_interchange_tools(mcp: FastMCP):
             params = {
                 "pipeline_path": pipeline_path
             }
+            if include_fingerprint:
+                params["include_fingerprint"] = True
             
             logger.info(f"Getting interchange pipeline graph: {params}")
             response = unreal.send_command("get_interchange_pipeline_graph", params)
@@ -885,7 +968,8 @@ def register_interchange_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_interchange_pipeline(
         ctx: Context,
-        pipeline_path: str
+        pipeline_path: str,
+        force: bool = False
     ) -> Dict[str, Any]:
         """
         Compile an Interchange Pipeline Blueprint.
@@ -895,9 +979,12 @@ def register_interchange_tools(mcp: FastMCP):
         
         Args:
             pipeline_path: UE content path to the Pipeline Blueprint
+            force: Compile and save even if the pipeline's structural fingerprint is unchanged
             
         Returns:
-            Compilation result with success status and any errors
+            Compilation result with success status, fingerprint, compiled/saved/save_deferred flags,
+            a matching status ("Compiled and saved", "Saved", "Save deferred", "Up to date"),
+            and skipped=True when nothing changed
             
         Example:
             compile_interchange_pipeline("/Game/Interchange/Pipelines/MyPipeline")
@@ -911,7 +998,8 @@ def register_interchange_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
             
             params = {
-                "pipeline_path": pipeline_path
+                "pipeline_path": pipeline_path,
+                "force": force
             }
             
             logger.info(f"Compiling interchange pipeline: {params}")
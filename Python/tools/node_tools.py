@@ -385,15 +385,19 @@ def register_blueprint_node_tools(mcp: FastMCP):
         ctx: Context,
         blueprint_name: str,
         node_type = None,
-        event_type = None
+        event_type = None,
+        node_id = None,
+        include_fingerprint: bool = False
     ) -> Dict[str, Any]:
         """
-        Find nodes in a Blueprint's event graph.
+        Find nodes in a Blueprint's event graphs.
         
         Args:
             blueprint_name: Name of the target Blueprint
-            node_type: Optional type of node to find (Event, Function, Variable, etc.)
+            node_type: Optional type of node to find (Event, Guid, Function, Variable, etc.)
             event_type: Optional specific event type to find (BeginPlay, Tick, etc.)
+            node_id: Node GUID to look up when node_type is "Guid" (searches every graph)
+            include_fingerprint: Also return the Blueprint's structural fingerprint (walks every graph)
             
         Returns:
             Response containing array of found node IDs and success status
@@ -406,6 +410,10 @@ def register_blueprint_node_tools(mcp: FastMCP):
                 "node_type": node_type,
                 "event_type": event_type
             }
+            if node_id:
+                params["node_id"] = node_id
+            if include_fingerprint:
+                params["include_fingerprint"] = True
             
             unreal = get_unreal_connection()
             if not unreal:
@@ -427,4 +435,253 @@ def register_blueprint_node_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def apply_blueprint_graph_patch(
+        ctx: Context,
+        blueprint_name: str,
+        nodes: List[Dict[str, Any]] = None,
+        links: List[Dict[str, Any]] = None,
+        graph_name: str = None,
+        blueprint_path: str = None,
+        compile: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Build or edit a Blueprint graph in a single call.
+        
+        All nodes, pin defaults and links are applied in one transaction; if any entry
+        fails, nothing is changed.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            nodes: List of node specs, each with a client-side "id" and a "node_type"
+                   (Event, FunctionCall, VariableGet, VariableSet, GetComponent, InputAction, Self)
+                   plus the fields that type needs (event_name, function_name, target,
+                   variable_name, action_name), optional "node_position" [x, y] and
+                   optional "pins" {pin_name: default_value}
+            links: List of {"from_node", "from_pin", "to_node", "to_pin"}; node refs are ids
+                   from this patch or GUIDs of existing nodes in the same graph
+            graph_name: Target graph (default EventGraph; "ConstructionScript" or a function graph name)
+            blueprint_path: Optional asset path to disambiguate the Blueprint
+            compile: Queue a full compile at the end of the request instead of a skeleton refresh
+            
+        Returns:
+            Response with "node_ids" mapping each temporary id to the real node GUID
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "nodes": nodes or [],
+                "links": links or [],
+                "compile": compile
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+            if blueprint_path:
+                params["blueprint_path"] = blueprint_path
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Applying graph patch to '{blueprint_name}': {len(params['nodes'])} nodes, {len(params['links'])} links")
+            response = unreal.send_command("apply_blueprint_graph_patch", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Graph patch response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error applying graph patch: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def search_blueprint_functions(
+        ctx: Context,
+        query: str,
+        target: str = None,
+        match: str = "prefix",
+        limit: int = 50
+    ) -> Dict[str, Any]:
+        """
+        Search Blueprint-callable functions for autocomplete.
+        
+        Args:
+            query: Function name or display name prefix (case-insensitive)
+            target: Optional class; only functions callable on it (own or inherited) are returned
+            match: "prefix" (default) or "contains"
+            limit: Maximum number of results (default 50, max 500)
+            
+        Returns:
+            Response with "functions" (function_name, display_name, target, category, pure, static)
+            and "truncated" when more matches exist
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "query": query,
+                "match": match,
+                "limit": limit
+            }
+            if target:
+                params["target"] = target
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("search_blueprint_functions", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error searching functions: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def export_blueprint_graph(
+        ctx: Context,
+        blueprint_name: str = "",
+        blueprint_path: str = "",
+        graphs: List[str] = None,
+        graph_offset: int = 0,
+        graph_limit: int = 0,
+        include_titles: bool = False,
+        fingerprint: str = "",
+        known_fingerprints: Dict[str, str] = None
+    ) -> Dict[str, Any]:
+        """
+        Export every graph of a Blueprint with nodes, pins and links in one columnar response.
+        
+        Args:
+            blueprint_name: Name of the Blueprint
+            blueprint_path: Optional asset path to disambiguate
+            graphs: Only export these graph names (default: all)
+            graph_offset: First graph to return
+            graph_limit: Maximum graphs to return (0 = all)
+            include_titles: Add node titles (slow on big graphs)
+            fingerprint: Overall fingerprint from a previous export; returns not_modified if unchanged
+            known_fingerprints: Graph name -> fingerprint; unchanged graphs come back without tables
+            
+        Returns:
+            "strings" (interned names) and "graphs", each with columnar "nodes" and "pins" tables and
+            "edges" as [output_pin, input_pin] pairs; "next_graph_offset" when more graphs remain
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "graph_offset": graph_offset,
+                "graph_limit": graph_limit,
+                "include_titles": include_titles
+            }
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprint_path:
+                params["blueprint_path"] = blueprint_path
+            if graphs:
+                params["graphs"] = graphs
+            if fingerprint:
+                params["fingerprint"] = fingerprint
+            if known_fingerprints:
+                params["known_fingerprints"] = known_fingerprints
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("export_blueprint_graph", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error exporting blueprint graph: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def search_blueprint_graphs(
+        ctx: Context,
+        name: str,
+        kind: str = "any",
+        owner: str = "",
+        match: str = "exact",
+        path: str = "",
+        limit: int = 100,
+        blueprints_only: bool = False,
+        wait: bool = False,
+        rebuild: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Find nodes across all project Blueprints that call a function, use a variable, implement an
+        event, instance a macro or have a node class.
+        
+        Args:
+            name: Name to look for (case-insensitive; node classes may omit "K2Node_")
+            kind: function, variable, event, macro, node_class or any
+            owner: Only members declared on this class (e.g. KismetSystemLibrary)
+            match: exact (default), prefix or contains
+            path: Only Blueprints under this package path (e.g. /Game/Characters)
+            limit: Maximum results (default 100, max 1000)
+            blueprints_only: Return matching Blueprint paths instead of nodes
+            wait: Index every queued Blueprint before answering (loads them)
+            rebuild: Discard the index and queue every Blueprint again
+            
+        Returns:
+            "matches" (blueprint, graph, node_id, node_class, kind, name, owner) or "blueprints",
+            plus "pending" / "index_complete" while the background crawl is still running
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "name": name,
+                "kind": kind,
+                "match": match,
+                "limit": limit,
+                "blueprints_only": blueprints_only,
+                "wait": wait,
+                "rebuild": rebuild
+            }
+            if owner:
+                params["owner"] = owner
+            if path:
+                params["path"] = path
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("search_blueprint_graphs", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error searching blueprint graphs: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     logger.info("Blueprint node tools registered successfully")
\ No newline at end of file
@@ -5,7 +5,7 @@ This module provides tools for managing project-wide settings and configuration.
 """
 
 import logging
-from typing import Dict, Any
+from typing import Dict, Any, List
 from mcp.server.fastmcp import FastMCP, Context
 
 # Get logger
@@ -61,4 +61,59 @@ def register_project_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def create_input_mappings(
+        ctx: Context,
+        action_mappings: List[Dict[str, Any]] = None,
+        axis_mappings: List[Dict[str, Any]] = None,
+        replace: bool = False,
+        enhanced_input: Dict[str, Any] = None
+    ) -> Dict[str, Any]:
+        """
+        Create many input mappings at once, with one keymap rebuild and one config write.
+        
+        Args:
+            action_mappings: List of {action_name, key, shift?, ctrl?, alt?, cmd?}
+            axis_mappings: List of {axis_name, key, scale?}
+            replace: Remove existing mappings for the named actions/axes first
+            enhanced_input: Optional Enhanced Input assets to generate:
+                {path?, mapping_context?, action_prefix?, actions?: [{name, value_type, keys}]}.
+                Without actions, one input action is derived per legacy action/axis name;
+                shift/ctrl/alt/cmd become chord triggers on generated modifier-key actions.
+            
+        Returns:
+            Counts of added/skipped mappings and the generated Enhanced Input assets.
+            Nothing is changed if any entry is invalid.
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {"replace": replace}
+            if action_mappings:
+                params["action_mappings"] = action_mappings
+            if axis_mappings:
+                params["axis_mappings"] = axis_mappings
+            if enhanced_input is not None:
+                params["enhanced_input"] = enhanced_input
+            
+            logger.info(f"Creating {len(action_mappings or [])} action and {len(axis_mappings or [])} axis mappings")
+            response = unreal.send_command("create_input_mappings", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Input mappings creation response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error creating input mappings: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     logger.info("Project tools registered successfully") 
\ No newline at end of file
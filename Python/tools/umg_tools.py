@@ -330,4 +330,95 @@ def register_umg_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def build_widget_tree(
+        ctx: Context,
+        widgets: List[Dict[str, Any]],
+        blueprint_name: str = "",
+        blueprint_path: str = "",
+        parent: str = "",
+        replace: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Build a whole widget hierarchy in one call, one transaction and one compile.
+
+        Args:
+            widgets: Nodes of the form {type, name, is_variable, properties: {path: value},
+                     slot: {path: value}, position: [x, y], size: [w, h], events: ["OnClicked"],
+                     bindings: {"Text": "GetScoreText"}, children: [...]}. type is any UWidget
+                     class name (TextBlock, VerticalBox, ...) or a Widget Blueprint.
+            blueprint_name: Name of the target Widget Blueprint
+            blueprint_path: Asset path of the target Widget Blueprint (preferred)
+            parent: Existing panel to build under (default: the root widget)
+            replace: Discard the existing tree first; widgets must then hold exactly one root
+
+        Returns:
+            Dict with created widgets, events_bound, bindings and per-widget errors
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {"widgets": widgets, "replace": replace}
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprint_path:
+                params["blueprint_path"] = blueprint_path
+            if parent:
+                params["parent"] = parent
+            response = unreal.send_command("build_widget_tree", params)
+            return response or {}
+
+        except Exception as e:
+            error_msg = f"Error building widget tree: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_widget_tree(
+        ctx: Context,
+        blueprint_name: str = "",
+        blueprint_path: str = "",
+        root: str = "",
+        include_properties: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Export a Widget Blueprint's hierarchy in the form build_widget_tree accepts.
+
+        Args:
+            blueprint_name: Name of the Widget Blueprint
+            blueprint_path: Asset path of the Widget Blueprint (preferred)
+            root: Export only the subtree under this widget
+            include_properties: Include non-default widget and slot properties
+
+        Returns:
+            Dict with the nested tree under "root" and widget_count
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {"include_properties": include_properties}
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprint_path:
+                params["blueprint_path"] = blueprint_path
+            if root:
+                params["root"] = root
+            response = unreal.send_command("get_widget_tree", params)
+            return response or {}
+
+        except Exception as e:
+            error_msg = f"Error getting widget tree: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("UMG tools registered successfully") 
\ No newline at end of file
@@ -148,6 +148,21 @@ public class McpTests
         Assert.False(result.Params["stop_on_error"]?.GetValue<bool>());
     }
 
+    [Fact]
+    public void TryBuildUeBatchParams_WithSingleTransaction_PassesThrough()
+    {
+        var calls = new JsonArray
+        {
+            new JsonObject { ["name"] = "ping" }
+        };
+
+        var result = Mcp.TryBuildUeBatchParams(calls, stopOnError: true, transaction: "single");
+
+        Assert.NotNull(result);
+        Assert.Equal("single", result.Params["transaction"]?.GetValue<string>());
+        Assert.Null(Mcp.TryBuildUeBatchParams(calls, stopOnError: true)!.Params["transaction"]);
+    }
+
     [Fact]
     public void TryBuildUeBatchParams_WithNestedBatch_ReturnsNull()
     {
@@ -31,22 +31,29 @@ internal static class Mcp
         "set_actor_transform",
         "get_actor_properties",
         "set_actor_property",
+        "get_objects_properties",
         "spawn_blueprint_actor",
         "focus_viewport",
         "take_screenshot",
 
         // Blueprint (asset/component)
         "create_blueprint",
+        "create_blueprints_from_template",
         "add_component_to_blueprint",
         "set_component_property",
+        "set_component_properties",
         "set_physics_properties",
         "compile_blueprint",
+        "compile_blueprints",
+        "get_compile_blueprints_status",
         "set_blueprint_property",
         "set_static_mesh_properties",
         "set_pawn_properties",
         "list_blueprint_components",
         "get_component_property",
         "get_blueprint_property",
+        "flush_compiles",
+        "save_dirty",
 
 
 
@@ -56,6 +63,9 @@ internal static class Mcp
         "add_blueprint_get_self_component_reference",
         "add_blueprint_self_reference",
         "find_blueprint_nodes",
+        "apply_blueprint_graph_patch",
+        "search_blueprint_functions",
+        "search_blueprint_graphs",
         "add_blueprint_event_node",
         "add_blueprint_input_action_node",
         "add_blueprint_function_node",
@@ -65,9 +75,11 @@ internal static class Mcp
         // Construction Script
         "get_construction_script_graph",
         "add_construction_script_node",
+        "export_blueprint_graph",
 
         // Project
         "create_input_mapping",
+        "create_input_mappings",
 
         // UMG
         "create_umg_widget_blueprint",
@@ -76,6 +88,8 @@ internal static class Mcp
         "bind_widget_event",
         "set_text_block_binding",
         "add_widget_to_viewport",
+        "build_widget_tree",
+        "get_widget_tree",
 
         // Interchange
         "import_model",
@@ -84,6 +98,7 @@ internal static class Mcp
         "get_interchange_assets",
         "reimport_asset",
         "get_interchange_info",
+        "scan_import_sources",
         "create_interchange_pipeline_blueprint",
         "get_interchange_pipelines",
         "configure_interchange_pipeline",
@@ -185,6 +200,7 @@ internal static class Mcp
                             }
                         },
                         ["stop_on_error"] = new JsonObject { ["type"] = "boolean", ["default"] = true },
+                        ["transaction"] = new JsonObject { ["type"] = "string", ["enum"] = new JsonArray { "per_command", "single" }, ["description"] = "single: one undo step for the whole batch, with repeated Modify and Blueprint-modified notifications coalesced (UE batch only)", ["default"] = "per_command" },
                         ["notify"] = new JsonObject { ["type"] = "boolean", ["description"] = "Send progress notifications/message during execution", ["default"] = false },
                         ["use_ue_batch"] = new JsonObject { ["type"] = "boolean", ["description"] = "Try to use UE plugin batch command when possible", ["default"] = true }
                     },
@@ -418,16 +434,23 @@ internal static class Mcp
         var stopOnError = args["stop_on_error"]?.GetValue<bool?>() ?? true;
         var notify = args["notify"]?.GetValue<bool?>() ?? false;
         var useUeBatch = args["use_ue_batch"]?.GetValue<bool?>() ?? true;
+        var transaction = args["transaction"]?.GetValue<string>();
+        var singleTransaction = transaction == "single";
 
         // If caller asks for progress notifications, execute locally so we can emit per-step updates.
         if (notify)
             useUeBatch = false;
 
+        // Local execution sends each call separately, so it cannot share one UE transaction.
+        if (singleTransaction && !useUeBatch)
+            return ToolCallResultText("transaction=single requires the UE batch (use_ue_batch=true, notify=false)", null, isError: true);
 
         // Attempt UE-side batch if enabled and every item maps cleanly to a UE command.
         if (useUeBatch)
         {
-            var ueBatch = TryBuildUeBatchParams(calls, stopOnError);
+            var ueBatch = TryBuildUeBatchParams(calls, stopOnError, transaction);
+            if (ueBatch is null && singleTransaction)
+                return ToolCallResultText("transaction=single requires every call to map to a UE command", null, isError: true);
             if (ueBatch is not null)
             {
                 if (notify) await NotifyAsync("info", $"Batch: sending {ueBatch.Commands.Count} command(s) to UE");
@@ -439,6 +462,10 @@ internal static class Mcp
                     return ToolCallResultFromUeResponse("batch", ueResp);
 
                 }
+                catch (Exception ex) when (singleTransaction)
+                {
+                    return ToolCallResultText($"Batch: UE batch transport failed: {ex.Message}", null, isError: true);
+                }
                 catch (Exception ex)
                 {
                     // Transport failure: fall back to local execution to avoid dropping the request.
@@ -551,7 +578,7 @@ internal static class Mcp
         public required List<(string Type, JsonObject Params)> Commands { get; init; }
     }
 
-    internal static UeBatchBuildResult? TryBuildUeBatchParams(JsonArray calls, bool stopOnError)
+    internal static UeBatchBuildResult? TryBuildUeBatchParams(JsonArray calls, bool stopOnError, string? transaction = null)
     {
         var commands = new List<(string Type, JsonObject Params)>();
 
@@ -607,14 +634,18 @@ internal static class Mcp
             });
         }
 
+        var batchParams = new JsonObject
+        {
+            ["commands"] = arr,
+            ["stop_on_error"] = stopOnError
+        };
+        if (!string.IsNullOrWhiteSpace(transaction))
+            batchParams["transaction"] = transaction;
+
         return new UeBatchBuildResult
         {
             Commands = commands,
-            Params = new JsonObject
-            {
-                ["commands"] = arr,
-                ["stop_on_error"] = stopOnError
-            }
+            Params = batchParams
         };
     }
 
@@ -183,11 +183,37 @@ public static class ToolSchemas
             "Get properties of a specific actor",
             new JsonObject
             {
-                ["name"] = new JsonObject { ["type"] = "string", ["description"] = "Actor name" }
+                ["name"] = new JsonObject { ["type"] = "string", ["description"] = "Actor name" },
+                ["non_default_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add properties: only the values that differ from the actor's archetype" },
+                ["include_hash"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add state_hash, a CRC of the full property state" }
             },
             new JsonArray { "name" }
         ));
 
+        tools.Add(MakeTool(
+            "get_objects_properties",
+            "Export reflected properties of many objects in one call (level actors, object paths, or Blueprint class defaults)",
+            new JsonObject
+            {
+                ["objects"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Actor names/labels, object paths, or Blueprint asset paths (exports the class defaults)",
+                    ["items"] = new JsonObject { ["type"] = "string" }
+                },
+                ["properties"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Optional property names or paths; all exportable properties when omitted",
+                    ["items"] = new JsonObject { ["type"] = "string" }
+                },
+                ["only_editable"] = new JsonObject { ["type"] = "boolean", ["description"] = "Only export editor-visible properties (default true)" },
+                ["non_default_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Only export values that differ from each object's archetype" },
+                ["include_hash"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add state_hash, a CRC of the full property state" }
+            },
+            new JsonArray { "objects" }
+        ));
+
         tools.Add(MakeTool(
             "set_actor_property",
             "Set a property on an actor",
@@ -232,18 +258,38 @@ public static class ToolSchemas
             new JsonObject
             {
                 ["name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
-                ["parent_class"] = new JsonObject { ["type"] = "string", ["description"] = "Parent class (e.g., Actor, Pawn, Character)" }
+                ["parent_class"] = new JsonObject { ["type"] = "string", ["description"] = "Parent class: native name with or without A/U prefix (Actor, Pawn, Character), Blueprint name, or class path" }
             },
             new JsonArray { "name", "parent_class" }
         ));
 
+        tools.Add(MakeTool(
+            "create_blueprints_from_template",
+            "Create many Blueprints by duplicating a template, applying per-variant property overrides, and compiling them as one batch",
+            new JsonObject
+            {
+                ["template_name"] = new JsonObject { ["type"] = "string", ["description"] = "Template Blueprint name" },
+                ["template_path"] = new JsonObject { ["type"] = "string", ["description"] = "Optional canonical template asset path for disambiguation" },
+                ["blueprints"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Variants: {name, folder_path?, asset_path?, properties?: {path: value} on the class defaults, component_properties?: {Component: {path: value}}}",
+                    ["items"] = new JsonObject { ["type"] = "object" }
+                },
+                ["folder_path"] = new JsonObject { ["type"] = "string", ["description"] = "Default destination folder for variants without folder_path/asset_path" },
+                ["compile"] = new JsonObject { ["type"] = "boolean", ["description"] = "Compile all created Blueprints in one chunked batch (default true)" },
+                ["chunk_size"] = new JsonObject { ["type"] = "integer", ["description"] = "Blueprints per compile chunk (default 16)" }
+            },
+            new JsonArray { "blueprints" }
+        ));
+
         tools.Add(MakeTool(
             "add_component_to_blueprint",
             "Add a component to a Blueprint",
             new JsonObject
             {
                 ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Target Blueprint name" },
-                ["component_type"] = new JsonObject { ["type"] = "string", ["description"] = "Component type (use class name without U prefix, e.g., StaticMeshComponent, CameraComponent)" },
+                ["component_type"] = new JsonObject { ["type"] = "string", ["description"] = "Component type: class name with or without U prefix or Component suffix (StaticMeshComponent, Camera), Blueprint component name, or class path" },
                 ["component_name"] = new JsonObject { ["type"] = "string", ["description"] = "Name for the new component" },
                 ["location"] = new JsonObject { ["type"] = "array", ["description"] = "[X, Y, Z] relative position", ["items"] = new JsonObject { ["type"] = "number" }, ["default"] = new JsonArray { 0.0, 0.0, 0.0 } },
                 ["rotation"] = new JsonObject { ["type"] = "array", ["description"] = "[Pitch, Yaw, Roll] relative rotation", ["items"] = new JsonObject { ["type"] = "number" }, ["default"] = new JsonArray { 0.0, 0.0, 0.0 } },
@@ -278,6 +324,18 @@ public static class ToolSchemas
             new JsonArray { "blueprint_name", "component_name", "property_name", "property_value" }
         ));
 
+        tools.Add(MakeTool(
+            "set_component_properties",
+            "Set many properties on many Blueprint components in one undo transaction",
+            new JsonObject
+            {
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Target Blueprint name" },
+                ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Canonical Blueprint asset path (disambiguates the name)" },
+                ["components"] = new JsonObject { ["type"] = "object", ["description"] = "Component name -> {property path: value}, e.g. {\"Mesh\": {\"RelativeLocation\": [0,0,50], \"BodyInstance.MassScale\": 2}}" }
+            },
+            new JsonArray { "components" }
+        ));
+
         tools.Add(MakeTool(
             "set_physics_properties",
             "Set physics properties on a component (convenience wrapper)",
@@ -299,7 +357,8 @@ public static class ToolSchemas
             "Compile a Blueprint (required after graph changes)",
             new JsonObject
             {
-                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" }
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
+                ["force"] = new JsonObject { ["type"] = "boolean", ["description"] = "Compile even if the structural fingerprint is unchanged", ["default"] = false }
             },
             new JsonArray { "blueprint_name" }
         ));
@@ -324,9 +383,11 @@ public static class ToolSchemas
             {
                 ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
                 ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Optional canonical asset path for disambiguation (e.g., /Game/Foo/BP_Bar)" },
-                ["property_name"] = new JsonObject { ["type"] = "string", ["description"] = "Property name" }
+                ["property_name"] = new JsonObject { ["type"] = "string", ["description"] = "Property name or path; may be omitted with non_default_only" },
+                ["non_default_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Without property_name: return only the properties that differ from the parent class defaults. With property_name: add property_is_default" },
+                ["include_hash"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add state_hash, a CRC of the full property state" }
             },
-            new JsonArray { "blueprint_name", "property_name" }
+            new JsonArray { "blueprint_name" }
         ));
 
         tools.Add(MakeTool(
@@ -348,9 +409,11 @@ public static class ToolSchemas
                 ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
                 ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Optional canonical asset path for disambiguation (e.g., /Game/Foo/BP_Bar)" },
                 ["component_name"] = new JsonObject { ["type"] = "string", ["description"] = "Component name in Blueprint (e.g., Mesh, RotatingMovement)" },
-                ["property_name"] = new JsonObject { ["type"] = "string", ["description"] = "Property name on the component" }
+                ["property_name"] = new JsonObject { ["type"] = "string", ["description"] = "Property name or path on the component; may be omitted with non_default_only" },
+                ["non_default_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Without property_name: return only the properties that differ from the component archetype. With property_name: add property_is_default" },
+                ["include_hash"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add state_hash, a CRC of the full property state" }
             },
-            new JsonArray { "blueprint_name", "component_name", "property_name" }
+            new JsonArray { "blueprint_name", "component_name" }
         ));
 
 
@@ -488,7 +551,9 @@ public static class ToolSchemas
             {
                 ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
                 ["node_type"] = new JsonObject { ["type"] = "string", ["description"] = "Node type to search for (optional)" },
-                ["event_type"] = new JsonObject { ["type"] = "string", ["description"] = "Event type to search for (optional)" }
+                ["event_type"] = new JsonObject { ["type"] = "string", ["description"] = "Event type to search for (optional)" },
+                ["node_id"] = new JsonObject { ["type"] = "string", ["description"] = "Node GUID to look up when node_type is Guid (optional)" },
+                ["include_fingerprint"] = new JsonObject { ["type"] = "boolean", ["description"] = "Also return the Blueprint's structural fingerprint (walks every graph)", ["default"] = false }
             },
             new JsonArray { "blueprint_name" }
         ));
@@ -522,6 +587,23 @@ public static class ToolSchemas
             new JsonArray { "blueprint_name", "node_type" }
         ));
 
+        tools.Add(MakeTool(
+            "export_blueprint_graph",
+            "Export every graph of a Blueprint (event, function, macro, construction script) with nodes, pins and links in one compact columnar response. Names are interned in a shared 'strings' table; edges are [output_pin, input_pin] index pairs. Paged by graph and fingerprinted for client-side caching.",
+            new JsonObject
+            {
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
+                ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Optional: full asset path for disambiguation" },
+                ["graphs"] = new JsonObject { ["type"] = "array", ["items"] = new JsonObject { ["type"] = "string" }, ["description"] = "Only these graph names (default: all)" },
+                ["graph_offset"] = new JsonObject { ["type"] = "integer", ["description"] = "First graph to return (default: 0)", ["default"] = 0 },
+                ["graph_limit"] = new JsonObject { ["type"] = "integer", ["description"] = "Maximum graphs to return; 0 = all (default: 0)", ["default"] = 0 },
+                ["include_titles"] = new JsonObject { ["type"] = "boolean", ["description"] = "Add a node title column (slow on big graphs; default: false)", ["default"] = false },
+                ["fingerprint"] = new JsonObject { ["type"] = "string", ["description"] = "Fingerprint from a previous export; returns not_modified when nothing changed" },
+                ["known_fingerprints"] = new JsonObject { ["type"] = "object", ["description"] = "Graph name -> fingerprint from a previous export; unchanged graphs are returned without tables" }
+            },
+            new JsonArray()
+        ));
+
         // ==================== Project Tools ====================
         tools.Add(MakeTool(
             "create_input_mapping",
@@ -535,6 +617,19 @@ public static class ToolSchemas
             new JsonArray { "action_name", "key", "input_type" }
         ));
 
+        tools.Add(MakeTool(
+            "create_input_mappings",
+            "Create many legacy action/axis mappings in one call (one keymap rebuild, one config write), optionally generating Enhanced Input actions and a mapping context saved in one pass. Validates everything first; any invalid entry changes nothing.",
+            new JsonObject
+            {
+                ["action_mappings"] = new JsonObject { ["type"] = "array", ["items"] = new JsonObject { ["type"] = "object" }, ["description"] = "Action mappings: {action_name, key, shift?, ctrl?, alt?, cmd?}" },
+                ["axis_mappings"] = new JsonObject { ["type"] = "array", ["items"] = new JsonObject { ["type"] = "object" }, ["description"] = "Axis mappings: {axis_name, key, scale?}" },
+                ["replace"] = new JsonObject { ["type"] = "boolean", ["description"] = "Remove existing mappings for the named actions/axes first (default: false)", ["default"] = false },
+                ["enhanced_input"] = new JsonObject { ["type"] = "object", ["description"] = "Optional Enhanced Input assets: {path?: '/Game/Input', mapping_context?: 'IMC_Default', action_prefix?: 'IA_', actions?: [{name, value_type: Boolean|Axis1D|Axis2D|Axis3D, keys: [key | {key, modifiers?, triggers?}]}]}. Without actions, one input action is derived per legacy action/axis name; shift/ctrl/alt/cmd become chord triggers on generated modifier-key actions. Modifiers/triggers are class names ('Negate', 'SwizzleAxis', 'Pressed') or {type, properties}." }
+            },
+            new JsonArray()
+        ));
+
         // ==================== UMG Tools ====================
         tools.Add(MakeTool(
             "create_umg_widget_blueprint",
@@ -618,6 +713,38 @@ public static class ToolSchemas
             new JsonArray { "widget_name", "text_block_name", "binding_property" }
         ));
 
+        tools.Add(MakeTool(
+            "build_widget_tree",
+            "Build a whole widget hierarchy (panels, slots, any UWidget class, properties, events, bindings) in one transaction with one compile",
+            new JsonObject
+            {
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Widget Blueprint name" },
+                ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Widget Blueprint asset path (preferred)" },
+                ["widgets"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Nodes: {type, name, is_variable, properties: {path: value}, slot: {path: value}, position: [x,y], size: [w,h], events: [\"OnClicked\"], bindings: {\"Text\": \"GetScoreText\"}, children: [...]}",
+                    ["items"] = new JsonObject { ["type"] = "object" }
+                },
+                ["parent"] = new JsonObject { ["type"] = "string", ["description"] = "Existing panel to build under (default: the root widget)" },
+                ["replace"] = new JsonObject { ["type"] = "boolean", ["description"] = "Discard the existing tree first; widgets must then hold exactly one root" }
+            },
+            new JsonArray { "widgets" }
+        ));
+
+        tools.Add(MakeTool(
+            "get_widget_tree",
+            "Export a Widget Blueprint's hierarchy (non-default properties, slots, events, bindings) in the form build_widget_tree accepts",
+            new JsonObject
+            {
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Widget Blueprint name" },
+                ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Widget Blueprint asset path (preferred)" },
+                ["root"] = new JsonObject { ["type"] = "string", ["description"] = "Export only the subtree under this widget" },
+                ["include_properties"] = new JsonObject { ["type"] = "boolean", ["description"] = "Include non-default widget and slot properties (default true)" }
+            },
+            new JsonArray()
+        ));
+
         // ==================== Interchange Tools ====================
         tools.Add(MakeTool(
             "import_model",
@@ -630,7 +757,8 @@ public static class ToolSchemas
                 ["import_material"] = new JsonObject { ["type"] = "boolean", ["description"] = "Import materials", ["default"] = true },
                 ["import_texture"] = new JsonObject { ["type"] = "boolean", ["description"] = "Import textures", ["default"] = true },
                 ["import_skeleton"] = new JsonObject { ["type"] = "boolean", ["description"] = "Import skeleton for skeletal meshes", ["default"] = true },
-                ["create_physics_asset"] = new JsonObject { ["type"] = "boolean", ["description"] = "Create physics asset for skeletal meshes", ["default"] = false }
+                ["create_physics_asset"] = new JsonObject { ["type"] = "boolean", ["description"] = "Create physics asset for skeletal meshes", ["default"] = false },
+                ["force"] = new JsonObject { ["type"] = "boolean", ["description"] = "Ignore the import cache even if the source file is unchanged", ["default"] = false }
             },
             new JsonArray { "file_path" }
         ));
@@ -673,10 +801,11 @@ public static class ToolSchemas
 
         tools.Add(MakeTool(
             "reimport_asset",
-            "Trigger reimport for existing assets after source file changes",
+            "Trigger reimport for existing assets after source file changes (skipped when the source content is unchanged)",
             new JsonObject
             {
-                ["asset_path"] = new JsonObject { ["type"] = "string", ["description"] = "UE content path of asset to reimport" }
+                ["asset_path"] = new JsonObject { ["type"] = "string", ["description"] = "UE content path of asset to reimport" },
+                ["force"] = new JsonObject { ["type"] = "boolean", ["description"] = "Reimport even if the source file is unchanged", ["default"] = false }
             },
             new JsonArray { "asset_path" }
         ));
@@ -691,6 +820,124 @@ public static class ToolSchemas
             new JsonArray()
         ));
 
+        tools.Add(MakeTool(
+            "scan_import_sources",
+            "Inspect source model files (glTF/GLB, OBJ/MTL, FBX, PLY) without importing: counts, vertex totals, embedded textures, external files",
+            new JsonObject
+            {
+                ["file_paths"] = new JsonObject { ["type"] = "array", ["description"] = "Absolute paths of source files to scan", ["items"] = new JsonObject { ["type"] = "string" } },
+                ["directory"] = new JsonObject { ["type"] = "string", ["description"] = "Directory to scan for supported formats (optional)" },
+                ["recursive"] = new JsonObject { ["type"] = "boolean", ["description"] = "Recurse into subdirectories", ["default"] = true },
+                ["max_file_size_mb"] = new JsonObject { ["type"] = "number", ["description"] = "Flag files larger than this as oversized (0 = no limit)", ["default"] = 0 },
+                ["max_vertices"] = new JsonObject { ["type"] = "integer", ["description"] = "Flag files with more vertices than this as oversized (0 = no limit)", ["default"] = 0 }
+            },
+            new JsonArray()
+        ));
+
+        tools.Add(MakeTool(
+            "apply_blueprint_graph_patch",
+            "Create many Blueprint nodes, pin defaults and links in one transaction; returns temporary id to node GUID mapping",
+            new JsonObject
+            {
+                ["blueprint_name"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint name" },
+                ["blueprint_path"] = new JsonObject { ["type"] = "string", ["description"] = "Blueprint asset path (optional, disambiguates)" },
+                ["graph_name"] = new JsonObject { ["type"] = "string", ["description"] = "Target graph (default EventGraph; ConstructionScript or any function graph name)" },
+                ["nodes"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Nodes: {id, node_type (Event|FunctionCall|VariableGet|VariableSet|GetComponent|InputAction|Self), event_name, function_name, target, variable_name, action_name, node_position [x, y], pins {name: value}}",
+                    ["items"] = new JsonObject { ["type"] = "object" }
+                },
+                ["links"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Links: {from_node, from_pin, to_node, to_pin}; nodes are temporary ids or existing node GUIDs",
+                    ["items"] = new JsonObject { ["type"] = "object" }
+                },
+                ["compile"] = new JsonObject { ["type"] = "boolean", ["description"] = "Queue a full compile at the end of the request (default false: skeleton refresh only)" }
+            },
+            new JsonArray { "blueprint_name" }
+        ));
+
+        tools.Add(MakeTool(
+            "search_blueprint_functions",
+            "Search Blueprint-callable functions by name or display name (autocomplete)",
+            new JsonObject
+            {
+                ["query"] = new JsonObject { ["type"] = "string", ["description"] = "Name prefix (case-insensitive)" },
+                ["target"] = new JsonObject { ["type"] = "string", ["description"] = "Only functions callable on this class, including inherited ones (optional)" },
+                ["match"] = new JsonObject { ["type"] = "string", ["description"] = "prefix (default) or contains" },
+                ["limit"] = new JsonObject { ["type"] = "integer", ["description"] = "Maximum results (default 50, max 500)" }
+            },
+            new JsonArray { "query" }
+        ));
+
+        tools.Add(MakeTool(
+            "search_blueprint_graphs",
+            "Find graph nodes across every project Blueprint that call a function, read/write a variable, implement an event, use a macro or are of a node class. Answered from a persisted index; Blueprints not indexed yet are crawled in the background (see pending/index_complete) unless wait=true.",
+            new JsonObject
+            {
+                ["name"] = new JsonObject { ["type"] = "string", ["description"] = "Function, variable, event, macro or node class name (case-insensitive; node classes may omit K2Node_)" },
+                ["kind"] = new JsonObject { ["type"] = "string", ["description"] = "function, variable, event, macro, node_class or any (default)", ["enum"] = new JsonArray { "function", "variable", "event", "macro", "node_class", "any" } },
+                ["owner"] = new JsonObject { ["type"] = "string", ["description"] = "Only members declared on this class (e.g. KismetSystemLibrary, BP_Door_C)" },
+                ["match"] = new JsonObject { ["type"] = "string", ["description"] = "exact (default), prefix or contains" },
+                ["path"] = new JsonObject { ["type"] = "string", ["description"] = "Only Blueprints under this package path (e.g. /Game/Characters)" },
+                ["limit"] = new JsonObject { ["type"] = "integer", ["description"] = "Maximum results (default 100, max 1000)" },
+                ["blueprints_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Return matching Blueprint paths instead of nodes", ["default"] = false },
+                ["wait"] = new JsonObject { ["type"] = "boolean", ["description"] = "Finish indexing every queued Blueprint before answering (loads them)", ["default"] = false },
+                ["rebuild"] = new JsonObject { ["type"] = "boolean", ["description"] = "Discard the index and queue every Blueprint again", ["default"] = false }
+            },
+            new JsonArray { "name" }
+        ));
+
+        tools.Add(MakeTool(
+            "compile_blueprints",
+            "Compile many Blueprints (list and/or folder) through the compilation manager in chunks; returns a job_id unless wait=true",
+            new JsonObject
+            {
+                ["blueprints"] = new JsonObject { ["type"] = "array", ["description"] = "Blueprint names or asset paths", ["items"] = new JsonObject { ["type"] = "string" } },
+                ["folder"] = new JsonObject { ["type"] = "string", ["description"] = "Compile every Blueprint under this content folder (e.g. /Game/Blueprints)" },
+                ["recursive"] = new JsonObject { ["type"] = "boolean", ["description"] = "Include subfolders of folder", ["default"] = true },
+                ["chunk_size"] = new JsonObject { ["type"] = "integer", ["description"] = "Blueprints compiled per editor tick", ["default"] = 16 },
+                ["wait"] = new JsonObject { ["type"] = "boolean", ["description"] = "Compile everything before returning instead of across ticks", ["default"] = false },
+                ["force"] = new JsonObject { ["type"] = "boolean", ["description"] = "Also compile Blueprints whose structural fingerprint is unchanged", ["default"] = false }
+            },
+            new JsonArray()
+        ));
+
+        tools.Add(MakeTool(
+            "get_compile_blueprints_status",
+            "Progress and per-Blueprint diagnostics of a compile_blueprints job",
+            new JsonObject
+            {
+                ["job_id"] = new JsonObject { ["type"] = "string", ["description"] = "job_id returned by compile_blueprints" }
+            },
+            new JsonArray { "job_id" }
+        ));
+
+        tools.Add(MakeTool(
+            "flush_compiles",
+            "Compile every Blueprint left pending by requests sent with defer_compile=true (one compile per Blueprint)",
+            new JsonObject(),
+            new JsonArray()
+        ));
+
+        tools.Add(MakeTool(
+            "save_dirty",
+            "Save every package dirtied by MCP commands in one pass (async file writes, flushed once). Requests or batches sent with save=\"deferred\" do this automatically at the end",
+            new JsonObject
+            {
+                ["packages"] = new JsonObject
+                {
+                    ["type"] = "array",
+                    ["description"] = "Optional long package names (/Game/...) to save; all tracked dirty packages when omitted",
+                    ["items"] = new JsonObject { ["type"] = "string" }
+                },
+                ["list_only"] = new JsonObject { ["type"] = "boolean", ["description"] = "Only list the tracked dirty packages, do not save" }
+            },
+            new JsonArray()
+        ));
+
         tools.Add(MakeTool(
             "ping",
             "Ping Unreal MCP plugin",
@@ -55,6 +55,7 @@ public static class UnrealMcpUsageGuide
 - `list_blueprint_components(blueprint_name, blueprint_path="")` - List Blueprint components (SCS)
 - `get_component_property(blueprint_name, component_name, property_name, blueprint_path="")` - Read component template property
 - `set_component_property(blueprint_name, component_name, property_name, property_value)` - Set component template property
+- `set_component_properties(blueprint_name, components, blueprint_path="""")` - Set many component properties at once (`components`: {Component: {path: value}})
 - `set_static_mesh_properties(blueprint_name, component_name, static_mesh)` - Configure meshes
 - `set_physics_properties(blueprint_name, component_name)` - Configure physics
 - `get_blueprint_property(blueprint_name, property_name, blueprint_path="")` - Read Blueprint CDO property
@@ -72,6 +73,8 @@ public static class UnrealMcpUsageGuide
 - `add_blueprint_get_self_component_reference(blueprint_name, component_name)` - Add component refs
 - `add_blueprint_self_reference(blueprint_name)` - Add self references
 - `find_blueprint_nodes(blueprint_name, node_type, event_type)` - Find nodes
+- `search_blueprint_graphs(name, kind=""any"", owner="""", match=""exact"", path="""", blueprints_only=false)` - Find every Blueprint node that calls a function, uses a variable or event, or has a node class, project-wide
+- `export_blueprint_graph(blueprint_name, graphs=[], graph_offset=0, graph_limit=0, include_titles=false, fingerprint="""")` - Every graph's nodes, pins and links in one columnar response; pass the returned fingerprint back to skip unchanged exports
 
 ## Construction Script (Editor-Time Initialization)
 Construction Script is a special graph that runs in the editor when an Actor is placed or properties change.